@@ -56,6 +56,14 @@
     #endif
 #endif  /*LV_USE_MALLOC == LV_STDLIB_BUILTIN*/
 
+/*Allocate the small objects which are created and deleted very often (draw tasks, layers, linked list nodes, etc)
+ *from pages of fixed size blocks. It makes the allocation faster and reduces the fragmentation of the heap.*/
+#define LV_USE_MEM_SLAB 0
+#if LV_USE_MEM_SLAB
+    /*Size of a page of blocks allocated with the malloc of LVGL*/
+    #define LV_MEM_SLAB_PAGE_SIZE 2048     /*[bytes]*/
+#endif
+
 /*====================
    HAL SETTINGS
  *====================*/
@@ -77,6 +85,15 @@
 /*Align the start address of draw_buf addresses to this bytes*/
 #define LV_DRAW_BUF_ALIGN                       4
 
+/*Give each draw unit an arena for the temporary buffers of the draw tasks (mask lines, image conversion, etc).
+ *The buffers are allocated from the arena and freed in reverse order so the memory is reused without heap calls.
+ *If the arena is full the buffers are allocated with `lv_malloc` instead. See `lv_draw_arena_get_info()`.*/
+#define LV_USE_DRAW_ARENA 0
+#if LV_USE_DRAW_ARENA
+    /*Size of the arena of each draw unit*/
+    #define LV_DRAW_ARENA_SIZE    (16 * 1024)    /*[bytes]*/
+#endif
+
 #define LV_USE_DRAW_SW 1
 #if LV_USE_DRAW_SW == 1
     /* Set the number of draw unit.
@@ -84,6 +101,18 @@
      * > 1 means multiply threads will render the screen in parallel */
     #define LV_DRAW_SW_DRAW_UNIT_CNT    1
 
+    /* Split tall fill, image and layer draw tasks into horizontal bands of this many rows
+     * and let all the draw units render the bands of a task in parallel.
+     * Useful only if LV_DRAW_SW_DRAW_UNIT_CNT > 1
+     * 0: don't split the draw tasks */
+    #define LV_DRAW_SW_BAND_HEIGHT      0
+
+    /* Number of independent draw tasks a draw unit can take at once.
+     * The draw unit draws them one after the other without waiting for the dispatcher
+     * so with LV_USE_OS the render threads wake up the main thread less frequently.
+     * 1: take only one draw task at once */
+    #define LV_DRAW_SW_TASK_BATCH_CNT   4
+
     /* If a widget has `style_opa < 255` (not `bg_opa`, `text_opa` etc) or not NORMAL blend mode
      * it is buffered into a "simple" layer before rendering. The widget can be buffered in smaller chunks.
      * "Transformed layers" (if `transform_angle/zoom` are set) use larger buffers
@@ -99,9 +128,12 @@
     #if LV_DRAW_SW_COMPLEX == 1
         /*Allow buffering some shadow calculation.
         *LV_DRAW_SW_SHADOW_CACHE_SIZE is the max. shadow size to buffer, where shadow size is `shadow_width + radius`
-        *Caching has LV_DRAW_SW_SHADOW_CACHE_SIZE^2 RAM cost*/
+        *Caching has up to LV_DRAW_SW_SHADOW_CACHE_CNT * LV_DRAW_SW_SHADOW_CACHE_SIZE^2 RAM cost*/
         #define LV_DRAW_SW_SHADOW_CACHE_SIZE 0
 
+        /*Number of shadow corners to cache. The recently used ones are kept.*/
+        #define LV_DRAW_SW_SHADOW_CACHE_CNT 4
+
         /* Set number of maximally cached circle data.
         * The circumference of 1/4 circle are saved for anti-aliasing
         * radius * 4 bytes are used per circle (the most often used radiuses are saved)
@@ -109,6 +141,22 @@
         #define LV_DRAW_SW_CIRCLE_CACHE_SIZE 4
     #endif
 
+    /* Number of gradient color maps to cache. The recently used ones are kept.
+     * A map uses (sizeof(lv_color_t) + 1) bytes per pixel of the gradient's width or height.
+     * 0: to disable caching */
+    #define LV_DRAW_SW_GRADIENT_CACHE_CNT 0
+
+    /* 1: Sample prefiltered half, quarter, etc. sized copies of the images scaled to 50% or less.
+     * The copies are stored in the image cache and use up to 1/3 more memory than the decoded image. */
+    #define LV_DRAW_SW_IMAGE_MIPMAP 0
+
+    /*Use SIMD kernels for blending. Possible options:
+     * - LV_DRAW_SW_ASM_NONE
+     * - LV_DRAW_SW_ASM_NEON
+     * - LV_DRAW_SW_ASM_MVE
+     * - LV_DRAW_SW_ASM_SSE2
+     * - LV_DRAW_SW_ASM_AVX2  AVX2 if the CPU supports it (checked at runtime), else SSE2
+     * - LV_DRAW_SW_ASM_CUSTOM*/
     #define  LV_USE_DRAW_SW_ASM     LV_DRAW_SW_ASM_NONE
 
     #if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_CUSTOM
@@ -264,6 +312,10 @@
  *will be dropped immediately after usage.*/
 #define LV_CACHE_DEF_SIZE       0
 
+/*1: Use a cache manager which hashes the entries and drops the least recently used ones.
+ *Finding, using and dropping entries is O(1) instead of walking all the cached entries.*/
+#define LV_USE_CACHE_LRU        0
+
 /*Number of stops allowed per gradient. Increase this to allow more stops.
  *This adds (sizeof(lv_color_t) + 1) bytes per additional stop*/
 #define LV_GRADIENT_MAX_STOPS   2
@@ -275,6 +327,23 @@
 /* Add 2 x 32 bit variables to each lv_obj_t to speed up getting style properties */
 #define LV_OBJ_STYLE_CACHE      0
 
+/* Cache the resolved values of the 32 most used style properties per object part and state.
+ * Reading them again is only an array access until any style, state or parent changes.
+ * Needs about 32 x sizeof(lv_style_value_t) bytes per used object part.
+ * See `lv_obj_style_get_resolved_cache_info()` to measure the memory usage.*/
+#define LV_OBJ_STYLE_RESOLVED_CACHE 0
+
+/* Record the draw tasks of each object and add them again when the object is redrawn but hasn't changed
+ * instead of sending the draw events again. Makes redrawing static content much faster,
+ * but needs RAM for a copy of the draw descriptors of each drawn object.
+ * Objects whose look changes without invalidating them will be redrawn with their old look.*/
+#define LV_OBJ_DRAW_CACHE       0
+
+/* Before redrawing an area find the objects which are fully covered by opaque objects drawn later
+ * (checked with `LV_EVENT_COVER_CHECK`) and don't draw them at all.
+ * With `LV_USE_REFR_STATS` the number of skipped pixels is reported in `px_occluded`.*/
+#define LV_OBJ_OCCLUSION_CULLING    0
+
 /* Add `id` field to `lv_obj_t` */
 #define LV_USE_OBJ_ID           0
 
@@ -379,6 +448,16 @@
 /*Enables/disables support for compressed fonts.*/
 #define LV_USE_FONT_COMPRESSED 0
 
+/*Size of a cache in bytes to keep the A8 bitmaps of the glyphs of the built-in (`lv_font_fmt_txt`) fonts.
+ *Drawing text uses the cached bitmaps instead of converting or decompressing the glyphs again.
+ *0: disable the cache*/
+#define LV_FONT_FMT_TXT_CACHE_SIZE 0
+
+/*Build a small direct mapped table for each built-in (`lv_font_fmt_txt`) font when it's first used
+ *to look up the glyph IDs and kerning pairs without searching the font's tables.
+ *Uses 2 kB RAM for each used font*/
+#define LV_USE_FONT_FMT_TXT_ACCEL 0
+
 /*Enable drawing placeholders when glyph dsc is not found*/
 #define LV_USE_FONT_PLACEHOLDER 1
 
@@ -729,6 +808,14 @@
     #define LV_PROFILER_END_TAG   LV_PROFILER_BUILTIN_END_TAG
 #endif
 
+/*1: Collect statistics of each rendered frame (invalid areas, pixels, draw tasks, times, cache hits, etc)
+ *They can be read by `lv_refr_stats_get()`*/
+#define LV_USE_REFR_STATS 0
+
+/*1: Count how many times each event code was sent and handled to find the hot spots.
+ *They can be read by `lv_event_get_stats()`*/
+#define LV_USE_EVENT_STATS 0
+
 /*1: Enable Monkey test*/
 #define LV_USE_MONKEY 0
 
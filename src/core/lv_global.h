@@ -19,13 +19,16 @@ extern "C" {
 
 #include "../misc/lv_cache.h"
 #include "../misc/lv_cache_builtin.h"
+#include "../misc/lv_cache_lru.h"
 #include "../draw/lv_draw.h"
 #if LV_USE_DRAW_SW
 #include "../draw/sw/lv_draw_sw.h"
+#include "../draw/sw/lv_draw_sw_gradient.h"
 #endif
 #include "../misc/lv_anim.h"
 #include "../misc/lv_area.h"
 #include "../misc/lv_color_op.h"
+#include "../misc/lv_event.h"
 #include "../misc/lv_ll.h"
 #include "../misc/lv_log.h"
 #include "../misc/lv_profiler_builtin.h"
@@ -33,6 +36,7 @@ extern "C" {
 #include "../misc/lv_timer.h"
 #include "../others/sysmon/lv_sysmon.h"
 #include "../stdlib/builtin/lv_tlsf.h"
+#include "../stdlib/lv_mem_slab.h"
 
 #if LV_USE_FONT_COMPRESSED
 #include "../font/lv_font_fmt_txt.h"
@@ -78,6 +82,12 @@ typedef struct _lv_global_t {
     uint32_t style_custom_table_size;
     uint32_t style_last_custom_prop_id;
     uint8_t * style_custom_prop_flag_lookup_table;
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+    uint32_t style_resolved_generation;
+    uint32_t style_resolved_entry_cnt;
+    uint32_t style_resolved_hit_cnt;
+    uint32_t style_resolved_miss_cnt;
+#endif
 
     lv_ll_t group_ll;
     struct _lv_group_t * group_default;
@@ -96,6 +106,9 @@ typedef struct _lv_global_t {
 
     struct _lv_event_t * event_header;
     uint32_t event_last_register_id;
+#if LV_USE_EVENT_STATS
+    lv_event_stats_t event_stats;
+#endif
 
     lv_timer_state_t timer_state;
     lv_anim_state_t anim_state;
@@ -106,6 +119,7 @@ typedef struct _lv_global_t {
     lv_ll_t img_decoder_ll;
     lv_cache_manager_t cache_manager;
     lv_cache_builtin_dsc_t cache_builtin_dsc;
+    lv_cache_lru_dsc_t cache_lru_dsc;
     size_t cache_builtin_max_size;
 
     lv_draw_global_info_t draw_info;
@@ -115,11 +129,25 @@ typedef struct _lv_global_t {
 #if LV_DRAW_SW_COMPLEX
     _lv_draw_sw_mask_radius_circle_dsc_arr_t sw_circle_cache;
 #endif
+#if LV_USE_DRAW_SW && LV_DRAW_SW_BAND_HEIGHT
+    lv_draw_sw_band_job_t sw_band_job;
+#endif
+#if LV_USE_DRAW_SW && LV_DRAW_SW_GRADIENT_CACHE_CNT > 0
+    lv_draw_sw_grad_cache_t sw_grad_cache;
+#endif
+#if LV_USE_DRAW_SW && LV_DRAW_SW_IMAGE_MIPMAP
+    uint32_t sw_mipmap_cache_data_type;
+#endif
 
 #if LV_USE_LOG
     lv_log_print_g_cb_t custom_log_print_cb;
 #endif
 
+#if LV_USE_REFR_STATS
+    uint32_t (*refr_stats_tick_get_cb)(void);
+    uint32_t refr_stats_tick_per_sec;
+#endif
+
 #if LV_USE_LOG && LV_LOG_USE_TIMESTAMP
     uint32_t log_last_log_time;
 #endif
@@ -140,6 +168,10 @@ typedef struct _lv_global_t {
     lv_tlsf_state_t tlsf_state;
 #endif
 
+#if LV_USE_MEM_SLAB
+    lv_mem_slab_state_t mem_slab_state;
+#endif
+
     lv_ll_t fsdrv_ll;
 #if LV_USE_FS_STDIO != '\0'
     lv_fs_drv_t stdio_fs_drv;
@@ -164,6 +196,14 @@ typedef struct _lv_global_t {
     lv_font_fmt_rle_t font_fmt_rle;
 #endif
 
+#if LV_FONT_FMT_TXT_CACHE_SIZE > 0
+    lv_font_fmt_txt_cache_t font_fmt_txt_cache;
+#endif
+
+#if LV_USE_FONT_FMT_TXT_ACCEL
+    lv_font_fmt_txt_accel_list_t font_fmt_txt_accel;
+#endif
+
 #if LV_USE_SPAN != 0
     struct _snippet_stack * span_snippet_stack;
 #endif
@@ -372,16 +372,20 @@ static void lv_obj_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
             lv_free(obj->spec_attr->children);
             obj->spec_attr->children = NULL;
         }
-        if(obj->spec_attr->event_list.dsc) {
-            lv_free(obj->spec_attr->event_list.dsc);
-            obj->spec_attr->event_list.dsc = NULL;
-            obj->spec_attr->event_list.cnt = 0;
-        }
+        lv_event_remove_all(&obj->spec_attr->event_list);
 
         lv_free(obj->spec_attr);
         obj->spec_attr = NULL;
     }
 
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+    _lv_obj_style_free_resolved_cache(obj);
+#endif
+
+#if LV_OBJ_DRAW_CACHE
+    _lv_obj_free_draw_cache(obj);
+#endif
+
 #if LV_USE_OBJ_ID
     lv_obj_free_id(obj);
 #endif
@@ -745,6 +749,11 @@ static void update_obj_state(lv_obj_t * obj, lv_state_t new_state)
 
     obj->state = new_state;
 
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+    /*The children might inherit the changed properties*/
+    _lv_obj_style_invalidate_resolved_cache();
+#endif
+
     _lv_obj_style_transition_dsc_t * ts = lv_malloc_zeroed(sizeof(_lv_obj_style_transition_dsc_t) * STYLE_TRANSITION_MAX);
     uint32_t tsi = 0;
     uint32_t i;
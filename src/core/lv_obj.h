@@ -244,6 +244,12 @@ typedef struct _lv_obj_t {
 #if LV_OBJ_STYLE_CACHE
     uint32_t style_main_prop_is_set;
     uint32_t style_other_prop_is_set;
+#endif
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+    struct _lv_obj_style_resolved_t * style_resolved;
+#endif
+#if LV_OBJ_DRAW_CACHE
+    struct _lv_obj_draw_cache_t * draw_cache;
 #endif
     void * user_data;
 #if LV_USE_OBJ_ID
@@ -255,11 +261,15 @@ typedef struct _lv_obj_t {
     uint16_t layout_inv : 1;
     uint16_t readjust_scroll_after_layout : 1;
     uint16_t scr_layout_inv : 1;
+    uint16_t layout_child_inv : 1;  /**< A descendant needs a layout update or scroll readjustment*/
     uint16_t skip_trans : 1;
     uint16_t style_cnt  : 6;
     uint16_t h_layout   : 1;
     uint16_t w_layout   : 1;
     uint16_t is_deleting : 1;
+#if LV_OBJ_OCCLUSION_CULLING
+    uint16_t occluded : 1;          /**< Covered by opaque objects in the area being refreshed*/
+#endif
 } lv_obj_t;
 
 /**********************
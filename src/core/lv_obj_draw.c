@@ -11,6 +11,7 @@
 #include "../display/lv_display.h"
 #include "../indev/lv_indev.h"
 #include "../stdlib/lv_string.h"
+#include "lv_global.h"
 
 /*********************
  *      DEFINES
@@ -21,6 +22,13 @@
  *      TYPEDEFS
  **********************/
 
+#if LV_OBJ_DRAW_CACHE
+typedef struct _lv_obj_draw_cache_t {
+    lv_draw_record_t record;
+    lv_area_t coords;           /**< Coordinates of the object when the draw tasks were recorded*/
+} lv_obj_draw_cache_t;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -321,6 +329,67 @@ lv_layer_type_t _lv_obj_get_layer_type(const lv_obj_t * obj)
     else return LV_LAYER_TYPE_NONE;
 }
 
+#if LV_OBJ_DRAW_CACHE
+
+void _lv_obj_draw_main_cached(lv_obj_t * obj, lv_layer_t * layer)
+{
+    lv_obj_draw_cache_t * cache = obj->draw_cache;
+
+    /*The recorded coordinates are absolute so they are outdated if the object was moved,
+     *e.g. by scrolling its parent*/
+    if(cache && _lv_area_is_equal(&cache->coords, &obj->coords) && lv_draw_record_replay(&cache->record, layer)) {
+        return;
+    }
+
+    /*Nested redraws (e.g. from a draw event) are drawn normally as only one recording can be in progress*/
+    if(LV_GLOBAL_DEFAULT()->draw_info.record == NULL) {
+        if(cache == NULL) {
+            cache = lv_malloc_zeroed(sizeof(lv_obj_draw_cache_t));
+            LV_ASSERT_MALLOC(cache);
+            obj->draw_cache = cache;
+        }
+
+        if(cache) {
+            cache->coords = obj->coords;
+            lv_draw_record_start(&cache->record, layer);
+        }
+    }
+    else {
+        cache = NULL;
+    }
+
+    lv_obj_send_event(obj, LV_EVENT_DRAW_MAIN_BEGIN, layer);
+    lv_obj_send_event(obj, LV_EVENT_DRAW_MAIN, layer);
+    lv_obj_send_event(obj, LV_EVENT_DRAW_MAIN_END, layer);
+
+    if(cache && !lv_draw_record_stop(&cache->record)) {
+        _lv_obj_free_draw_cache(obj);
+    }
+}
+
+void _lv_obj_free_draw_cache(lv_obj_t * obj)
+{
+    if(obj->draw_cache) {
+        lv_draw_record_stop(&obj->draw_cache->record);
+        lv_draw_record_reset(&obj->draw_cache->record);
+        lv_free(obj->draw_cache);
+        obj->draw_cache = NULL;
+    }
+}
+
+void _lv_obj_free_children_draw_cache(lv_obj_t * obj)
+{
+    uint32_t i;
+    uint32_t child_cnt = lv_obj_get_child_count(obj);
+    for(i = 0; i < child_cnt; i++) {
+        lv_obj_t * child = obj->spec_attr->children[i];
+        _lv_obj_free_draw_cache(child);
+        _lv_obj_free_children_draw_cache(child);
+    }
+}
+
+#endif /*LV_OBJ_DRAW_CACHE*/
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
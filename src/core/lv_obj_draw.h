@@ -109,6 +109,34 @@ int32_t _lv_obj_get_ext_draw_size(const struct _lv_obj_t * obj);
 
 lv_layer_type_t _lv_obj_get_layer_type(const struct _lv_obj_t * obj);
 
+#if LV_OBJ_DRAW_CACHE
+
+/**
+ * Add the draw tasks of the object's main draw phase to a layer.
+ * The draw tasks recorded earlier are added again if the object hasn't changed since then,
+ * else `LV_EVENT_DRAW_MAIN_BEGIN`, `LV_EVENT_DRAW_MAIN` and `LV_EVENT_DRAW_MAIN_END` are sent
+ * and the new draw tasks are recorded.
+ * @param obj       pointer to an object
+ * @param layer     pointer to a layer whose clip area is already set for the object
+ */
+void _lv_obj_draw_main_cached(struct _lv_obj_t * obj, lv_layer_t * layer);
+
+/**
+ * Free the draw tasks recorded for an object.
+ * Called when the object is invalidated or deleted.
+ * @param obj       pointer to an object
+ */
+void _lv_obj_free_draw_cache(struct _lv_obj_t * obj);
+
+/**
+ * Free the draw tasks recorded for the children of an object recursively.
+ * Called when a style property changes which can change the children's look too.
+ * @param obj       pointer to an object
+ */
+void _lv_obj_free_children_draw_cache(struct _lv_obj_t * obj);
+
+#endif /*LV_OBJ_DRAW_CACHE*/
+
 /**********************
  *      MACROS
  **********************/
@@ -28,6 +28,7 @@
 static int32_t calc_content_width(lv_obj_t * obj);
 static int32_t calc_content_height(lv_obj_t * obj);
 static void layout_update_core(lv_obj_t * obj);
+static lv_obj_t * mark_layout_path(lv_obj_t * obj);
 static void transform_point(const lv_obj_t * obj, lv_point_t * p, bool inv);
 
 /**********************
@@ -193,6 +194,7 @@ bool lv_obj_refr_size(lv_obj_t * obj)
     lv_obj_invalidate(obj);
 
     obj->readjust_scroll_after_layout = 1;
+    mark_layout_path(obj);
 
     /*If the object was out of the parent invalidate the new scrollbar area too.
      *If it wasn't out of the parent but out now, also invalidate the scrollbars*/
@@ -278,7 +280,7 @@ void lv_obj_mark_layout_as_dirty(lv_obj_t * obj)
     obj->layout_inv = 1;
 
     /*Mark the screen as dirty too to mark that there is something to do on this screen*/
-    lv_obj_t * scr = lv_obj_get_screen(obj);
+    lv_obj_t * scr = mark_layout_path(obj);
     scr->scr_layout_inv = 1;
 
     /*Make the display refreshing*/
@@ -801,6 +803,11 @@ void lv_obj_invalidate_area(const lv_obj_t * obj, const lv_area_t * area)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+#if LV_OBJ_DRAW_CACHE
+    /*The object is about to look different, so the recorded draw tasks are outdated*/
+    _lv_obj_free_draw_cache((lv_obj_t *)obj);
+#endif
+
     lv_display_t * disp   = lv_obj_get_disp(obj);
     if(!lv_display_is_invalidation_enabled(disp)) return;
 
@@ -1091,13 +1098,25 @@ static int32_t calc_content_height(lv_obj_t * obj)
     return LV_MAX(self_h, child_res + space_bottom);
 }
 
+/**
+ * Update the layout of the objects marked by `lv_obj_mark_layout_as_dirty()` in the subtree of `obj`.
+ * Only the children whose subtree has something to update are visited.
+ * The children are updated first, as the size of the parent might depend on them (`LV_SIZE_CONTENT`).
+ */
 static void layout_update_core(lv_obj_t * obj)
 {
     uint32_t i;
     uint32_t child_cnt = lv_obj_get_child_count(obj);
-    for(i = 0; i < child_cnt; i++) {
-        lv_obj_t * child = obj->spec_attr->children[i];
-        layout_update_core(child);
+
+    /*Clear the flag first, so the children marked while updating this subtree mark it again*/
+    if(obj->layout_child_inv) {
+        obj->layout_child_inv = 0;
+        for(i = 0; i < child_cnt; i++) {
+            lv_obj_t * child = obj->spec_attr->children[i];
+            if(child->layout_inv || child->layout_child_inv || child->readjust_scroll_after_layout) {
+                layout_update_core(child);
+            }
+        }
     }
 
     if(obj->layout_inv) {
@@ -1116,13 +1135,30 @@ static void layout_update_core(lv_obj_t * obj)
     }
 }
 
+/**
+ * Mark the ancestors of an object that there is something to update in their subtree
+ * @param obj       pointer to an object
+ * @return          the screen of the object
+ */
+static lv_obj_t * mark_layout_path(lv_obj_t * obj)
+{
+    while(obj->parent) {
+        obj = obj->parent;
+        obj->layout_child_inv = 1;
+    }
+
+    return obj;
+}
+
 static void transform_point(const lv_obj_t * obj, lv_point_t * p, bool inv)
 {
     int32_t angle = lv_obj_get_style_transform_rotation(obj, 0);
     int32_t scale_x = lv_obj_get_style_transform_scale_x_safe(obj, 0);
     int32_t scale_y = lv_obj_get_style_transform_scale_y_safe(obj, 0);
+    int32_t skew_x = lv_obj_get_style_transform_skew_x(obj, 0);
+    int32_t skew_y = lv_obj_get_style_transform_skew_y(obj, 0);
 
-    if(angle == 0 && scale_x == LV_SCALE_NONE && scale_y == LV_SCALE_NONE) return;
+    if(angle == 0 && scale_x == LV_SCALE_NONE && scale_y == LV_SCALE_NONE && skew_x == 0 && skew_y == 0) return;
 
     lv_point_t pivot = {
         .x = lv_obj_get_style_transform_pivot_x(obj, 0),
@@ -1143,7 +1179,11 @@ static void transform_point(const lv_obj_t * obj, lv_point_t * p, bool inv)
         angle = -angle;
         scale_x = (256 * 256) / scale_x;
         scale_y = (256 * 256) / scale_y;
+        lv_point_transform(p, angle, scale_x, scale_y, &pivot, false);
+        lv_point_skew(p, skew_x, skew_y, &pivot, true);
+    }
+    else {
+        lv_point_skew(p, skew_x, skew_y, &pivot, false);
+        lv_point_transform(p, angle, scale_x, scale_y, &pivot, true);
     }
-
-    lv_point_transform(p, angle, scale_x, scale_y, &pivot, !inv);
 }
@@ -20,6 +20,13 @@
 #define style_trans_ll_p &(LV_GLOBAL_DEFAULT()->style_trans_ll)
 #define _style_custom_prop_flag_lookup_table LV_GLOBAL_DEFAULT()->style_custom_prop_flag_lookup_table
 #define STYLE_PROP_SHIFTED(prop) ((uint32_t)1 << ((prop) >> 3))
+#define RESOLVED_PROP_CNT 32
+
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+#define resolved_cache_invalidate() _lv_obj_style_invalidate_resolved_cache()
+#else
+#define resolved_cache_invalidate() do {} while(0)
+#endif
 
 /**********************
  *      TYPEDEFS
@@ -33,6 +40,18 @@ typedef struct {
     lv_style_value_t end_value;
 } trans_t;
 
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+/*The resolved values of the cached properties of an object's part in a given state*/
+typedef struct _lv_obj_style_resolved_t {
+    struct _lv_obj_style_resolved_t * next;
+    lv_part_t part;
+    lv_state_t state;
+    uint32_t generation;                        /*The values are valid only in this generation*/
+    uint32_t valid;                             /*1 bit for each resolved value*/
+    lv_style_value_t values[RESOLVED_PROP_CNT];
+} lv_obj_style_resolved_t;
+#endif
+
 typedef enum {
     CACHE_ZERO = 0,
     CACHE_TRUE = 1,
@@ -50,6 +69,7 @@ typedef enum {
  **********************/
 static lv_style_t * get_local_style(lv_obj_t * obj, lv_style_selector_t selector);
 static _lv_obj_style_t * get_trans_style(lv_obj_t * obj, uint32_t part);
+static lv_style_value_t get_prop_resolve(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop);
 static lv_style_res_t get_prop_core(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, lv_style_value_t * v);
 static void report_style_change_core(void * style, lv_obj_t * obj);
 static void refresh_children_style(lv_obj_t * obj);
@@ -67,6 +87,23 @@ static bool style_has_flag(const lv_style_t * style, uint32_t flag);
  *  STATIC VARIABLES
  **********************/
 
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+/*The index + 1 of the cached properties in `lv_obj_style_resolved_t::values`. 0: not cached.
+ *The properties used the most while drawing and positioning the objects are selected.*/
+static const uint8_t resolved_prop_index[_LV_STYLE_NUM_BUILT_IN_PROPS] = {
+    [LV_STYLE_WIDTH] = 1, [LV_STYLE_HEIGHT] = 2, [LV_STYLE_ALIGN] = 3, [LV_STYLE_RADIUS] = 4,
+    [LV_STYLE_PAD_TOP] = 5, [LV_STYLE_PAD_BOTTOM] = 6, [LV_STYLE_PAD_LEFT] = 7, [LV_STYLE_PAD_RIGHT] = 8,
+    [LV_STYLE_BG_COLOR] = 9, [LV_STYLE_BG_OPA] = 10, [LV_STYLE_BG_GRAD_DIR] = 11, [LV_STYLE_BG_GRAD] = 12,
+    [LV_STYLE_BASE_DIR] = 13, [LV_STYLE_CLIP_CORNER] = 14,
+    [LV_STYLE_BORDER_WIDTH] = 15, [LV_STYLE_BORDER_COLOR] = 16, [LV_STYLE_BORDER_OPA] = 17,
+    [LV_STYLE_OUTLINE_WIDTH] = 18, [LV_STYLE_OUTLINE_OPA] = 19, [LV_STYLE_SHADOW_WIDTH] = 20, [LV_STYLE_SHADOW_OPA] = 21,
+    [LV_STYLE_TEXT_COLOR] = 22, [LV_STYLE_TEXT_OPA] = 23, [LV_STYLE_TEXT_FONT] = 24,
+    [LV_STYLE_TEXT_LETTER_SPACE] = 25, [LV_STYLE_TEXT_LINE_SPACE] = 26, [LV_STYLE_TEXT_ALIGN] = 27,
+    [LV_STYLE_OPA] = 28, [LV_STYLE_OPA_LAYERED] = 29, [LV_STYLE_COLOR_FILTER_DSC] = 30,
+    [LV_STYLE_BLEND_MODE] = 31, [LV_STYLE_TRANSFORM_ROTATION] = 32,
+};
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -254,6 +291,7 @@ void lv_obj_remove_style_all(struct _lv_obj_t * obj)
 
 void lv_obj_report_style_change(lv_style_t * style)
 {
+    resolved_cache_invalidate();
     if(!style_refr) return;
     lv_display_t * d = lv_display_get_next(NULL);
 
@@ -270,6 +308,17 @@ void lv_obj_refresh_style(lv_obj_t * obj, lv_style_selector_t selector, lv_style
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+    /*Even if refreshing is disabled the new values should be read*/
+    resolved_cache_invalidate();
+
+#if LV_OBJ_DRAW_CACHE
+    /*The children's look can depend on their parent too as they inherit some properties
+     *and use the opacity of the parents. Such changes invalidate only the parent.*/
+    if(prop == LV_STYLE_PROP_ANY || prop == LV_STYLE_OPA || lv_style_prop_has_flag(prop, LV_STYLE_PROP_FLAG_INHERITABLE)) {
+        _lv_obj_free_children_draw_cache(obj);
+    }
+#endif
+
     if(!style_refr) return;
 
     lv_obj_invalidate(obj);
@@ -390,72 +439,80 @@ lv_style_value_t lv_obj_get_style_prop(const lv_obj_t * obj, lv_part_t part, lv_
 {
     LV_ASSERT_NULL(obj)
 
-    lv_style_value_t value_act = { .ptr = NULL };
-    lv_style_res_t found;
-
-    /*The happy path*/
-#if LV_OBJ_STYLE_CACHE
-    const uint32_t prop_shifted = STYLE_PROP_SHIFTED(prop);
-    if((part == LV_PART_MAIN ? obj->style_main_prop_is_set : obj->style_other_prop_is_set) & prop_shifted)
-#endif
-    {
-        found = get_prop_core(obj, part, prop, &value_act);
-        if(found == LV_STYLE_RES_FOUND) return value_act;
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+    /*The values without the transitions are used only while creating the transitions, don't cache them*/
+    uint32_t idx = prop < _LV_STYLE_NUM_BUILT_IN_PROPS ? resolved_prop_index[prop] : 0;
+    if(idx == 0 || obj->skip_trans) return get_prop_resolve(obj, part, prop);
+    idx--;
+
+    lv_global_t * global = LV_GLOBAL_DEFAULT();
+    lv_obj_style_resolved_t * res = obj->style_resolved;
+    while(res && res->part != part) res = res->next;
+
+    if(res == NULL) {
+        res = lv_malloc(sizeof(lv_obj_style_resolved_t));
+        LV_ASSERT_MALLOC(res);
+        if(res == NULL) return get_prop_resolve(obj, part, prop);
+        res->part = part;
+        res->valid = 0;
+        res->next = obj->style_resolved;
+        ((lv_obj_t *)obj)->style_resolved = res;
+        global->style_resolved_entry_cnt++;
     }
-
-    extern const uint8_t _lv_style_builtin_prop_flag_lookup_table[];
-    bool inheritable = false;
-    if(prop < _LV_STYLE_NUM_BUILT_IN_PROPS) {
-        inheritable = _lv_style_builtin_prop_flag_lookup_table[prop] & LV_STYLE_PROP_FLAG_INHERITABLE;
+    else if(res->generation == global->style_resolved_generation && res->state == obj->state) {
+        if(res->valid & ((uint32_t)1 << idx)) {
+            global->style_resolved_hit_cnt++;
+            return res->values[idx];
+        }
     }
     else {
-        if(_style_custom_prop_flag_lookup_table != NULL) {
-            inheritable = _style_custom_prop_flag_lookup_table[prop - _LV_STYLE_NUM_BUILT_IN_PROPS] &
-                          LV_STYLE_PROP_FLAG_INHERITABLE;
-        }
+        res->valid = 0;
     }
 
-    if(inheritable) {
-        /*If not found, check the `MAIN` style first, if already on the MAIN part go to the parent*/
-        if(part != LV_PART_MAIN) part = LV_PART_MAIN;
-        else obj = obj->parent;
-
-        while(obj) {
-#if LV_OBJ_STYLE_CACHE
-            if(obj->style_main_prop_is_set & prop_shifted)
+    global->style_resolved_miss_cnt++;
+    res->generation = global->style_resolved_generation;
+    res->state = obj->state;
+    res->values[idx] = get_prop_resolve(obj, part, prop);
+    res->valid |= (uint32_t)1 << idx;
+    return res->values[idx];
+#else
+    return get_prop_resolve(obj, part, prop);
 #endif
-            {
-                found = get_prop_core(obj, part, prop, &value_act);
-                if(found == LV_STYLE_RES_FOUND) return value_act;
-            }
-            /*Check the parent too.*/
-            obj = obj->parent;
-        }
-    }
-    else {
-        /*Get the width and height from the class.
-         * WIDTH and HEIGHT are not inherited so add them in the `else` to skip checking them for inherited properties */
-        if(part == LV_PART_MAIN && (prop == LV_STYLE_WIDTH || prop == LV_STYLE_HEIGHT)) {
-            const lv_obj_class_t * cls = obj->class_p;
-            while(cls) {
-                if(prop == LV_STYLE_WIDTH) {
-                    if(cls->width_def != 0) return (lv_style_value_t) {
-                        .num = cls->width_def
-                    };
-                }
-                else {
-                    if(cls->height_def != 0) return (lv_style_value_t) {
-                        .num = cls->height_def
-                    };
-                }
-                cls = cls->base_class;
-            }
-        }
+}
+
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+
+void lv_obj_style_get_resolved_cache_info(lv_obj_style_resolved_cache_info_t * info)
+{
+    lv_global_t * global = LV_GLOBAL_DEFAULT();
+    info->entry_cnt = global->style_resolved_entry_cnt;
+    info->entry_size = sizeof(lv_obj_style_resolved_t);
+    info->mem_size = info->entry_cnt * info->entry_size;
+    info->prop_cnt = RESOLVED_PROP_CNT;
+    info->hit_cnt = global->style_resolved_hit_cnt;
+    info->miss_cnt = global->style_resolved_miss_cnt;
+}
+
+void _lv_obj_style_free_resolved_cache(lv_obj_t * obj)
+{
+    lv_obj_style_resolved_t * res = obj->style_resolved;
+    while(res) {
+        lv_obj_style_resolved_t * next = res->next;
+        lv_free(res);
+        LV_GLOBAL_DEFAULT()->style_resolved_entry_cnt--;
+        res = next;
     }
+    obj->style_resolved = NULL;
+}
 
-    return lv_style_prop_get_default_inlined(prop);
+void _lv_obj_style_invalidate_resolved_cache(void)
+{
+    /*Just start a new generation instead of clearing the entries of all objects*/
+    LV_GLOBAL_DEFAULT()->style_resolved_generation++;
 }
 
+#endif /*LV_OBJ_STYLE_RESOLVED_CACHE*/
+
 void lv_obj_set_local_style_prop(lv_obj_t * obj, lv_style_prop_t prop, lv_style_value_t value,
                                  lv_style_selector_t selector)
 {
@@ -538,6 +595,7 @@ void _lv_obj_style_create_transition(lv_obj_t * obj, lv_part_t part, lv_state_t
 
     _lv_obj_style_t * style_trans = get_trans_style(obj, part);
     lv_style_set_prop((lv_style_t *)style_trans->style, tr_dsc->prop, v1);  /*Be sure `trans_style` has a valid value*/
+    resolved_cache_invalidate();
 
     if(tr_dsc->prop == LV_STYLE_RADIUS) {
         if(v1.num == LV_RADIUS_CIRCLE || v2.num == LV_RADIUS_CIRCLE) {
@@ -786,6 +844,74 @@ static _lv_obj_style_t * get_trans_style(lv_obj_t * obj,  lv_style_selector_t se
     return &obj->styles[0];
 }
 
+static lv_style_value_t get_prop_resolve(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop)
+{
+    lv_style_value_t value_act = { .ptr = NULL };
+    lv_style_res_t found;
+
+    /*The happy path*/
+#if LV_OBJ_STYLE_CACHE
+    const uint32_t prop_shifted = STYLE_PROP_SHIFTED(prop);
+    if((part == LV_PART_MAIN ? obj->style_main_prop_is_set : obj->style_other_prop_is_set) & prop_shifted)
+#endif
+    {
+        found = get_prop_core(obj, part, prop, &value_act);
+        if(found == LV_STYLE_RES_FOUND) return value_act;
+    }
+
+    extern const uint8_t _lv_style_builtin_prop_flag_lookup_table[];
+    bool inheritable = false;
+    if(prop < _LV_STYLE_NUM_BUILT_IN_PROPS) {
+        inheritable = _lv_style_builtin_prop_flag_lookup_table[prop] & LV_STYLE_PROP_FLAG_INHERITABLE;
+    }
+    else {
+        if(_style_custom_prop_flag_lookup_table != NULL) {
+            inheritable = _style_custom_prop_flag_lookup_table[prop - _LV_STYLE_NUM_BUILT_IN_PROPS] &
+                          LV_STYLE_PROP_FLAG_INHERITABLE;
+        }
+    }
+
+    if(inheritable) {
+        /*If not found, check the `MAIN` style first, if already on the MAIN part go to the parent*/
+        if(part != LV_PART_MAIN) part = LV_PART_MAIN;
+        else obj = obj->parent;
+
+        while(obj) {
+#if LV_OBJ_STYLE_CACHE
+            if(obj->style_main_prop_is_set & prop_shifted)
+#endif
+            {
+                found = get_prop_core(obj, part, prop, &value_act);
+                if(found == LV_STYLE_RES_FOUND) return value_act;
+            }
+            /*Check the parent too.*/
+            obj = obj->parent;
+        }
+    }
+    else {
+        /*Get the width and height from the class.
+         * WIDTH and HEIGHT are not inherited so add them in the `else` to skip checking them for inherited properties */
+        if(part == LV_PART_MAIN && (prop == LV_STYLE_WIDTH || prop == LV_STYLE_HEIGHT)) {
+            const lv_obj_class_t * cls = obj->class_p;
+            while(cls) {
+                if(prop == LV_STYLE_WIDTH) {
+                    if(cls->width_def != 0) return (lv_style_value_t) {
+                        .num = cls->width_def
+                    };
+                }
+                else {
+                    if(cls->height_def != 0) return (lv_style_value_t) {
+                        .num = cls->height_def
+                    };
+                }
+                cls = cls->base_class;
+            }
+        }
+    }
+
+    return lv_style_prop_get_default_inlined(prop);
+}
+
 static lv_style_res_t get_prop_core(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, lv_style_value_t * v)
 {
 
@@ -919,6 +1045,8 @@ static bool trans_delete(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, t
         }
         tr = tr_prev;
     }
+
+    if(removed) resolved_cache_invalidate();
     return removed;
 }
 
@@ -1005,6 +1133,7 @@ static void trans_anim_start_cb(lv_anim_t * a)
     _lv_obj_style_t * style_trans = get_trans_style(tr->obj, tr->selector);
     lv_style_set_prop((lv_style_t *)style_trans->style, tr->prop,
                       tr->start_value);  /*Be sure `trans_style` has a valid value*/
+    resolved_cache_invalidate();
 
 }
 
@@ -1035,6 +1164,7 @@ static void trans_anim_ready_cb(lv_anim_t * a)
 
                 _lv_obj_style_t * obj_style = &obj->styles[i];
                 lv_style_remove_prop((lv_style_t *)obj_style->style, prop);
+                resolved_cache_invalidate();
 
                 if(lv_style_is_empty(obj->styles[i].style)) {
                     lv_obj_remove_style(obj, (lv_style_t *)obj_style->style, obj_style->selector);
@@ -55,6 +55,20 @@ typedef struct {
     uint32_t is_trans : 1;
 } _lv_obj_style_t;
 
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+/**
+ * Memory cost and efficiency of the resolved style cache
+ */
+typedef struct {
+    uint32_t entry_cnt;     /**< Number of object parts having resolved values*/
+    uint32_t entry_size;    /**< Size of an entry in bytes*/
+    uint32_t mem_size;      /**< Memory used by all entries in bytes*/
+    uint32_t prop_cnt;      /**< Number of properties which are cached per object part*/
+    uint32_t hit_cnt;       /**< Number of properties read from the cache*/
+    uint32_t miss_cnt;      /**< Number of cached properties which had to be resolved*/
+} lv_obj_style_resolved_cache_info_t;
+#endif
+
 typedef struct {
     uint16_t time;
     uint16_t delay;
@@ -155,6 +169,29 @@ void lv_obj_enable_style_refresh(bool en);
  */
 lv_style_value_t lv_obj_get_style_prop(const struct _lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop);
 
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+
+/**
+ * Get the memory usage and the hit rate of the resolved style cache.
+ * @param info      store the result here
+ */
+void lv_obj_style_get_resolved_cache_info(lv_obj_style_resolved_cache_info_t * info);
+
+/**
+ * Free the resolved style values of an object (not its children) to save memory.
+ * They will be resolved and cached again when read.
+ * @param obj       pointer to an object
+ */
+void _lv_obj_style_free_resolved_cache(struct _lv_obj_t * obj);
+
+/**
+ * Mark the resolved style values of all objects as outdated.
+ * Called when styles, states or parents change.
+ */
+void _lv_obj_style_invalidate_resolved_cache(void);
+
+#endif /*LV_OBJ_STYLE_RESOLVED_CACHE*/
+
 /**
  * Set local style property on an object's part and state.
  * @param obj       pointer to an object
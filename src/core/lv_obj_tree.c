@@ -184,6 +184,11 @@ void lv_obj_set_parent(lv_obj_t * obj, lv_obj_t * parent)
 
     obj->parent = parent;
 
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+    /*The inherited properties come from the new parent*/
+    _lv_obj_style_invalidate_resolved_cache();
+#endif
+
     /*Notify the original parent because one of its children is lost*/
     lv_obj_scrollbar_invalidate(old_parent);
     lv_obj_send_event(old_parent, LV_EVENT_CHILD_CHANGED, obj);
@@ -26,14 +26,25 @@
 /*Display being refreshed*/
 #define disp_refr LV_GLOBAL_DEFAULT()->disp_refresh
 
+/*Max. number of opaque areas tracked by the occlusion culling*/
+#define OCCLUDER_MAX    8
+
 /**********************
  *      TYPEDEFS
  **********************/
+#if LV_OBJ_OCCLUSION_CULLING
+typedef struct {
+    lv_area_t areas[OCCLUDER_MAX];  /*Opaque areas of the objects drawn later*/
+    uint32_t cnt;
+} occluders_t;
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static void lv_refr_join_area(void);
+static void refr_split_overlapping_areas(void);
+static int32_t area_subtract(lv_area_t res[], const lv_area_t * a, const lv_area_t * b);
 static void refr_invalid_areas(void);
 static void refr_sync_areas(void);
 static void refr_area(const lv_area_t * area_p);
@@ -41,10 +52,16 @@ static void refr_area_part(lv_layer_t * layer);
 static lv_obj_t * lv_refr_get_top_obj(const lv_area_t * area_p, lv_obj_t * obj);
 static void refr_obj_and_children(lv_layer_t * layer, lv_obj_t * top_obj);
 static void refr_obj(lv_layer_t * layer, lv_obj_t * obj);
+#if LV_OBJ_OCCLUSION_CULLING
+    static void occlusion_mark(lv_obj_t * top_obj, const lv_area_t * clip_area);
+    static void occlusion_check_obj(occluders_t * occluders, lv_obj_t * obj, const lv_area_t * clip_area, bool last);
+    static void occlusion_clear(void);
+#endif
 static uint32_t get_max_row(lv_display_t * disp, int32_t area_w, int32_t area_h);
 static void draw_buf_flush(lv_display_t * disp);
 static void call_flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
 static void wait_for_flushing(lv_display_t * disp);
+static void wait_for_flush_slots(lv_display_t * disp, uint32_t max_pending);
 
 /**********************
  *  STATIC VARIABLES
@@ -106,9 +123,13 @@ void lv_obj_redraw(lv_layer_t * layer, lv_obj_t * obj)
     /*If the object is visible on the current clip area*/
     layer->_clip_area = clip_coords_for_obj;
 
+#if LV_OBJ_DRAW_CACHE
+    _lv_obj_draw_main_cached(obj, layer);
+#else
     lv_obj_send_event(obj, LV_EVENT_DRAW_MAIN_BEGIN, layer);
     lv_obj_send_event(obj, LV_EVENT_DRAW_MAIN, layer);
     lv_obj_send_event(obj, LV_EVENT_DRAW_MAIN_END, layer);
+#endif
 #if LV_USE_REFR_DEBUG
     lv_color_t debug_color = lv_color_make(lv_rand(0, 0xFF), lv_rand(0, 0xFF), lv_rand(0, 0xFF));
     lv_draw_rect_dsc_t draw_dsc;
@@ -286,19 +307,42 @@ void _lv_inv_area(lv_display_t * disp, const lv_area_t * area_p)
     if(res != LV_RESULT_OK) return;
 
     /*Save only if this area is not in one of the saved areas*/
-    uint16_t i;
+    uint32_t i;
     for(i = 0; i < disp->inv_p; i++) {
         if(_lv_area_is_in(&com_area, &disp->inv_areas[i], 0) != false) return;
     }
 
-    /*Save the area*/
-    lv_area_t * tmp_area_p = &com_area;
-    if(disp->inv_p >= LV_INV_BUF_SIZE) { /*If no place for the area add the screen*/
-        disp->inv_p = 0;
-        tmp_area_p = &scr_area;
+    /*Remove the saved areas which are in the new area*/
+    i = 0;
+    while(i < disp->inv_p) {
+        if(_lv_area_is_in(&disp->inv_areas[i], &com_area, 0)) {
+            disp->inv_p--;
+            disp->inv_areas[i] = disp->inv_areas[disp->inv_p];
+        }
+        else {
+            i++;
+        }
+    }
+
+    /*If there is no place for the area join it into the saved area which grows the least*/
+    if(disp->inv_p >= LV_INV_BUF_SIZE) {
+        uint32_t best_i = 0;
+        uint32_t best_growth = UINT32_MAX;
+        for(i = 0; i < disp->inv_p; i++) {
+            lv_area_t joined_area;
+            _lv_area_join(&joined_area, &disp->inv_areas[i], &com_area);
+            uint32_t growth = lv_area_get_size(&joined_area) - lv_area_get_size(&disp->inv_areas[i]);
+            if(growth < best_growth) {
+                best_growth = growth;
+                best_i = i;
+            }
+        }
+        _lv_area_join(&disp->inv_areas[best_i], &disp->inv_areas[best_i], &com_area);
+    }
+    else {
+        lv_area_copy(&disp->inv_areas[disp->inv_p], &com_area);
+        disp->inv_p++;
     }
-    lv_area_copy(&disp->inv_areas[disp->inv_p], tmp_area_p);
-    disp->inv_p++;
 
     lv_display_send_event(disp, LV_EVENT_REFR_REQUEST, NULL);
 }
@@ -355,6 +399,9 @@ void _lv_display_refr_timer(lv_timer_t * tmr)
     }
 
     lv_display_send_event(disp_refr, LV_EVENT_REFR_START, NULL);
+#if LV_USE_REFR_STATS
+    _lv_refr_stats_frame_start(disp_refr);
+#endif
 
     /*Refresh the screen's layout if required*/
     LV_PROFILER_BEGIN_TAG("layout");
@@ -410,6 +457,14 @@ refr_finish:
     _lv_draw_sw_mask_cleanup();
 #endif
 
+#if LV_USE_REFR_STATS
+    _lv_refr_stats_frame_end(disp_refr);
+#endif
+
+#if LV_USE_DRAW_ARENA
+    _lv_draw_arena_frame_end();
+#endif
+
     lv_display_send_event(disp_refr, LV_EVENT_REFR_READY, NULL);
 
     LV_TRACE_REFR("finished");
@@ -421,7 +476,9 @@ refr_finish:
  **********************/
 
 /**
- * Join the areas which has got common parts
+ * Join the areas if refreshing the joined area is cheaper than refreshing them one by one,
+ * and remove the overlapping parts of the remaining areas.
+ * The cost of an area is its size plus `LV_INV_AREA_OVERHEAD`.
  */
 static void lv_refr_join_area(void)
 {
@@ -429,34 +486,119 @@ static void lv_refr_join_area(void)
     uint32_t join_from;
     uint32_t join_in;
     lv_area_t joined_area;
-    for(join_in = 0; join_in < disp_refr->inv_p; join_in++) {
-        if(disp_refr->inv_area_joined[join_in] != 0) continue;
+    bool joined;
 
-        /*Check all areas to join them in 'join_in'*/
-        for(join_from = 0; join_from < disp_refr->inv_p; join_from++) {
-            /*Handle only unjoined areas and ignore itself*/
-            if(disp_refr->inv_area_joined[join_from] != 0 || join_in == join_from) {
-                continue;
+    /*A joined area might be worth joining with an area checked earlier, so repeat until nothing changes*/
+    do {
+        joined = false;
+        for(join_in = 0; join_in < disp_refr->inv_p; join_in++) {
+            if(disp_refr->inv_area_joined[join_in] != 0) continue;
+
+            /*Check all areas to join them in 'join_in'*/
+            for(join_from = join_in + 1; join_from < disp_refr->inv_p; join_from++) {
+                /*Handle only unjoined areas*/
+                if(disp_refr->inv_area_joined[join_from] != 0) continue;
+
+                _lv_area_join(&joined_area, &disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]);
+
+                /*Join two areas only if the joined area is cheaper to refresh*/
+                if(lv_area_get_size(&joined_area) < (lv_area_get_size(&disp_refr->inv_areas[join_in]) +
+                                                     lv_area_get_size(&disp_refr->inv_areas[join_from]) +
+                                                     LV_INV_AREA_OVERHEAD)) {
+                    lv_area_copy(&disp_refr->inv_areas[join_in], &joined_area);
+
+                    /*Mark 'join_form' is joined into 'join_in'*/
+                    disp_refr->inv_area_joined[join_from] = 1;
+                    joined = true;
+                }
             }
+        }
+    } while(joined);
+
+    refr_split_overlapping_areas();
+
+    LV_PROFILER_END;
+}
 
-            /*Check if the areas are on each other*/
-            if(_lv_area_is_on(&disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]) == false) {
+/**
+ * Remove the common parts of the overlapping areas which were not worth joining
+ * so that their pixels are not redrawn. An area is split only if redrawing the common part costs more
+ * than refreshing the new areas, and there is free space for them in `inv_areas`.
+ */
+static void refr_split_overlapping_areas(void)
+{
+    uint32_t i;
+    uint32_t j;
+    lv_area_t res[4];
+    for(i = 0; i < disp_refr->inv_p; i++) {
+        if(disp_refr->inv_area_joined[i] != 0) continue;
+
+        /*The new parts are added to the end so they are checked with the next areas too*/
+        for(j = i + 1; j < disp_refr->inv_p; j++) {
+            if(disp_refr->inv_area_joined[j] != 0) continue;
+
+            lv_area_t common;
+            if(!_lv_area_intersect(&common, &disp_refr->inv_areas[i], &disp_refr->inv_areas[j])) continue;
+
+            int32_t res_cnt = area_subtract(res, &disp_refr->inv_areas[j], &disp_refr->inv_areas[i]);
+            if(res_cnt == 0) {
+                disp_refr->inv_area_joined[j] = 1;
                 continue;
             }
 
-            _lv_area_join(&joined_area, &disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]);
-
-            /*Join two area only if the joined area size is smaller*/
-            if(lv_area_get_size(&joined_area) < (lv_area_get_size(&disp_refr->inv_areas[join_in]) +
-                                                 lv_area_get_size(&disp_refr->inv_areas[join_from]))) {
-                lv_area_copy(&disp_refr->inv_areas[join_in], &joined_area);
+            if(disp_refr->inv_p + res_cnt - 1 > LV_INV_BUF_SIZE) continue;
+            if(lv_area_get_size(&common) <= (uint32_t)(res_cnt - 1) * LV_INV_AREA_OVERHEAD) continue;
 
-                /*Mark 'join_form' is joined into 'join_in'*/
-                disp_refr->inv_area_joined[join_from] = 1;
+            disp_refr->inv_areas[j] = res[0];
+            int32_t k;
+            for(k = 1; k < res_cnt; k++) {
+                disp_refr->inv_areas[disp_refr->inv_p] = res[k];
+                disp_refr->inv_area_joined[disp_refr->inv_p] = 0;
+                disp_refr->inv_p++;
             }
         }
     }
-    LV_PROFILER_END;
+}
+
+/**
+ * Get the parts of an area which are not covered by an other area.
+ * Unlike `_lv_area_diff()` the results don't overlap each other or `b`.
+ * @param res       array for 4 areas to store the result
+ * @param a         the area to subtract from
+ * @param b         the area to subtract
+ * @return          the number of areas in `res`
+ */
+static int32_t area_subtract(lv_area_t res[], const lv_area_t * a, const lv_area_t * b)
+{
+    lv_area_t common;
+    if(!_lv_area_intersect(&common, a, b)) {
+        res[0] = *a;
+        return 1;
+    }
+
+    int32_t cnt = 0;
+
+    /*Full width areas above and below the common part*/
+    if(a->y1 < common.y1) {
+        lv_area_set(&res[cnt], a->x1, a->y1, a->x2, common.y1 - 1);
+        cnt++;
+    }
+    if(a->y2 > common.y2) {
+        lv_area_set(&res[cnt], a->x1, common.y2 + 1, a->x2, a->y2);
+        cnt++;
+    }
+
+    /*Areas on the left and right of the common part*/
+    if(a->x1 < common.x1) {
+        lv_area_set(&res[cnt], a->x1, common.y1, common.x1 - 1, common.y2);
+        cnt++;
+    }
+    if(a->x2 > common.x2) {
+        lv_area_set(&res[cnt], common.x2 + 1, common.y1, a->x2, common.y2);
+        cnt++;
+    }
+
+    return cnt;
 }
 
 /**
@@ -570,6 +712,9 @@ static void refr_invalid_areas(void)
             if(i == last_i) disp_refr->last_area = 1;
             disp_refr->last_part = 0;
             refr_area(&disp_refr->inv_areas[i]);
+#if LV_USE_REFR_STATS
+            disp_refr->refr_stats_act.inv_area_cnt++;
+#endif
         }
     }
 
@@ -661,12 +806,19 @@ static void refr_area_part(lv_layer_t * layer)
 {
     LV_PROFILER_BEGIN;
     disp_refr->refreshed_area = layer->_clip_area;
+#if LV_USE_REFR_STATS
+    disp_refr->refr_stats_act.px_rendered += lv_area_get_size(&layer->_clip_area);
+#endif
 
     /* In single buffered mode wait here until the buffer is freed.
      * Else we would draw into the buffer while it's still being transferred to the display*/
     if(!lv_display_is_double_buffered(disp_refr)) {
         wait_for_flushing(disp_refr);
     }
+    /* In pipelined mode the next buffer of the ring might be still in the flush queue*/
+    else if(disp_refr->buf_ring) {
+        wait_for_flush_slots(disp_refr, disp_refr->buf_ring_cnt - 1);
+    }
     /*If the screen is transparent initialize it when the flushing is ready*/
     if(lv_color_format_has_alpha(disp_refr->color_format)) {
         uint32_t w = lv_area_get_width(&layer->buf_area);
@@ -688,6 +840,14 @@ static void refr_area_part(lv_layer_t * layer)
         refr_obj_and_children(layer, lv_display_get_layer_bottom(disp_refr));
     }
 
+#if LV_OBJ_OCCLUSION_CULLING
+    /*Find the objects hidden by opaque objects drawn later. During screen animations
+     *there are two screens, keep it simple and draw everything in this case.*/
+    if(disp_refr->prev_scr == NULL) {
+        occlusion_mark(top_act_scr ? top_act_scr : disp_refr->act_scr, &layer->_clip_area);
+    }
+#endif
+
     if(disp_refr->draw_prev_over_act) {
         if(top_act_scr == NULL) top_act_scr = disp_refr->act_scr;
         refr_obj_and_children(layer, top_act_scr);
@@ -713,6 +873,10 @@ static void refr_area_part(lv_layer_t * layer)
     refr_obj_and_children(layer, lv_display_get_layer_top(disp_refr));
     refr_obj_and_children(layer, lv_display_get_layer_sys(disp_refr));
 
+#if LV_OBJ_OCCLUSION_CULLING
+    occlusion_clear();
+#endif
+
     draw_buf_flush(disp_refr);
     LV_PROFILER_END;
 }
@@ -873,6 +1037,9 @@ static bool alpha_test_area_on_obj(lv_obj_t * obj, const lv_area_t * area)
 void refr_obj(lv_layer_t * layer, lv_obj_t * obj)
 {
     if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return;
+#if LV_OBJ_OCCLUSION_CULLING
+    if(obj->occluded) return;
+#endif
 
     lv_layer_type_t layer_type = _lv_obj_get_layer_type(obj);
     if(layer_type == LV_LAYER_TYPE_NONE) {
@@ -997,10 +1164,13 @@ static void draw_buf_flush(lv_display_t * disp)
      * and driver is ready to receive the new buffer.
      * If we need to wait here it means that the content of one buffer is being sent to display
      * and other buffer already contains the new rendered image. */
-    if(lv_display_is_double_buffered(disp)) {
+    if(lv_display_is_double_buffered(disp) && disp->buf_ring == NULL) {
         wait_for_flushing(disp_refr);
     }
 
+    /*Count the new flush first. If an earlier flush finishes in the meantime
+     *`lv_display_flush_ready()` shouldn't find all flushes ready and clear `flushing`*/
+    disp->flush_start_cnt++;
     disp->flushing = 1;
 
     if(disp->last_area && disp->last_part) disp->flushing_last = 1;
@@ -1011,8 +1181,12 @@ static void draw_buf_flush(lv_display_t * disp)
     if(disp->flush_cb) {
         call_flush_cb(disp, &disp->refreshed_area, layer->buf);
     }
+    /*In pipelined mode continue with the next buffer of the ring*/
+    if(disp->buf_ring) {
+        disp->buf_act = disp->buf_ring[disp->flush_start_cnt % disp->buf_ring_cnt];
+    }
     /*If there are 2 buffers swap them. With direct mode swap only on the last area*/
-    if(lv_display_is_double_buffered(disp) && (disp->render_mode != LV_DISPLAY_RENDER_MODE_DIRECT || flushing_last)) {
+    else if(lv_display_is_double_buffered(disp) && (disp->render_mode != LV_DISPLAY_RENDER_MODE_DIRECT || flushing_last)) {
         if(disp->buf_act == disp->buf_1) {
             disp->buf_act = disp->buf_2;
         }
@@ -1037,6 +1211,11 @@ static void call_flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t *
 
     //    if(disp->layer_head->buffer_convert) disp->layer_head->buffer_convert(disp->layer_head);
 
+#if LV_USE_REFR_STATS
+    disp->refr_stats_act.px_flushed += lv_area_get_size(area);
+    disp->refr_stats_act.flush_cnt++;
+#endif
+
     lv_display_send_event(disp, LV_EVENT_FLUSH_START, &offset_area);
     disp->flush_cb(disp, &offset_area, px_map);
     lv_display_send_event(disp, LV_EVENT_FLUSH_FINISH, &offset_area);
@@ -1046,16 +1225,212 @@ static void call_flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t *
 
 static void wait_for_flushing(lv_display_t * disp)
 {
+    if(disp->buf_ring) {
+        wait_for_flush_slots(disp, 0);
+        return;
+    }
+
     LV_PROFILER_BEGIN;
     LV_LOG_TRACE("begin");
+#if LV_USE_REFR_STATS
+    uint32_t start_tick = _lv_refr_stats_tick_get();
+#endif
 
     if(disp->flush_wait_cb) {
         disp->flush_wait_cb(disp);
     }
     else {
-        while(disp->flushing);
+        while(disp->flushing) {
+#if LV_USE_OS
+            lv_thread_sync_wait(&disp->flush_sync);
+#endif
+        }
     }
 
+#if LV_USE_REFR_STATS
+    _lv_refr_stats_add_flush_wait(disp, start_tick);
+#endif
     LV_LOG_TRACE("end");
     LV_PROFILER_END;
 }
+
+/**
+ * Wait until at most `max_pending` buffers are being flushed in pipelined mode
+ * @param disp          pointer to a display with a buffer ring
+ * @param max_pending   the number of flushes which can remain in progress
+ */
+static void wait_for_flush_slots(lv_display_t * disp, uint32_t max_pending)
+{
+    if(disp->flush_start_cnt - disp->flush_ready_cnt <= max_pending) return;
+
+    LV_PROFILER_BEGIN;
+    LV_LOG_TRACE("begin");
+#if LV_USE_REFR_STATS
+    uint32_t start_tick = _lv_refr_stats_tick_get();
+#endif
+
+    /*`lv_display_flush_ready()` is called once per buffer so wait for the required number of calls*/
+    while(disp->flush_start_cnt - disp->flush_ready_cnt > max_pending) {
+        if(disp->flush_wait_cb) {
+            disp->flush_wait_cb(disp);
+        }
+        else {
+#if LV_USE_OS
+            lv_thread_sync_wait(&disp->flush_sync);
+#endif
+        }
+    }
+
+#if LV_USE_REFR_STATS
+    _lv_refr_stats_add_flush_wait(disp, start_tick);
+#endif
+    LV_LOG_TRACE("end");
+    LV_PROFILER_END;
+}
+
+#if LV_OBJ_OCCLUSION_CULLING
+
+/**
+ * Mark the objects which are drawn from `top_obj` in `refr_area_part()` but fully covered
+ * by opaque objects drawn later. `refr_obj()` will skip them.
+ * @param top_obj       the object from which the drawing starts
+ * @param clip_area     the area being refreshed
+ */
+static void occlusion_mark(lv_obj_t * top_obj, const lv_area_t * clip_area)
+{
+    if(top_obj == NULL) return;
+
+    LV_PROFILER_BEGIN;
+    occluders_t occluders;
+    occluders.cnt = 0;
+
+    /*Visit the objects in reverse drawing order so the opaque areas are known before checking
+     *the objects below them. The sys and top layers are drawn last.*/
+    occlusion_check_obj(&occluders, lv_display_get_layer_sys(disp_refr), clip_area, false);
+    occlusion_check_obj(&occluders, lv_display_get_layer_top(disp_refr), clip_area, false);
+
+    /*The younger siblings of the parents of `top_obj` are drawn after `top_obj`.
+     *The siblings of the outer parents are drawn later.*/
+    lv_obj_t * border = top_obj;
+    lv_obj_t * parent = lv_obj_get_parent(border);
+    while(parent) {
+        int32_t i;
+        int32_t child_cnt = lv_obj_get_child_count(parent);
+        for(i = child_cnt - 1; i >= 0; i--) {
+            lv_obj_t * child = parent->spec_attr->children[i];
+            if(child == border) break;
+            occlusion_check_obj(&occluders, child, clip_area, false);
+        }
+        border = parent;
+        parent = lv_obj_get_parent(parent);
+    }
+
+    /*Only its parents are checked after `top_obj` and they can't be hidden by their children*/
+    occlusion_check_obj(&occluders, top_obj, clip_area, true);
+    LV_PROFILER_END;
+}
+
+/**
+ * Mark an object if it's fully covered by the opaque areas, else check its children
+ * and add the object to the opaque areas if it covers the clip area.
+ * @param occluders     opaque areas of the objects drawn after `obj`
+ * @param obj           the object to check
+ * @param clip_area     the object is drawn only on this area
+ * @param last          true: no object checked after `obj` can be hidden by it, so don't check if it covers
+ */
+static void occlusion_check_obj(occluders_t * occluders, lv_obj_t * obj, const lv_area_t * clip_area, bool last)
+{
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return;
+
+    /*The area of the transformed objects is not known here*/
+    lv_layer_type_t layer_type = _lv_obj_get_layer_type(obj);
+    if(layer_type == LV_LAYER_TYPE_TRANSFORM) return;
+
+    lv_area_t obj_coords_ext;
+    lv_obj_get_coords(obj, &obj_coords_ext);
+    int32_t ext_draw_size = _lv_obj_get_ext_draw_size(obj);
+    lv_area_increase(&obj_coords_ext, ext_draw_size, ext_draw_size);
+
+    lv_area_t clip_coords_for_obj;
+    if(!_lv_area_intersect(&clip_coords_for_obj, clip_area, &obj_coords_ext)) return;
+
+    uint32_t i;
+    for(i = 0; i < occluders->cnt; i++) {
+        if(_lv_area_is_in(&clip_coords_for_obj, &occluders->areas[i], 0)) {
+            obj->occluded = 1;
+            if(!lv_array_append(&disp_refr->occluded_objs, (uint8_t *)&obj)) {
+                lv_array_resize(&disp_refr->occluded_objs, lv_array_capacity(&disp_refr->occluded_objs) * 2);
+                lv_array_append(&disp_refr->occluded_objs, (uint8_t *)&obj);
+            }
+#if LV_USE_REFR_STATS
+            disp_refr->refr_stats_act.px_occluded += lv_area_get_size(&clip_coords_for_obj);
+#endif
+            return;
+        }
+    }
+
+    /*The children of layers are drawn to an other buffer*/
+    if(layer_type != LV_LAYER_TYPE_NONE) return;
+
+    /*The children are drawn on the object so check them first.
+     *Rounded clipping draws them to a layer, don't check them in this case.*/
+    bool clip_corner = lv_obj_get_style_clip_corner(obj, LV_PART_MAIN) &&
+                       lv_obj_get_style_radius(obj, LV_PART_MAIN) != 0;
+    int32_t child_cnt = lv_obj_get_child_count(obj);
+    lv_area_t clip_coords_for_children;
+    const lv_area_t * obj_coords = lv_obj_has_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE) ? &obj_coords_ext : &obj->coords;
+    if(!clip_corner && child_cnt > 0 && _lv_area_intersect(&clip_coords_for_children, clip_area, obj_coords)) {
+        int32_t c;
+        for(c = child_cnt - 1; c >= 0; c--) {
+            /*The first child is followed only by `obj` which is not hidden by its children*/
+            occlusion_check_obj(occluders, obj->spec_attr->children[c], &clip_coords_for_children, last && c == 0);
+        }
+    }
+
+    /*Check if the object hides the objects drawn earlier*/
+    if(last) return;
+    lv_area_t cover_area;
+    if(!_lv_area_intersect(&cover_area, clip_area, &obj->coords)) return;
+
+    /*Checking the cover is expensive, do it only if the area would be stored*/
+    uint32_t min_i = 0;
+    if(occluders->cnt == OCCLUDER_MAX) {
+        for(i = 1; i < OCCLUDER_MAX; i++) {
+            if(lv_area_get_size(&occluders->areas[i]) < lv_area_get_size(&occluders->areas[min_i])) min_i = i;
+        }
+        if(lv_area_get_size(&cover_area) <= lv_area_get_size(&occluders->areas[min_i])) return;
+    }
+
+    lv_cover_check_info_t info;
+    info.res = LV_COVER_RES_COVER;
+    info.area = &cover_area;
+    lv_obj_send_event(obj, LV_EVENT_COVER_CHECK, &info);
+    if(info.res != LV_COVER_RES_COVER) return;
+    /*The opacity of the parents is applied too*/
+    if(lv_obj_get_style_opa_recursive(obj, LV_PART_MAIN) < LV_OPA_MAX) return;
+
+    if(occluders->cnt < OCCLUDER_MAX) {
+        occluders->areas[occluders->cnt] = cover_area;
+        occluders->cnt++;
+    }
+    else {
+        /*No more space, replace the smallest area*/
+        occluders->areas[min_i] = cover_area;
+    }
+}
+
+/**
+ * Clear the marks set by `occlusion_mark()`
+ */
+static void occlusion_clear(void)
+{
+    lv_array_t * objs = &disp_refr->occluded_objs;
+    uint32_t i;
+    for(i = 0; i < lv_array_length(objs); i++) {
+        lv_obj_t * obj = *(lv_obj_t **)lv_array_get(objs, i);
+        obj->occluded = 0;
+    }
+    lv_array_clear(objs);
+}
+
+#endif /*LV_OBJ_OCCLUSION_CULLING*/
@@ -0,0 +1,244 @@
+/**
+ * @file lv_refr_stats.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_refr_stats.h"
+#if LV_USE_REFR_STATS
+
+#include "lv_global.h"
+#include "../display/lv_display_private.h"
+#include "../misc/lv_cache.h"
+#include "../font/lv_font_fmt_txt.h"
+#include "../stdlib/lv_sprintf.h"
+#include "../stdlib/lv_string.h"
+#include "../tick/lv_tick.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define _tick_get_cb    LV_GLOBAL_DEFAULT()->refr_stats_tick_get_cb
+#define _tick_per_sec   LV_GLOBAL_DEFAULT()->refr_stats_tick_per_sec
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    char * buf;
+    uint32_t buf_size;
+    uint32_t len;
+} print_ctx_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static uint32_t ticks_to_us(uint32_t ticks);
+static void print(print_ctx_t * ctx, const char * format, ...);
+static void print_array(print_ctx_t * ctx, const char * name, const uint32_t * values, uint32_t cnt);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+static const char * const task_type_names[LV_REFR_STATS_TASK_TYPE_CNT] = {
+    "fill", "border", "box_shadow", "label", "image", "layer", "line", "arc", "triangle",
+    "mask_rectangle", "mask_bitmap", "vector"
+};
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+const lv_refr_stats_t * lv_refr_stats_get(lv_display_t * disp)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return NULL;
+
+    return &disp->refr_stats;
+}
+
+void lv_refr_stats_set_tick_cb(uint32_t (*tick_get_cb)(void), uint32_t tick_per_sec)
+{
+    _tick_get_cb = tick_get_cb;
+    _tick_per_sec = tick_get_cb ? tick_per_sec : 0;
+}
+
+uint32_t lv_refr_stats_to_json(const lv_refr_stats_t * stats, char * buf, uint32_t buf_size)
+{
+    print_ctx_t ctx = {buf, buf_size, 0};
+    uint32_t i;
+
+    print(&ctx, "{\"frame_id\":%" LV_PRIu32 ",\"inv_area_cnt\":%" LV_PRIu32
+          ",\"px_rendered\":%" LV_PRIu32 ",\"px_occluded\":%" LV_PRIu32 ",\"px_flushed\":%" LV_PRIu32
+          ",\"flush_cnt\":%" LV_PRIu32,
+          stats->frame_id, stats->inv_area_cnt, stats->px_rendered, stats->px_occluded, stats->px_flushed, stats->flush_cnt);
+    print(&ctx, ",\"refr_time\":%" LV_PRIu32 ",\"render_time\":%" LV_PRIu32 ",\"flush_wait_time\":%" LV_PRIu32,
+          stats->refr_time, stats->render_time, stats->flush_wait_time);
+
+    print(&ctx, ",\"task_cnt\":{");
+    for(i = 0; i < LV_REFR_STATS_TASK_TYPE_CNT; i++) {
+        print(&ctx, "%s\"%s\":%" LV_PRIu32, i == 0 ? "" : ",", task_type_names[i], stats->task_cnt[i]);
+    }
+    print(&ctx, "}");
+
+    print_array(&ctx, "unit_task_cnt", stats->unit_task_cnt, stats->unit_cnt);
+    print_array(&ctx, "unit_time", stats->unit_time, stats->unit_cnt);
+
+    print(&ctx, ",\"layer_mem_peak_kb\":%" LV_PRIu32 ",\"cache_hit_cnt\":%" LV_PRIu32 ",\"cache_miss_cnt\":%" LV_PRIu32
+          ",\"glyph_cache_hit_cnt\":%" LV_PRIu32 ",\"glyph_cache_miss_cnt\":%" LV_PRIu32 "}",
+          stats->layer_mem_peak_kb, stats->cache_hit_cnt, stats->cache_miss_cnt,
+          stats->glyph_cache_hit_cnt, stats->glyph_cache_miss_cnt);
+
+    return ctx.len;
+}
+
+uint32_t lv_refr_stats_csv_header(char * buf, uint32_t buf_size)
+{
+    print_ctx_t ctx = {buf, buf_size, 0};
+    uint32_t i;
+
+    print(&ctx, "frame_id,inv_area_cnt,px_rendered,px_occluded,px_flushed,flush_cnt,refr_time,render_time,flush_wait_time");
+    for(i = 0; i < LV_REFR_STATS_TASK_TYPE_CNT; i++) {
+        print(&ctx, ",task_cnt_%s", task_type_names[i]);
+    }
+    /*Always print all the units to have the same columns on every line*/
+    for(i = 0; i < LV_REFR_STATS_UNIT_MAX; i++) {
+        print(&ctx, ",unit_task_cnt_%" LV_PRIu32 ",unit_time_%" LV_PRIu32, i, i);
+    }
+    print(&ctx, ",layer_mem_peak_kb,cache_hit_cnt,cache_miss_cnt,glyph_cache_hit_cnt,glyph_cache_miss_cnt");
+
+    return ctx.len;
+}
+
+uint32_t lv_refr_stats_to_csv(const lv_refr_stats_t * stats, char * buf, uint32_t buf_size)
+{
+    print_ctx_t ctx = {buf, buf_size, 0};
+    uint32_t i;
+
+    print(&ctx, "%" LV_PRIu32 ",%" LV_PRIu32 ",%" LV_PRIu32 ",%" LV_PRIu32 ",%" LV_PRIu32 ",%" LV_PRIu32
+          ",%" LV_PRIu32 ",%" LV_PRIu32 ",%" LV_PRIu32,
+          stats->frame_id, stats->inv_area_cnt, stats->px_rendered, stats->px_occluded, stats->px_flushed, stats->flush_cnt,
+          stats->refr_time, stats->render_time, stats->flush_wait_time);
+    for(i = 0; i < LV_REFR_STATS_TASK_TYPE_CNT; i++) {
+        print(&ctx, ",%" LV_PRIu32, stats->task_cnt[i]);
+    }
+    for(i = 0; i < LV_REFR_STATS_UNIT_MAX; i++) {
+        print(&ctx, ",%" LV_PRIu32 ",%" LV_PRIu32, stats->unit_task_cnt[i], stats->unit_time[i]);
+    }
+    print(&ctx, ",%" LV_PRIu32 ",%" LV_PRIu32 ",%" LV_PRIu32 ",%" LV_PRIu32 ",%" LV_PRIu32,
+          stats->layer_mem_peak_kb, stats->cache_hit_cnt, stats->cache_miss_cnt,
+          stats->glyph_cache_hit_cnt, stats->glyph_cache_miss_cnt);
+
+    return ctx.len;
+}
+
+void _lv_refr_stats_frame_start(lv_display_t * disp)
+{
+    lv_refr_stats_t * act = &disp->refr_stats_act;
+    lv_memzero(act, sizeof(lv_refr_stats_t));
+
+    /*Save the current value of the counters and subtract them at the end of the frame*/
+    lv_font_fmt_txt_cache_info_t glyph_info;
+    lv_font_fmt_txt_cache_get_info(&glyph_info);
+    act->glyph_cache_hit_cnt = glyph_info.hit_cnt;
+    act->glyph_cache_miss_cnt = glyph_info.miss_cnt;
+    act->cache_hit_cnt = lv_cache_get_hit_cnt();
+    act->cache_miss_cnt = lv_cache_get_miss_cnt();
+    act->layer_mem_peak_kb = LV_GLOBAL_DEFAULT()->draw_info.used_memory_for_layers_kb;
+
+    disp->refr_stats_start = _lv_refr_stats_tick_get();
+}
+
+void _lv_refr_stats_frame_end(lv_display_t * disp)
+{
+    lv_refr_stats_t * act = &disp->refr_stats_act;
+
+    /*Keep the statistics of the last rendered frame if nothing was redrawn*/
+    if(act->inv_area_cnt == 0) return;
+
+    lv_font_fmt_txt_cache_info_t glyph_info;
+    lv_font_fmt_txt_cache_get_info(&glyph_info);
+    act->glyph_cache_hit_cnt = glyph_info.hit_cnt - act->glyph_cache_hit_cnt;
+    act->glyph_cache_miss_cnt = glyph_info.miss_cnt - act->glyph_cache_miss_cnt;
+    act->cache_hit_cnt = lv_cache_get_hit_cnt() - act->cache_hit_cnt;
+    act->cache_miss_cnt = lv_cache_get_miss_cnt() - act->cache_miss_cnt;
+
+    /*The times were collected in ticks*/
+    uint32_t refr_ticks = _lv_refr_stats_tick_get() - disp->refr_stats_start;
+    act->refr_time = ticks_to_us(refr_ticks);
+    act->render_time = ticks_to_us(refr_ticks - act->flush_wait_time);
+    act->flush_wait_time = ticks_to_us(act->flush_wait_time);
+
+    uint32_t i;
+    for(i = 0; i < act->unit_cnt; i++) {
+        act->unit_time[i] = ticks_to_us(act->unit_time[i]);
+    }
+
+    act->frame_id = disp->refr_stats.frame_id + 1;
+    disp->refr_stats = *act;
+}
+
+uint32_t _lv_refr_stats_tick_get(void)
+{
+    return _tick_get_cb ? _tick_get_cb() : lv_tick_get();
+}
+
+void _lv_refr_stats_add_flush_wait(lv_display_t * disp, uint32_t start_tick)
+{
+    disp->refr_stats_act.flush_wait_time += _lv_refr_stats_tick_get() - start_tick;
+}
+
+void _lv_refr_stats_add_unit_task(lv_display_t * disp, uint32_t unit_idx, uint32_t start_tick)
+{
+    if(unit_idx >= LV_REFR_STATS_UNIT_MAX) return;
+
+    lv_refr_stats_t * act = &disp->refr_stats_act;
+    act->unit_task_cnt[unit_idx]++;
+    act->unit_time[unit_idx] += _lv_refr_stats_tick_get() - start_tick;
+    if(act->unit_cnt <= unit_idx) act->unit_cnt = unit_idx + 1;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static uint32_t ticks_to_us(uint32_t ticks)
+{
+    uint32_t tick_per_sec = _tick_per_sec ? _tick_per_sec : 1000;
+    return (uint32_t)(((uint64_t)ticks * 1000000) / tick_per_sec);
+}
+
+/**
+ * Append to the buffer and count the required length even if it doesn't fit
+ */
+static void print(print_ctx_t * ctx, const char * format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    char * buf = ctx->len < ctx->buf_size ? ctx->buf + ctx->len : NULL;
+    uint32_t size = ctx->len < ctx->buf_size ? ctx->buf_size - ctx->len : 0;
+    int len = lv_vsnprintf(buf, size, format, args);
+    va_end(args);
+
+    if(len > 0) ctx->len += len;
+}
+
+static void print_array(print_ctx_t * ctx, const char * name, const uint32_t * values, uint32_t cnt)
+{
+    uint32_t i;
+    print(ctx, ",\"%s\":[", name);
+    for(i = 0; i < cnt; i++) {
+        print(ctx, "%s%" LV_PRIu32, i == 0 ? "" : ",", values[i]);
+    }
+    print(ctx, "]");
+}
+
+#endif /*LV_USE_REFR_STATS*/
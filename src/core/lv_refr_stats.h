@@ -0,0 +1,132 @@
+/**
+ * @file lv_refr_stats.h
+ *
+ */
+
+#ifndef LV_REFR_STATS_H
+#define LV_REFR_STATS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+#include "../misc/lv_types.h"
+#include "../draw/lv_draw.h"
+#include "../display/lv_display.h"
+
+#if LV_USE_REFR_STATS
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*Number of draw task types which are counted*/
+#define LV_REFR_STATS_TASK_TYPE_CNT (LV_DRAW_TASK_TYPE_VECTOR + 1)
+
+/*The time of the draw units after this many is not measured*/
+#ifndef LV_REFR_STATS_UNIT_MAX
+#define LV_REFR_STATS_UNIT_MAX 8
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Statistics of a rendered frame.
+ * The times are in microseconds, but their resolution depends on the tick set by `lv_refr_stats_set_tick_cb()`.
+ */
+typedef struct {
+    uint32_t frame_id;              /**< Number of rendered frames of the display, including this one*/
+    uint32_t inv_area_cnt;          /**< Number of areas redrawn after joining the invalidated areas*/
+    uint32_t px_rendered;           /**< Number of pixels redrawn*/
+    uint32_t px_occluded;           /**< Number of pixels of the objects not drawn as opaque objects cover them*/
+    uint32_t px_flushed;            /**< Number of pixels passed to `flush_cb`*/
+    uint32_t flush_cnt;             /**< Number of `flush_cb` calls*/
+    uint32_t refr_time;             /**< Time of the whole refresh*/
+    uint32_t render_time;           /**< Time of the refresh without waiting for the flushing*/
+    uint32_t flush_wait_time;       /**< Time spent waiting for the flushing to be ready*/
+    uint32_t task_cnt[LV_REFR_STATS_TASK_TYPE_CNT]; /**< Number of draw tasks indexed by `lv_draw_task_type_t`*/
+    uint32_t unit_cnt;              /**< Number of draw units whose work is measured*/
+    uint32_t unit_task_cnt[LV_REFR_STATS_UNIT_MAX]; /**< Number of draw tasks taken by the draw units*/
+    uint32_t unit_time[LV_REFR_STATS_UNIT_MAX];     /**< Time from taking to finishing the draw tasks per draw unit*/
+    uint32_t layer_mem_peak_kb;     /**< The largest memory used by the layers*/
+    uint32_t cache_hit_cnt;         /**< Number of entries found in the cache (e.g. decoded images)*/
+    uint32_t cache_miss_cnt;        /**< Number of entries not found in the cache*/
+    uint32_t glyph_cache_hit_cnt;   /**< Number of glyphs found in the glyph cache*/
+    uint32_t glyph_cache_miss_cnt;  /**< Number of glyphs not found in the glyph cache*/
+} lv_refr_stats_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Get the statistics of the last frame rendered on a display.
+ * Can be called e.g. in an `LV_EVENT_REFR_READY` event of the display.
+ * @param disp      pointer to a display or NULL to use the default display
+ * @return          pointer to the statistics. All fields are zero before the first rendered frame.
+ */
+const lv_refr_stats_t * lv_refr_stats_get(lv_display_t * disp);
+
+/**
+ * Set a tick source to measure the times with. By default `lv_tick_get()` is used with 1000 ticks per second.
+ * @param tick_get_cb   function returning a free running counter, or NULL to use `lv_tick_get()`
+ * @param tick_per_sec  the number of ticks per second
+ */
+void lv_refr_stats_set_tick_cb(uint32_t (*tick_get_cb)(void), uint32_t tick_per_sec);
+
+/**
+ * Print the statistics as a JSON object into a buffer
+ * @param stats     pointer to statistics
+ * @param buf       buffer to print to
+ * @param buf_size  size of the buffer
+ * @return          the length of the string, or the required length if `buf_size` is too small (like `snprintf`)
+ */
+uint32_t lv_refr_stats_to_json(const lv_refr_stats_t * stats, char * buf, uint32_t buf_size);
+
+/**
+ * Print the header line of the CSV format into a buffer
+ * @param buf       buffer to print to
+ * @param buf_size  size of the buffer
+ * @return          the length of the string, or the required length if `buf_size` is too small (like `snprintf`)
+ */
+uint32_t lv_refr_stats_csv_header(char * buf, uint32_t buf_size);
+
+/**
+ * Print the statistics as a CSV line (without line ending) into a buffer.
+ * The columns are the same as in `lv_refr_stats_csv_header()`.
+ * @param stats     pointer to statistics
+ * @param buf       buffer to print to
+ * @param buf_size  size of the buffer
+ * @return          the length of the string, or the required length if `buf_size` is too small (like `snprintf`)
+ */
+uint32_t lv_refr_stats_to_csv(const lv_refr_stats_t * stats, char * buf, uint32_t buf_size);
+
+/*The functions below are called by the library to collect the statistics*/
+
+void _lv_refr_stats_frame_start(lv_display_t * disp);
+
+void _lv_refr_stats_frame_end(lv_display_t * disp);
+
+uint32_t _lv_refr_stats_tick_get(void);
+
+void _lv_refr_stats_add_flush_wait(lv_display_t * disp, uint32_t start_tick);
+
+void _lv_refr_stats_add_unit_task(lv_display_t * disp, uint32_t unit_idx, uint32_t start_tick);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_REFR_STATS*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_REFR_STATS_H*/
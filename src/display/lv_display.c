@@ -41,6 +41,7 @@ static void set_y_anim(void * obj, int32_t v);
 static void scr_anim_ready(lv_anim_t * a);
 static bool is_out_anim(lv_screen_load_anim_t a);
 static void disp_event_cb(lv_event_t * e);
+static void buf_ring_free(lv_display_t * disp);
 
 /**********************
  *  STATIC VARIABLES
@@ -87,6 +88,9 @@ lv_display_t * lv_display_create(int32_t hor_res, int32_t ver_res)
     disp->inv_en_cnt = 1;
 
     _lv_ll_init(&disp->sync_areas, sizeof(lv_area_t));
+#if LV_OBJ_OCCLUSION_CULLING
+    lv_array_init(&disp->occluded_objs, 8, sizeof(lv_obj_t *));
+#endif
 
     lv_display_t * disp_def_tmp = disp_def;
     disp_def                 = disp; /*Temporarily change the default screen to create the default screens on the
@@ -99,6 +103,10 @@ lv_display_t * lv_display_create(int32_t hor_res, int32_t ver_res)
         return NULL;
     }
 
+#if LV_USE_OS
+    lv_thread_sync_init(&disp->flush_sync);
+#endif
+
 #if LV_USE_THEME_DEFAULT
     if(lv_theme_default_is_inited() == false) {
         disp->theme = lv_theme_default_init(disp, lv_palette_main(LV_PALETTE_BLUE), lv_palette_main(LV_PALETTE_RED),
@@ -189,6 +197,14 @@ void lv_display_delete(lv_display_t * disp)
     if(disp->layer_deinit) disp->layer_deinit(disp, disp->layer_head);
     lv_free(disp->layer_head);
 
+    buf_ring_free(disp);
+#if LV_OBJ_OCCLUSION_CULLING
+    lv_array_destroy(&disp->occluded_objs);
+#endif
+#if LV_USE_OS
+    lv_thread_sync_delete(&disp->flush_sync);
+#endif
+
     lv_free(disp);
 
     if(was_default) lv_display_set_default(_lv_ll_get_head(disp_ll_p));
@@ -392,6 +408,8 @@ void lv_display_set_draw_buffers(lv_display_t * disp, void * buf1, void * buf2,
     if(disp == NULL) disp = lv_display_get_default();
     if(disp == NULL) return;
 
+    buf_ring_free(disp);
+
     disp->buf_1 = buf1;
     disp->buf_2 = buf2;
     disp->buf_act = buf1;
@@ -399,6 +417,32 @@ void lv_display_set_draw_buffers(lv_display_t * disp, void * buf1, void * buf2,
     disp->render_mode = render_mode;
 }
 
+void lv_display_set_draw_buffer_ring(lv_display_t * disp, void * const bufs[], uint32_t buf_cnt,
+                                     uint32_t buf_size_in_bytes)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return;
+
+    LV_ASSERT_NULL(bufs);
+    LV_ASSERT(buf_cnt >= 2);
+
+    buf_ring_free(disp);
+
+    disp->buf_ring = lv_malloc(buf_cnt * sizeof(uint8_t *));
+    LV_ASSERT_MALLOC(disp->buf_ring);
+    if(disp->buf_ring == NULL) return;
+
+    uint32_t i;
+    for(i = 0; i < buf_cnt; i++) disp->buf_ring[i] = bufs[i];
+    disp->buf_ring_cnt = buf_cnt;
+
+    disp->buf_1 = bufs[0];
+    disp->buf_2 = bufs[1];
+    disp->buf_act = bufs[0];
+    disp->buf_size_in_bytes = buf_size_in_bytes;
+    disp->render_mode = LV_DISPLAY_RENDER_MODE_PARTIAL;
+}
+
 void lv_display_set_flush_cb(lv_display_t * disp, lv_display_flush_cb_t flush_cb)
 {
     if(disp == NULL) disp = lv_display_get_default();
@@ -452,8 +496,22 @@ bool lv_display_get_antialiasing(lv_display_t * disp)
 
 LV_ATTRIBUTE_FLUSH_READY void lv_display_flush_ready(lv_display_t * disp)
 {
-    disp->flushing = 0;
-    disp->flushing_last = 0;
+    if(disp->buf_ring) {
+        disp->flush_ready_cnt++;
+        if(disp->flush_ready_cnt == disp->flush_start_cnt) {
+            disp->flushing = 0;
+            disp->flushing_last = 0;
+        }
+    }
+    else {
+        disp->flushing = 0;
+        disp->flushing_last = 0;
+    }
+
+#if LV_USE_OS
+    /*Wake up the rendering if it's waiting for the flush*/
+    if(disp->flush_wait_cb == NULL) lv_thread_sync_signal(&disp->flush_sync);
+#endif
 }
 
 LV_ATTRIBUTE_FLUSH_READY bool lv_display_flush_is_last(lv_display_t * disp)
@@ -466,6 +524,15 @@ bool lv_display_is_double_buffered(lv_display_t * disp)
     return disp->buf_2 != NULL;
 }
 
+uint32_t lv_display_get_flush_pending_count(lv_display_t * disp)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return 0;
+
+    if(disp->buf_ring) return disp->flush_start_cnt - disp->flush_ready_cnt;
+    else return disp->flushing ? 1 : 0;
+}
+
 /*---------------------
   * SCREENS
   *--------------------*/
@@ -986,3 +1053,12 @@ static void disp_event_cb(lv_event_t * e)
             break;
     }
 }
+
+static void buf_ring_free(lv_display_t * disp)
+{
+    if(disp->buf_ring == NULL) return;
+
+    lv_free(disp->buf_ring);
+    disp->buf_ring = NULL;
+    disp->buf_ring_cnt = 0;
+}
@@ -240,6 +240,22 @@ int32_t lv_display_get_dpi(const lv_display_t * disp);
 void lv_display_set_draw_buffers(lv_display_t * disp, void * buf1, void * buf2, uint32_t buf_size_in_bytes,
                                  lv_display_render_mode_t render_mode);
 
+/**
+ * Set a ring of buffers for pipelined partial rendering.
+ * While the driver is sending earlier buffers to the display, LVGL keeps rendering into the next free one.
+ * `flush_cb` is called without waiting for the previous flushes to finish, so the driver should queue
+ * the areas and call `lv_display_flush_ready()` once for every flushed buffer in the order they were received.
+ * LVGL waits only if all buffers are being flushed.
+ * @param disp              pointer to a display
+ * @param bufs              array of `buf_cnt` buffers. The array is copied, but the buffers need to be kept alive.
+ * @param buf_cnt           number of buffers, at least 2
+ * @param buf_size_in_bytes size of each buffer in bytes
+ * @note  The render mode is always `LV_DISPLAY_RENDER_MODE_PARTIAL`.
+ *        Call `lv_display_set_draw_buffers()` to leave the pipelined mode.
+ */
+void lv_display_set_draw_buffer_ring(lv_display_t * disp, void * const bufs[], uint32_t buf_cnt,
+                                     uint32_t buf_size_in_bytes);
+
 /**
  * Set the flush callback which will be called to copy the rendered image to the display.
  * @param disp      pointer to a display
@@ -250,7 +266,8 @@ void lv_display_set_flush_cb(lv_display_t * disp, lv_display_flush_cb_t flush_cb
 /**
  * Set a callback to be used while LVGL is waiting flushing to be finished.
  * It can do any complex logic to wait, including semaphores, mutexes, polling flags, etc.
- * If not set the `disp->flushing` flag is used which can be cleared with `lv_display_flush_ready()`
+ * If not set the `disp->flushing` flag is used which can be cleared with `lv_display_flush_ready()`.
+ * With `LV_USE_OS` LVGL sleeps until `lv_display_flush_ready()` is called in this case.
  * @param disp      pointer to a display
  * @param wait_cb   a callback to call while LVGL is waiting for flush ready.
  *                  If NULL `lv_display_flush_ready()` can be used to signal that flushing is ready.
@@ -294,7 +311,9 @@ bool lv_display_get_antialiasing(lv_display_t * disp);
 //! @cond Doxygen_Suppress
 
 /**
- * Call from the display driver when the flushing is finished
+ * Call from the display driver when the flushing is finished.
+ * Without an OS or with `flush_wait_cb` set it can be called from an interrupt too,
+ * e.g. when a DMA transfer is complete.
  * @param disp      pointer to display whose `flush_cb` was called
  */
 LV_ATTRIBUTE_FLUSH_READY void lv_display_flush_ready(lv_display_t * disp);
@@ -312,6 +331,13 @@ LV_ATTRIBUTE_FLUSH_READY bool lv_display_flush_is_last(lv_display_t * disp);
 
 bool lv_display_is_double_buffered(lv_display_t * disp);
 
+/**
+ * Get the number of buffers whose flushing is not finished yet.
+ * @param disp      pointer to a display
+ * @return          number of buffers being flushed
+ */
+uint32_t lv_display_get_flush_pending_count(lv_display_t * disp);
+
 /*---------------------
  * SCREENS
  *--------------------*/
@@ -16,6 +16,8 @@ extern "C" {
 #include "../core/lv_obj.h"
 #include "../draw/lv_draw.h"
 #include "lv_display.h"
+#include "../core/lv_refr_stats.h"
+#include "../misc/lv_array.h"
 
 /*********************
  *      DEFINES
@@ -24,6 +26,13 @@ extern "C" {
 #define LV_INV_BUF_SIZE 32 /*Buffer size for invalid areas*/
 #endif
 
+/*Refreshing an area costs about as much as drawing this many pixels, besides drawing its own pixels
+ *(finding the objects to draw, calling the flush callback, etc).
+ *Areas are joined and split only if it makes the refresh cheaper according to this cost.*/
+#ifndef LV_INV_AREA_OVERHEAD
+#define LV_INV_AREA_OVERHEAD 1024
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -66,6 +75,21 @@ struct _lv_display_t {
     uint8_t * buf_act;
     uint32_t buf_size_in_bytes;
 
+    /** Buffers of the pipelined mode set by `lv_display_set_draw_buffer_ring()`. `NULL` if not used.*/
+    uint8_t ** buf_ring;
+    uint32_t buf_ring_cnt;
+
+    /** Number of started flushes. Written only by the library.*/
+    volatile uint32_t flush_start_cnt;
+
+    /** Number of finished flushes. Written only by `lv_display_flush_ready()`.*/
+    volatile uint32_t flush_ready_cnt;
+
+#if LV_USE_OS
+    /** Signaled by `lv_display_flush_ready()` to wake up the rendering waiting for the flush*/
+    lv_thread_sync_t flush_sync;
+#endif
+
     /** MANDATORY: Write the internal buffer (draw_buf) to the display. 'lv_display_flush_ready()' has to be
      * called when finished*/
     lv_display_flush_cb_t flush_cb;
@@ -90,6 +114,16 @@ struct _lv_display_t {
     /** 1: The current screen rendering is in progress*/
     uint32_t rendering_in_progress : 1;
 
+#if LV_USE_REFR_STATS
+    lv_refr_stats_t refr_stats;         /**< Statistics of the last rendered frame*/
+    lv_refr_stats_t refr_stats_act;     /**< Statistics of the frame being rendered*/
+    uint32_t refr_stats_start;          /**< Tick when the refreshing of the frame started*/
+#endif
+
+#if LV_OBJ_OCCLUSION_CULLING
+    lv_array_t occluded_objs;           /**< Objects marked as covered in the area being refreshed*/
+#endif
+
     lv_color_format_t   color_format;
 
     /** Invalidated (marked to redraw) areas*/
@@ -26,6 +26,16 @@
  *  STATIC PROTOTYPES
  **********************/
 static bool is_independent(lv_layer_t * layer, lv_draw_task_t * t_check);
+static void task_index_reset(lv_layer_t * layer);
+static void task_index_refresh(lv_layer_t * layer);
+static uint64_t task_index_get_tile_mask(const lv_draw_task_index_t * index, const lv_area_t * area);
+static void record_task(lv_draw_record_t * record, lv_layer_t * layer, const lv_draw_task_t * t);
+static size_t get_recordable_dsc_size(lv_draw_task_type_t type);
+static void * copy_draw_dsc(const lv_draw_task_t * t, size_t dsc_size);
+#if LV_USE_REFR_STATS
+    static uint32_t get_unit_index(const lv_draw_unit_t * unit);
+    static void stats_mark_taken_tasks(lv_layer_t * layer, lv_draw_unit_t * unit, uint32_t start_tick);
+#endif
 
 static inline uint32_t get_layer_size_kb(uint32_t size_byte)
 {
@@ -66,6 +76,9 @@ void lv_draw_deinit(void)
         u = u->next;
 
         if(cur_unit->delete_cb) cur_unit->delete_cb(cur_unit);
+#if LV_USE_DRAW_ARENA
+        _lv_draw_arena_deinit(cur_unit);
+#endif
         lv_free(cur_unit);
     }
     _draw_info.unit_head = NULL;
@@ -74,6 +87,9 @@ void lv_draw_deinit(void)
 void * lv_draw_create_unit(size_t size)
 {
     lv_draw_unit_t * new_unit = lv_malloc_zeroed(size);
+#if LV_USE_DRAW_ARENA
+    _lv_draw_arena_init(new_unit);
+#endif
 
     new_unit->next = _draw_info.unit_head;
     _draw_info.unit_head = new_unit;
@@ -84,22 +100,27 @@ void * lv_draw_create_unit(size_t size)
 lv_draw_task_t * lv_draw_add_task(lv_layer_t * layer, const lv_area_t * coords)
 {
     LV_PROFILER_BEGIN;
-    lv_draw_task_t * new_task = lv_malloc_zeroed(sizeof(lv_draw_task_t));
+    lv_draw_task_t * new_task = lv_malloc_slab_zeroed(sizeof(lv_draw_task_t));
 
     new_task->area = *coords;
+    new_task->_real_area = *coords;
     new_task->clip_area = layer->_clip_area;
     new_task->state = LV_DRAW_TASK_STATE_QUEUED;
 
-    /*Find the tail*/
+    /*Append to the tail*/
     if(layer->draw_task_head == NULL) {
+        /*The layer is empty so (re)start indexing the tasks*/
+        task_index_reset(layer);
         layer->draw_task_head = new_task;
     }
     else {
-        lv_draw_task_t * tail = layer->draw_task_head;
-        while(tail->next) tail = tail->next;
-
-        tail->next = new_task;
+        layer->draw_task_tail->next = new_task;
     }
+    layer->draw_task_tail = new_task;
+
+    lv_draw_task_index_t * index = &layer->task_index;
+    new_task->seq_id = index->seq_id_next;
+    index->seq_id_next++;
 
     LV_PROFILER_END;
     return new_task;
@@ -111,8 +132,31 @@ void lv_draw_finalize_task_creation(lv_layer_t * layer, lv_draw_task_t * t)
     lv_draw_dsc_base_t * base_dsc = t->draw_dsc;
     base_dsc->layer = layer;
 
+    /*Register the task in the tiles which don't have older unfinished tasks.
+     *It's done here as the real area might be set after adding the task.*/
+    lv_area_t real_clipped;
+    if(_lv_area_intersect(&real_clipped, &t->_real_area, &t->clip_area)) t->_real_area = real_clipped;
+
+    lv_draw_task_index_t * index = &layer->task_index;
+    t->tile_mask = task_index_get_tile_mask(index, &t->_real_area);
+
+    uint32_t i;
+    uint64_t m = t->tile_mask;
+    for(i = 0; m; i++, m >>= 1) {
+        if((m & 1) && index->tile_oldest_id[i] == UINT32_MAX) index->tile_oldest_id[i] = t->seq_id;
+    }
+
     lv_draw_global_info_t * info = &_draw_info;
 
+#if LV_USE_REFR_STATS
+    lv_display_t * disp_refr = _lv_refr_get_disp_refreshing();
+    if(disp_refr && t->type < LV_REFR_STATS_TASK_TYPE_CNT) disp_refr->refr_stats_act.task_cnt[t->type]++;
+#endif
+
+    /*Record only the "main" draw tasks. The ones added in LV_EVENT_DRAW_TASK_ADDED
+     *will be added again when the recorded tasks are replayed*/
+    if(info->record && info->task_running == false) record_task(info->record, layer, t);
+
     /*Send LV_EVENT_DRAW_TASK_ADDED and dispatch only on the "main" draw_task
      *and not on the draw tasks added in the event.
      *Sending LV_EVENT_DRAW_TASK_ADDED events might cause recursive event sends and besides
@@ -173,14 +217,20 @@ bool lv_draw_dispatch_layer(struct _lv_display_t * disp, lv_layer_t * layer)
 {
     LV_PROFILER_BEGIN;
     /*Remove the finished tasks first*/
+    bool removed = false;
     lv_draw_task_t * t_prev = NULL;
     lv_draw_task_t * t = layer->draw_task_head;
     while(t) {
         lv_draw_task_t * t_next = t->next;
         if(t->state == LV_DRAW_TASK_STATE_READY) {
+            removed = true;
             if(t_prev) t_prev->next = t->next;      /*Remove by it by assigning the next task to the previous*/
             else layer->draw_task_head = t_next;    /*If it was the head, set the next as head*/
 
+#if LV_USE_REFR_STATS
+            if(disp && t->stats_unit) _lv_refr_stats_add_unit_task(disp, get_unit_index(t->stats_unit), t->stats_start);
+#endif
+
             /*If it was layer drawing free the layer too*/
             if(t->type == LV_DRAW_TASK_TYPE_LAYER) {
                 lv_draw_image_dsc_t * draw_image_dsc = t->draw_dsc;
@@ -228,6 +278,11 @@ bool lv_draw_dispatch_layer(struct _lv_display_t * disp, lv_layer_t * layer)
         t = t_next;
     }
 
+    if(removed) {
+        layer->draw_task_tail = t_prev;
+        task_index_refresh(layer);
+    }
+
     bool render_running = false;
 
     /*This layer is ready, enable blending its buffer*/
@@ -252,8 +307,14 @@ bool lv_draw_dispatch_layer(struct _lv_display_t * disp, lv_layer_t * layer)
         /*Let all draw units to pick draw tasks*/
         lv_draw_unit_t * u = _draw_info.unit_head;
         while(u) {
+#if LV_USE_REFR_STATS
+            uint32_t start_tick = _lv_refr_stats_tick_get();
+#endif
             int32_t taken_cnt = u->dispatch_cb(u, layer);
             if(taken_cnt >= 0) render_running = true;
+#if LV_USE_REFR_STATS
+            if(taken_cnt > 0) stats_mark_taken_tasks(layer, u, start_tick);
+#endif
             u = u->next;
         }
     }
@@ -324,7 +385,8 @@ uint32_t lv_draw_get_dependent_count(lv_draw_task_t * t_check)
     lv_draw_task_t * t = t_check->next;
     while(t) {
         if((t->state == LV_DRAW_TASK_STATE_QUEUED || t->state == LV_DRAW_TASK_STATE_WAITING) &&
-           _lv_area_is_on(&t_check->area, &t->area)) {
+           (t->tile_mask & t_check->tile_mask) &&
+           _lv_area_is_on(&t_check->_real_area, &t->_real_area)) {
             cnt++;
         }
 
@@ -334,10 +396,81 @@ uint32_t lv_draw_get_dependent_count(lv_draw_task_t * t_check)
     return cnt;
 }
 
+void lv_draw_record_start(lv_draw_record_t * record, lv_layer_t * layer)
+{
+    LV_ASSERT_MSG(_draw_info.record == NULL, "Only one recording can be in progress");
+
+    lv_draw_record_reset(record);
+    record->clip_area = layer->_clip_area;
+    record->layer = layer;
+    _draw_info.record = record;
+}
+
+bool lv_draw_record_stop(lv_draw_record_t * record)
+{
+    if(_draw_info.record == record) _draw_info.record = NULL;
+    record->layer = NULL;
+
+    if(record->failed) {
+        lv_draw_record_reset(record);
+        return false;
+    }
+
+    return true;
+}
+
+bool lv_draw_record_replay(const lv_draw_record_t * record, lv_layer_t * layer)
+{
+    if(!_lv_area_is_in(&layer->_clip_area, &record->clip_area, 0)) return false;
+
+    LV_PROFILER_BEGIN;
+    lv_area_t clip_area_ori = layer->_clip_area;
+    const lv_draw_task_t * t_rec;
+    for(t_rec = record->task_head; t_rec; t_rec = t_rec->next) {
+        /*The tasks were recorded on a larger area so limit them to the current one*/
+        if(!_lv_area_intersect(&layer->_clip_area, &t_rec->clip_area, &clip_area_ori)) continue;
+
+        void * dsc = copy_draw_dsc(t_rec, get_recordable_dsc_size(t_rec->type));
+        if(dsc == NULL) break;
+
+        lv_draw_task_t * t = lv_draw_add_task(layer, &t_rec->area);
+        t->_real_area = t_rec->_real_area;
+        t->type = t_rec->type;
+        t->draw_dsc = dsc;
+        lv_draw_finalize_task_creation(layer, t);
+    }
+    layer->_clip_area = clip_area_ori;
+
+    LV_PROFILER_END;
+    return true;
+}
+
+void lv_draw_record_reset(lv_draw_record_t * record)
+{
+    lv_draw_task_t * t = record->task_head;
+    while(t) {
+        lv_draw_task_t * t_next = t->next;
+        if(t->type == LV_DRAW_TASK_TYPE_LABEL) {
+            lv_draw_label_dsc_t * draw_label_dsc = t->draw_dsc;
+            if(draw_label_dsc->text_local) lv_free((void *)draw_label_dsc->text);
+        }
+        lv_free(t->draw_dsc);
+        lv_free(t);
+        t = t_next;
+    }
+
+    record->task_head = NULL;
+    record->task_tail = NULL;
+    record->failed = false;
+}
+
 lv_layer_t * lv_draw_layer_create(lv_layer_t * parent_layer, lv_color_format_t color_format, const lv_area_t * area)
 {
+    /*The tasks of the new layer are not recorded, and its buffer exists only while it's being drawn*/
+    if(_draw_info.record) _draw_info.record->failed = true;
+
     lv_display_t * disp = _lv_refr_get_disp_refreshing();
-    lv_layer_t * new_layer = lv_malloc_zeroed(sizeof(lv_layer_t));
+    lv_layer_t * new_layer = lv_malloc_slab_zeroed(sizeof(lv_layer_t));
     LV_ASSERT_MALLOC(new_layer);
     if(new_layer == NULL) return NULL;
 
@@ -380,6 +513,13 @@ void * lv_draw_layer_alloc_buf(lv_layer_t * layer)
         _draw_info.used_memory_for_layers_kb += get_layer_size_kb(layer_size_byte);
         LV_LOG_INFO("Layer memory used: %" LV_PRIu32 " kB\n", _draw_info.used_memory_for_layers_kb);
 
+#if LV_USE_REFR_STATS
+        lv_display_t * disp_refr = _lv_refr_get_disp_refreshing();
+        if(disp_refr && disp_refr->refr_stats_act.layer_mem_peak_kb < _draw_info.used_memory_for_layers_kb) {
+            disp_refr->refr_stats_act.layer_mem_peak_kb = _draw_info.used_memory_for_layers_kb;
+        }
+#endif
+
         if(lv_color_format_has_alpha(layer->color_format)) {
             lv_area_t a;
             a.x1 = 0;
@@ -407,6 +547,98 @@ void * lv_draw_layer_go_to_xy(lv_layer_t * layer, int32_t x, int32_t y)
  *   STATIC FUNCTIONS
  **********************/
 
+/**
+ * Store a copy of a draw task in a record
+ * @param record    pointer to the record in progress
+ * @param layer     the layer to which the task was added
+ * @param t         the new draw task
+ */
+static void record_task(lv_draw_record_t * record, lv_layer_t * layer, const lv_draw_task_t * t)
+{
+    if(record->failed) return;
+
+    size_t dsc_size = get_recordable_dsc_size(t->type);
+    if(layer != record->layer || dsc_size == 0) {
+        record->failed = true;
+        return;
+    }
+
+    lv_draw_task_t * t_rec = lv_malloc_slab_zeroed(sizeof(lv_draw_task_t));
+    LV_ASSERT_MALLOC(t_rec);
+    if(t_rec == NULL) {
+        record->failed = true;
+        return;
+    }
+
+    t_rec->draw_dsc = copy_draw_dsc(t, dsc_size);
+    if(t_rec->draw_dsc == NULL) {
+        lv_free(t_rec);
+        record->failed = true;
+        return;
+    }
+
+    t_rec->type = t->type;
+    t_rec->area = t->area;
+    t_rec->_real_area = t->_real_area;
+    t_rec->clip_area = t->clip_area;
+
+    if(record->task_tail) record->task_tail->next = t_rec;
+    else record->task_head = t_rec;
+    record->task_tail = t_rec;
+}
+
+/**
+ * Get the size of the draw descriptor of a draw task type if it can be recorded.
+ * Layers, masks and vector graphics depend on the layer they are drawn to, so they can't be recorded.
+ * @param type      type of a draw task
+ * @return          size of the draw descriptor or 0 if the task can't be recorded
+ */
+static size_t get_recordable_dsc_size(lv_draw_task_type_t type)
+{
+    switch(type) {
+        case LV_DRAW_TASK_TYPE_FILL:
+            return sizeof(lv_draw_fill_dsc_t);
+        case LV_DRAW_TASK_TYPE_BORDER:
+            return sizeof(lv_draw_border_dsc_t);
+        case LV_DRAW_TASK_TYPE_BOX_SHADOW:
+            return sizeof(lv_draw_box_shadow_dsc_t);
+        case LV_DRAW_TASK_TYPE_LABEL:
+            return sizeof(lv_draw_label_dsc_t);
+        case LV_DRAW_TASK_TYPE_IMAGE:
+            return sizeof(lv_draw_image_dsc_t);
+        case LV_DRAW_TASK_TYPE_LINE:
+            return sizeof(lv_draw_line_dsc_t);
+        case LV_DRAW_TASK_TYPE_ARC:
+            return sizeof(lv_draw_arc_dsc_t);
+        case LV_DRAW_TASK_TYPE_TRIANGLE:
+            return sizeof(lv_draw_triangle_dsc_t);
+        default:
+            return 0;
+    }
+}
+
+/**
+ * Copy the draw descriptor of a draw task. Local texts of the labels are copied too.
+ * @param t         the draw task whose descriptor should be copied
+ * @param dsc_size  size of the draw descriptor
+ * @return          the new draw descriptor or NULL on error
+ */
+static void * copy_draw_dsc(const lv_draw_task_t * t, size_t dsc_size)
+{
+    void * dsc = lv_malloc_slab(dsc_size);
+    LV_ASSERT_MALLOC(dsc);
+    if(dsc == NULL) return NULL;
+
+    lv_memcpy(dsc, t->draw_dsc, dsc_size);
+
+    if(t->type == LV_DRAW_TASK_TYPE_LABEL) {
+        lv_draw_label_dsc_t * draw_label_dsc = dsc;
+        if(draw_label_dsc->text_local) draw_label_dsc->text = lv_strdup(draw_label_dsc->text);
+    }
+
+    return dsc;
+}
+
 /**
  * Check if there are older draw task overlapping the area of `t_check`
  * @param layer      the draw ctx to search in
@@ -416,13 +648,29 @@ void * lv_draw_layer_go_to_xy(lv_layer_t * layer, int32_t x, int32_t y)
 static bool is_independent(lv_layer_t * layer, lv_draw_task_t * t_check)
 {
     LV_PROFILER_BEGIN;
+
+    /*If no older unfinished task touches the tiles of t_check it's surely independent*/
+    const lv_draw_task_index_t * index = &layer->task_index;
+    bool tile_shared = false;
+    uint32_t i;
+    uint64_t m = t_check->tile_mask;
+    for(i = 0; m && !tile_shared; i++, m >>= 1) {
+        if((m & 1) && index->tile_oldest_id[i] < t_check->seq_id) tile_shared = true;
+    }
+
+    if(!tile_shared) {
+        LV_PROFILER_END;
+        return true;
+    }
+
+    /*Else check the exact areas of the older tasks sharing a tile with t_check*/
     lv_draw_task_t * t = layer->draw_task_head;
 
     /*If t_check is outside of the older tasks then it's independent*/
     while(t && t != t_check) {
-        if(t->state != LV_DRAW_TASK_STATE_READY) {
+        if(t->state != LV_DRAW_TASK_STATE_READY && (t->tile_mask & t_check->tile_mask)) {
             lv_area_t a;
-            if(_lv_area_intersect(&a, &t->area, &t_check->area)) {
+            if(_lv_area_intersect(&a, &t->_real_area, &t_check->_real_area)) {
                 LV_PROFILER_END;
                 return false;
             }
@@ -433,3 +681,118 @@ static bool is_independent(lv_layer_t * layer, lv_draw_task_t * t_check)
 
     return true;
 }
+
+/**
+ * Start a new index for an empty layer.
+ * The tile grid covers the layer's buffer area.
+ * @param layer     pointer to a layer without draw tasks
+ */
+static void task_index_reset(lv_layer_t * layer)
+{
+    lv_draw_task_index_t * index = &layer->task_index;
+    index->area = layer->buf_area;
+    index->tile_w = LV_MAX(1, (lv_area_get_width(&index->area) + LV_DRAW_TASK_TILE_COL_CNT - 1) /
+                           LV_DRAW_TASK_TILE_COL_CNT);
+    index->tile_h = LV_MAX(1, (lv_area_get_height(&index->area) + LV_DRAW_TASK_TILE_ROW_CNT - 1) /
+                           LV_DRAW_TASK_TILE_ROW_CNT);
+    index->seq_id_next = 0;
+
+    uint32_t i;
+    for(i = 0; i < LV_DRAW_TASK_TILE_CNT; i++) {
+        index->tile_oldest_id[i] = UINT32_MAX;
+    }
+}
+
+/**
+ * Update the oldest unfinished task of each tile after some tasks were removed.
+ * The tasks are stored in creation order so the first unfinished task on a tile is the oldest one.
+ * @param layer     pointer to a layer
+ */
+static void task_index_refresh(lv_layer_t * layer)
+{
+    lv_draw_task_index_t * index = &layer->task_index;
+    uint32_t i;
+    for(i = 0; i < LV_DRAW_TASK_TILE_CNT; i++) {
+        index->tile_oldest_id[i] = UINT32_MAX;
+    }
+
+    uint64_t unset_tiles = UINT64_MAX;
+    lv_draw_task_t * t = layer->draw_task_head;
+    while(t && unset_tiles) {
+        if(t->state != LV_DRAW_TASK_STATE_READY) {
+            uint64_t m = t->tile_mask & unset_tiles;
+            unset_tiles &= ~m;
+            for(i = 0; m; i++, m >>= 1) {
+                if(m & 1) index->tile_oldest_id[i] = t->seq_id;
+            }
+        }
+        t = t->next;
+    }
+}
+
+/**
+ * Get the index of the tile on one axis. Coordinates out of the grid are clamped to the edge tiles.
+ * @param ofs           the coordinate relative to the start of the grid
+ * @param tile_size     width or height of a tile
+ * @param tile_cnt      number of tiles on this axis
+ * @return              the index of the tile
+ */
+static inline int32_t get_tile_coord(int32_t ofs, int32_t tile_size, int32_t tile_cnt)
+{
+    if(ofs <= 0) return 0;
+    ofs = ofs / tile_size;
+    return ofs >= tile_cnt ? tile_cnt - 1 : ofs;
+}
+
+/**
+ * Get the tiles touched by an area
+ * @param index     pointer to the index of a layer
+ * @param area      the area to check
+ * @return          a bit is set for each touched tile. Bit `row * LV_DRAW_TASK_TILE_COL_CNT + col` represents a tile.
+ */
+static uint64_t task_index_get_tile_mask(const lv_draw_task_index_t * index, const lv_area_t * area)
+{
+    int32_t col1 = get_tile_coord(area->x1 - index->area.x1, index->tile_w, LV_DRAW_TASK_TILE_COL_CNT);
+    int32_t col2 = get_tile_coord(area->x2 - index->area.x1, index->tile_w, LV_DRAW_TASK_TILE_COL_CNT);
+    int32_t row1 = get_tile_coord(area->y1 - index->area.y1, index->tile_h, LV_DRAW_TASK_TILE_ROW_CNT);
+    int32_t row2 = get_tile_coord(area->y2 - index->area.y1, index->tile_h, LV_DRAW_TASK_TILE_ROW_CNT);
+    if(col2 < col1) col2 = col1;
+    if(row2 < row1) row2 = row1;
+
+    uint64_t row_mask = ((((uint64_t)1) << (col2 - col1 + 1)) - 1) << col1;
+    uint64_t mask = 0;
+    int32_t row;
+    for(row = row1; row <= row2; row++) {
+        mask |= row_mask << (row * LV_DRAW_TASK_TILE_COL_CNT);
+    }
+
+    return mask;
+}
+
+#if LV_USE_REFR_STATS
+static uint32_t get_unit_index(const lv_draw_unit_t * unit)
+{
+    uint32_t i = 0;
+    const lv_draw_unit_t * u = _draw_info.unit_head;
+    while(u && u != unit) {
+        u = u->next;
+        i++;
+    }
+    return i;
+}
+
+/**
+ * Assign the tasks which left the queue during the last `dispatch_cb` call to the draw unit
+ */
+static void stats_mark_taken_tasks(lv_layer_t * layer, lv_draw_unit_t * unit, uint32_t start_tick)
+{
+    lv_draw_task_t * t;
+    for(t = layer->draw_task_head; t; t = t->next) {
+        if(t->stats_unit == NULL &&
+           (t->state == LV_DRAW_TASK_STATE_IN_PROGRESS || t->state == LV_DRAW_TASK_STATE_READY)) {
+            t->stats_unit = unit;
+            t->stats_start = start_tick;
+        }
+    }
+}
+#endif
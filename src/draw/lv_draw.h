@@ -22,12 +22,21 @@ extern "C" {
 #include "lv_image_decoder.h"
 #include "../osal/lv_os.h"
 #include "lv_draw_buf.h"
+#include "lv_draw_arena.h"
 
 /*********************
  *      DEFINES
  *********************/
 #define LV_DRAW_UNIT_ID_ANY  0
 
+/**
+ * The layers are divided into a grid of tiles to quickly tell which draw tasks might overlap.
+ * The tile mask of a draw task is stored on 64 bits so the grid is 8x8.
+ */
+#define LV_DRAW_TASK_TILE_COL_CNT   8
+#define LV_DRAW_TASK_TILE_ROW_CNT   8
+#define LV_DRAW_TASK_TILE_CNT       (LV_DRAW_TASK_TILE_COL_CNT * LV_DRAW_TASK_TILE_ROW_CNT)
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -67,6 +76,12 @@ typedef struct _lv_draw_task_t {
      */
     lv_area_t area;
 
+    /**
+     * The area where the task can really draw. Used to find the dependent tasks.
+     * E.g. transformed and tiled images draw out of `area`.
+     */
+    lv_area_t _real_area;
+
     /** The original area which is updated*/
     lv_area_t clip_area_original;
 
@@ -94,6 +109,27 @@ typedef struct _lv_draw_task_t {
      */
     uint8_t preference_score;
 
+    /**
+     * Used internally by the dispatcher.
+     * Tasks added to a layer get increasing IDs so their order can be compared quickly
+     */
+    uint32_t seq_id;
+
+    /**
+     * Used internally by the dispatcher.
+     * Bitmask of the layer's tiles touched by `area`
+     */
+    uint64_t tile_mask;
+
+#if LV_USE_REFR_STATS
+    /**
+     * Used internally by the dispatcher.
+     * The draw unit which took the task and the tick when it was taken
+     */
+    struct _lv_draw_unit_t * stats_unit;
+    uint32_t stats_start;
+#endif
+
 } lv_draw_task_t;
 
 typedef struct {
@@ -140,8 +176,36 @@ typedef struct _lv_draw_unit_t {
      * @return
      */
     int32_t (*delete_cb)(struct _lv_draw_unit_t * draw_unit);
+
+#if LV_USE_DRAW_ARENA
+    /**
+     * Used internally by `lv_draw_arena_alloc()` for the temporary buffers of the draw tasks
+     */
+    lv_draw_arena_t arena;
+#endif
 } lv_draw_unit_t;
 
+/**
+ * Spatial index of a layer's draw tasks.
+ * Used internally to find the independent draw tasks without comparing each task with all the older ones.
+ */
+typedef struct {
+    /** The area which is divided into tiles. Set when the first task is added to an empty layer*/
+    lv_area_t area;
+
+    int32_t tile_w;
+    int32_t tile_h;
+
+    /** The ID to assign to the next draw task*/
+    uint32_t seq_id_next;
+
+    /**
+     * The `seq_id` of the oldest not ready draw task touching a tile, or `UINT32_MAX` if there is no any.
+     * Refreshed when the ready tasks are removed, so it might point to an already ready task.
+     */
+    uint32_t tile_oldest_id[LV_DRAW_TASK_TILE_CNT];
+} lv_draw_task_index_t;
+
 typedef struct _lv_layer_t  {
 
     /** The unaligned buffer where drawing will happen*/
@@ -171,12 +235,37 @@ typedef struct _lv_layer_t  {
     /** Linked list of draw tasks */
     lv_draw_task_t * draw_task_head;
 
+    /** The last draw task in the linked list to quickly append new tasks*/
+    lv_draw_task_t * draw_task_tail;
+
+    /** Used internally to quickly find the independent draw tasks*/
+    lv_draw_task_index_t task_index;
+
     struct _lv_layer_t * parent;
     struct _lv_layer_t * next;
     bool all_tasks_added;
     void * user_data;
 } lv_layer_t;
 
+/**
+ * Copies of the draw tasks added to a layer between `lv_draw_record_start()` and `lv_draw_record_stop()`.
+ * They can be added to a layer again with `lv_draw_record_replay()` without creating them from scratch.
+ */
+typedef struct _lv_draw_record_t {
+    /** The copied draw tasks. Only `type`, `area`, `clip_area` and `draw_dsc` are set.*/
+    lv_draw_task_t * task_head;
+    lv_draw_task_t * task_tail;
+
+    /** The clip area of the layer when the recording was started*/
+    lv_area_t clip_area;
+
+    /** The layer whose draw tasks are being recorded or NULL if the recording is stopped*/
+    lv_layer_t * layer;
+
+    /** Set if a draw task was added which can't be recorded. E.g. a layer*/
+    bool failed;
+} lv_draw_record_t;
+
 typedef struct {
     struct _lv_obj_t * obj;
     uint32_t part;
@@ -197,6 +286,7 @@ typedef struct {
 #endif
     lv_mutex_t circle_cache_mutex;
     bool task_running;
+    lv_draw_record_t * record;      /**< The recording in progress, if any*/
 } lv_draw_global_info_t;
 
 /**********************
@@ -282,6 +372,40 @@ lv_draw_task_t * lv_draw_get_next_available_task(lv_layer_t * layer, lv_draw_tas
  */
 uint32_t lv_draw_get_dependent_count(lv_draw_task_t * t_check);
 
+/**
+ * Start copying the draw tasks added to a layer into a record.
+ * Only one recording can be in progress at a time.
+ * @param record    pointer to a record. Its earlier content is freed.
+ *                  Needs to be zeroed before it's used the first time.
+ * @param layer     the layer whose draw tasks shall be recorded
+ */
+void lv_draw_record_start(lv_draw_record_t * record, lv_layer_t * layer);
+
+/**
+ * Stop the recording
+ * @param record    pointer to a record
+ * @return          true: all the added draw tasks were recorded;
+ *                  false: some draw tasks couldn't be recorded so the record was freed
+ */
+bool lv_draw_record_stop(lv_draw_record_t * record);
+
+/**
+ * Add the recorded draw tasks to a layer again.
+ * The clip area of the draw tasks are limited to the current clip area of the layer.
+ * @param record    pointer to a record
+ * @param layer     the layer to add the draw tasks to
+ * @return          true: the draw tasks were added;
+ *                  false: the clip area of the layer is not inside the area where the tasks were recorded,
+ *                  so nothing was added
+ */
+bool lv_draw_record_replay(const lv_draw_record_t * record, lv_layer_t * layer);
+
+/**
+ * Free the draw tasks stored in a record
+ * @param record    pointer to a record
+ */
+void lv_draw_record_reset(lv_draw_record_t * record);
+
 /**
  * Create a new layer on a parent layer
  * @param parent_layer      the parent layer to which the layer will be merged when it's rendered
@@ -0,0 +1,194 @@
+/**
+ * @file lv_draw_arena.c
+ * Bump allocator for the temporary buffers of the draw units.
+ * Each draw unit has its own arena so no locking is required even if the draw units run in parallel.
+ * The buffers are expected to be freed in reverse order (as they are allocated and freed in a draw function)
+ * so freeing the last buffer gives back its memory immediately.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw.h"
+#include "../core/lv_global.h"
+#include "../misc/lv_assert.h"
+#include "../stdlib/lv_mem.h"
+#include "../stdlib/lv_string.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define _draw_info LV_GLOBAL_DEFAULT()->draw_info
+
+#define NO_BUF          UINT32_MAX
+#define FREED_FLAG      0x80000000
+#define HEADER_SIZE     sizeof(buf_header_t)
+
+#if LV_USE_DRAW_ARENA && LV_DRAW_ARENA_SIZE >= FREED_FLAG
+    #error "LV_DRAW_ARENA_SIZE is too large"
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/*Stored before each buffer. Its size keeps the buffers aligned to 8 bytes*/
+typedef struct {
+    uint32_t prev;      /*Offset of the header of the previous buffer in the arena*/
+    uint32_t size;      /*Size of the buffer with the header. `FREED_FLAG` is set if it's freed.*/
+} buf_header_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+#if LV_USE_DRAW_ARENA
+    static void update_peak(lv_draw_arena_t * arena);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+#if LV_USE_DRAW_ARENA
+
+void _lv_draw_arena_init(lv_draw_unit_t * draw_unit)
+{
+    lv_draw_arena_t * arena = &draw_unit->arena;
+    lv_memzero(arena, sizeof(lv_draw_arena_t));
+    arena->last = NO_BUF;
+
+    /*Without the buffer everything will be allocated from the heap*/
+    arena->buf = lv_malloc(LV_DRAW_ARENA_SIZE);
+    LV_ASSERT_MALLOC(arena->buf);
+}
+
+void _lv_draw_arena_deinit(lv_draw_unit_t * draw_unit)
+{
+    lv_draw_arena_t * arena = &draw_unit->arena;
+    if(arena->used) LV_LOG_WARN("%" LV_PRIu32 " bytes are still in use", arena->used);
+
+    lv_free(arena->buf);
+    arena->buf = NULL;
+}
+
+void * lv_draw_arena_alloc(lv_draw_unit_t * draw_unit, size_t size)
+{
+    lv_draw_arena_t * arena = &draw_unit->arena;
+    size_t full_size = ((size + 7) & ~(size_t)7) + HEADER_SIZE;
+
+    buf_header_t * header;
+    if(arena->buf && full_size <= LV_DRAW_ARENA_SIZE - arena->used) {
+        header = (buf_header_t *)(arena->buf + arena->used);
+        header->prev = arena->last;
+        header->size = full_size;
+        arena->last = arena->used;
+        arena->used += full_size;
+    }
+    else {
+        /*Doesn't fit, fall back to the heap*/
+        header = lv_malloc(full_size);
+        if(header == NULL) return NULL;
+        header->prev = NO_BUF;
+        header->size = full_size;
+        arena->heap_used += full_size;
+        arena->overflow_cnt++;
+    }
+
+    update_peak(arena);
+
+    return header + 1;
+}
+
+void lv_draw_arena_free(lv_draw_unit_t * draw_unit, void * p)
+{
+    if(p == NULL) return;
+
+    lv_draw_arena_t * arena = &draw_unit->arena;
+    buf_header_t * header = (buf_header_t *)p - 1;
+    uint8_t * header_u8 = (uint8_t *)header;
+
+    if(header_u8 < arena->buf || header_u8 >= arena->buf + LV_DRAW_ARENA_SIZE) {
+        arena->heap_used -= header->size;
+        lv_free(header);
+        return;
+    }
+
+    LV_ASSERT((header->size & FREED_FLAG) == 0);
+    header->size |= FREED_FLAG;
+
+    /*Give back the memory of the freed buffers on the top of the arena*/
+    while(arena->last != NO_BUF) {
+        header = (buf_header_t *)(arena->buf + arena->last);
+        if((header->size & FREED_FLAG) == 0) break;
+
+        arena->used = arena->last;
+        arena->last = header->prev;
+    }
+}
+
+void lv_draw_arena_get_info(const lv_draw_unit_t * draw_unit, lv_draw_arena_info_t * info)
+{
+    const lv_draw_arena_t * arena = &draw_unit->arena;
+    info->size = arena->buf ? LV_DRAW_ARENA_SIZE : 0;
+    info->peak = arena->peak;
+    info->last_frame_peak = arena->last_frame_peak;
+    info->overflow_cnt = arena->overflow_cnt;
+}
+
+void _lv_draw_arena_frame_end(void)
+{
+    lv_draw_unit_t * u = _draw_info.unit_head;
+    while(u) {
+        lv_draw_arena_t * arena = &u->arena;
+        arena->last_frame_peak = arena->frame_peak;
+
+        /*Start the next frame with the buffers which are still in use*/
+        arena->frame_peak = arena->used + arena->heap_used;
+        u = u->next;
+    }
+}
+
+#else /*LV_USE_DRAW_ARENA*/
+
+void * lv_draw_arena_alloc(lv_draw_unit_t * draw_unit, size_t size)
+{
+    LV_UNUSED(draw_unit);
+    return lv_malloc(size);
+}
+
+void lv_draw_arena_free(lv_draw_unit_t * draw_unit, void * p)
+{
+    LV_UNUSED(draw_unit);
+    lv_free(p);
+}
+
+void lv_draw_arena_get_info(const lv_draw_unit_t * draw_unit, lv_draw_arena_info_t * info)
+{
+    LV_UNUSED(draw_unit);
+    lv_memzero(info, sizeof(lv_draw_arena_info_t));
+}
+
+#endif /*LV_USE_DRAW_ARENA*/
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_USE_DRAW_ARENA
+
+static void update_peak(lv_draw_arena_t * arena)
+{
+    uint32_t total = arena->used + arena->heap_used;
+    if(total > arena->frame_peak) arena->frame_peak = total;
+    if(total > arena->peak) arena->peak = total;
+}
+
+#endif /*LV_USE_DRAW_ARENA*/
@@ -0,0 +1,107 @@
+/**
+ * @file lv_draw_arena.h
+ *
+ */
+
+#ifndef LV_DRAW_ARENA_H
+#define LV_DRAW_ARENA_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+#include "../misc/lv_types.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+struct _lv_draw_unit_t;
+
+#if LV_USE_DRAW_ARENA
+typedef struct {
+    uint8_t * buf;              /**< `LV_DRAW_ARENA_SIZE` bytes or NULL if it couldn't be allocated*/
+    uint32_t used;              /**< The buffers are allocated from `buf` from 0 to `used`*/
+    uint32_t last;              /**< Offset of the header of the last buffer in `buf`*/
+    uint32_t heap_used;         /**< Size of the buffers allocated from the heap because `buf` was full*/
+    uint32_t frame_peak;        /**< The most memory needed at once in the current frame*/
+    uint32_t last_frame_peak;
+    uint32_t peak;
+    uint32_t overflow_cnt;
+} lv_draw_arena_t;
+#endif
+
+typedef struct {
+    uint32_t size;              /**< Size of the arena*/
+    uint32_t peak;              /**< The most memory needed at once since the draw unit was created*/
+    uint32_t last_frame_peak;   /**< The most memory needed at once in the last refreshed frame*/
+    uint32_t overflow_cnt;      /**< Number of buffers allocated from the heap because the arena was full*/
+} lv_draw_arena_info_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Allocate a temporary buffer for the draw task being drawn by a draw unit.
+ * The buffer should be freed with `lv_draw_arena_free()` before the draw task is finished.
+ * Freeing the buffers in reverse order of allocation makes their memory reusable immediately.
+ * @param draw_unit     pointer to a draw unit
+ * @param size          size of the buffer in bytes
+ * @return              pointer to the buffer or NULL on out of memory
+ */
+void * lv_draw_arena_alloc(struct _lv_draw_unit_t * draw_unit, size_t size);
+
+/**
+ * Free a buffer allocated with `lv_draw_arena_alloc()`
+ * @param draw_unit     pointer to the draw unit which allocated the buffer
+ * @param p             pointer to the buffer. NULL is ignored.
+ */
+void lv_draw_arena_free(struct _lv_draw_unit_t * draw_unit, void * p);
+
+/**
+ * Get the usage of the arena of a draw unit. Useful to tune `LV_DRAW_ARENA_SIZE`.
+ * @param draw_unit     pointer to a draw unit
+ * @param info          store the result here
+ */
+void lv_draw_arena_get_info(const struct _lv_draw_unit_t * draw_unit, lv_draw_arena_info_t * info);
+
+#if LV_USE_DRAW_ARENA
+
+/**
+ * Allocate the arena of a new draw unit. Called by `lv_draw_create_unit()`.
+ * @param draw_unit     pointer to a draw unit
+ */
+void _lv_draw_arena_init(struct _lv_draw_unit_t * draw_unit);
+
+/**
+ * Free the arena of a draw unit. Called by `lv_draw_deinit()`.
+ * @param draw_unit     pointer to a draw unit
+ */
+void _lv_draw_arena_deinit(struct _lv_draw_unit_t * draw_unit);
+
+/**
+ * Close the frame of the arenas of all draw units and update their statistics.
+ * Called at the end of `_lv_display_refr_timer()`.
+ */
+void _lv_draw_arena_frame_end(void);
+
+#endif /*LV_USE_DRAW_ARENA*/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_DRAW_ARENA_H*/
@@ -26,11 +26,21 @@
  *  STATIC PROTOTYPES
  **********************/
 
+static void draw_normal(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t * draw_dsc,
+                        lv_image_decoder_dsc_t * decoder_dsc, const lv_area_t * coords,
+                        lv_draw_image_core_cb draw_core_cb);
+static void draw_tiled(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t * draw_dsc,
+                       lv_image_decoder_dsc_t * decoder_dsc, const lv_area_t * coords,
+                       lv_draw_image_core_cb draw_core_cb);
 static void img_decode_and_draw(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t * draw_dsc,
                                 lv_image_decoder_dsc_t * decoder_dsc,
                                 const lv_area_t * img_area, const lv_area_t * clipped_img_area,
                                 lv_draw_image_core_cb draw_core_cb);
 
+static void get_transformed_area(const lv_draw_image_dsc_t * draw_dsc, const lv_area_t * coords,
+                                 lv_area_t * transformed_area);
+static void set_real_area(lv_draw_task_t * t, const lv_draw_image_dsc_t * draw_dsc);
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -58,10 +68,11 @@ void lv_draw_layer(lv_layer_t * layer, const lv_draw_image_dsc_t * dsc, const lv
 {
     lv_draw_task_t * t = lv_draw_add_task(layer, coords);
 
-    t->draw_dsc = lv_malloc(sizeof(*dsc));
+    t->draw_dsc = lv_malloc_slab(sizeof(*dsc));
     lv_memcpy(t->draw_dsc, dsc, sizeof(*dsc));
     t->type = LV_DRAW_TASK_TYPE_LAYER;
     t->state = LV_DRAW_TASK_STATE_WAITING;
+    set_real_area(t, t->draw_dsc);
 
     lv_layer_t * layer_to_draw = (lv_layer_t *)dsc->src;
     layer_to_draw->all_tasks_added = true;
@@ -91,6 +102,7 @@ void lv_draw_image(lv_layer_t * layer, const lv_draw_image_dsc_t * dsc, const lv
     lv_draw_task_t * t = lv_draw_add_task(layer, coords);
     t->draw_dsc = new_image_dsc;
     t->type = LV_DRAW_TASK_TYPE_IMAGE;
+    set_real_area(t, new_image_dsc);
 
     lv_draw_finalize_task_creation(layer, t);
     LV_PROFILER_END;
@@ -129,25 +141,10 @@ void _lv_draw_image_normal_helper(lv_draw_unit_t * draw_unit, const lv_draw_imag
         return;
     }
 
+    /*Don't decode the image if it's not visible*/
     lv_area_t draw_area;
-    lv_area_copy(&draw_area, coords);
-    if(draw_dsc->rotation || draw_dsc->scale_x != LV_SCALE_NONE || draw_dsc->scale_y != LV_SCALE_NONE) {
-        int32_t w = lv_area_get_width(coords);
-        int32_t h = lv_area_get_height(coords);
-
-        _lv_image_buf_get_transformed_area(&draw_area, w, h, draw_dsc->rotation, draw_dsc->scale_x, draw_dsc->scale_y,
-                                           &draw_dsc->pivot);
-
-        draw_area.x1 += coords->x1;
-        draw_area.y1 += coords->y1;
-        draw_area.x2 += coords->x1;
-        draw_area.y2 += coords->y1;
-    }
-
-    lv_area_t clipped_img_area;
-    if(!_lv_area_intersect(&clipped_img_area, &draw_area, draw_unit->clip_area)) {
-        return;
-    }
+    get_transformed_area(draw_dsc, coords, &draw_area);
+    if(!_lv_area_is_on(&draw_area, draw_unit->clip_area)) return;
 
     lv_image_decoder_dsc_t decoder_dsc;
     lv_result_t res = lv_image_decoder_open(&decoder_dsc, draw_dsc->src, NULL);
@@ -156,7 +153,7 @@ void _lv_draw_image_normal_helper(lv_draw_unit_t * draw_unit, const lv_draw_imag
         return;
     }
 
-    img_decode_and_draw(draw_unit, draw_dsc, &decoder_dsc, coords, &clipped_img_area, draw_core_cb);
+    draw_normal(draw_unit, draw_dsc, &decoder_dsc, coords, draw_core_cb);
 
     lv_image_decoder_close(&decoder_dsc);
 }
@@ -176,6 +173,47 @@ void _lv_draw_image_tiled_helper(lv_draw_unit_t * draw_unit, const lv_draw_image
         return;
     }
 
+    draw_tiled(draw_unit, draw_dsc, &decoder_dsc, coords, draw_core_cb);
+
+    lv_image_decoder_close(&decoder_dsc);
+}
+
+void _lv_draw_image_decoded_helper(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t * draw_dsc,
+                                   lv_image_decoder_dsc_t * decoder_dsc, const lv_area_t * coords,
+                                   lv_draw_image_core_cb draw_core_cb)
+{
+    if(draw_core_cb == NULL) {
+        LV_LOG_WARN("draw_core_cb is NULL");
+        return;
+    }
+
+    if(!draw_dsc->tile) draw_normal(draw_unit, draw_dsc, decoder_dsc, coords, draw_core_cb);
+    else draw_tiled(draw_unit, draw_dsc, decoder_dsc, coords, draw_core_cb);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void draw_normal(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t * draw_dsc,
+                        lv_image_decoder_dsc_t * decoder_dsc, const lv_area_t * coords,
+                        lv_draw_image_core_cb draw_core_cb)
+{
+    lv_area_t draw_area;
+    get_transformed_area(draw_dsc, coords, &draw_area);
+
+    lv_area_t clipped_img_area;
+    if(!_lv_area_intersect(&clipped_img_area, &draw_area, draw_unit->clip_area)) {
+        return;
+    }
+
+    img_decode_and_draw(draw_unit, draw_dsc, decoder_dsc, coords, &clipped_img_area, draw_core_cb);
+}
+
+static void draw_tiled(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t * draw_dsc,
+                       lv_image_decoder_dsc_t * decoder_dsc, const lv_area_t * coords,
+                       lv_draw_image_core_cb draw_core_cb)
+{
     int32_t img_w = lv_area_get_width(coords);
     int32_t img_h = lv_area_get_height(coords);
 
@@ -187,7 +225,7 @@ void _lv_draw_image_tiled_helper(lv_draw_unit_t * draw_unit, const lv_draw_image
 
             lv_area_t clipped_img_area;
             if(_lv_area_intersect(&clipped_img_area, &tile_area, draw_unit->clip_area)) {
-                img_decode_and_draw(draw_unit, draw_dsc, &decoder_dsc, &tile_area, &clipped_img_area, draw_core_cb);
+                img_decode_and_draw(draw_unit, draw_dsc, decoder_dsc, &tile_area, &clipped_img_area, draw_core_cb);
             }
 
             tile_area.x1 += img_w;
@@ -199,14 +237,8 @@ void _lv_draw_image_tiled_helper(lv_draw_unit_t * draw_unit, const lv_draw_image
         tile_area.x1 = tile_x_start;
         tile_area.x2 = tile_x_start + img_w - 1;
     }
-
-    lv_image_decoder_close(&decoder_dsc);
 }
 
-/**********************
- *   STATIC FUNCTIONS
- **********************/
-
 static void img_decode_and_draw(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t * draw_dsc,
                                 lv_image_decoder_dsc_t * decoder_dsc,
                                 const lv_area_t * img_area, const lv_area_t * clipped_img_area,
@@ -216,6 +248,7 @@ static void img_decode_and_draw(lv_draw_unit_t * draw_unit, const lv_draw_image_
     sup.alpha_color = draw_dsc->recolor;
     sup.palette = decoder_dsc->palette;
     sup.palette_size = decoder_dsc->palette_size;
+    sup.mip_level = 0;
 
     /*The whole image is available, just draw it*/
     if(decoder_dsc->decoded || decoder_dsc->img_data) {
@@ -249,3 +282,40 @@ static void img_decode_and_draw(lv_draw_unit_t * draw_unit, const lv_draw_image_
         }
     }
 }
+
+/**
+ * Get the area of an image after rotation, scale and skew
+ * @param draw_dsc          the draw descriptor of the image
+ * @param coords            the coordinates of the image
+ * @param transformed_area  store the result here
+ */
+static void get_transformed_area(const lv_draw_image_dsc_t * draw_dsc, const lv_area_t * coords,
+                                 lv_area_t * transformed_area)
+{
+    lv_area_copy(transformed_area, coords);
+    if(draw_dsc->rotation || draw_dsc->scale_x != LV_SCALE_NONE || draw_dsc->scale_y != LV_SCALE_NONE ||
+       draw_dsc->skew_x || draw_dsc->skew_y) {
+        int32_t w = lv_area_get_width(coords);
+        int32_t h = lv_area_get_height(coords);
+
+        _lv_image_buf_get_transformed_area(transformed_area, w, h, draw_dsc->rotation, draw_dsc->scale_x,
+                                           draw_dsc->scale_y, draw_dsc->skew_x, draw_dsc->skew_y, &draw_dsc->pivot);
+
+        transformed_area->x1 += coords->x1;
+        transformed_area->y1 += coords->y1;
+        transformed_area->x2 += coords->x1;
+        transformed_area->y2 += coords->y1;
+    }
+}
+
+/**
+ * Set where an image or layer draw task really draws, so that the overlapping tasks are not drawn in parallel with it
+ * @param t         pointer to a draw task
+ * @param draw_dsc  the image draw descriptor of the task
+ */
+static void set_real_area(lv_draw_task_t * t, const lv_draw_image_dsc_t * draw_dsc)
+{
+    /*The tiles are repeated on the whole clip area*/
+    if(draw_dsc->tile) t->_real_area = t->clip_area;
+    else get_transformed_area(draw_dsc, &t->area, &t->_real_area);
+}
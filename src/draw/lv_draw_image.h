@@ -34,6 +34,7 @@ typedef struct {
     lv_color_t alpha_color;
     const lv_color32_t * palette;
     uint32_t palette_size   : 9;
+    uint32_t mip_level      : 4;    /*The source buffer is the image downscaled by 2^mip_level*/
 } lv_draw_image_sup_t;
 
 typedef struct _lv_draw_image_dsc_t {
@@ -132,6 +133,19 @@ void _lv_draw_image_normal_helper(lv_draw_unit_t * draw_unit, const lv_draw_imag
 void _lv_draw_image_tiled_helper(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t * draw_dsc,
                                  const lv_area_t * coords, lv_draw_image_core_cb draw_core_cb);
 
+/**
+ * Like `_lv_draw_image_normal_helper` or `_lv_draw_image_tiled_helper` but with an already opened decoder.
+ * Allows drawing the parts of an image (e.g. bands) without decoding it again for each part.
+ * @param draw_unit     pointer to a draw unit
+ * @param draw_dsc      the draw descriptor of the image
+ * @param decoder_dsc   the decoder opened for `draw_dsc->src`
+ * @param coords        the absolute coordinates of the image
+ * @param draw_core_cb  a callback to perform the actual rendering
+ */
+void _lv_draw_image_decoded_helper(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t * draw_dsc,
+                                   lv_image_decoder_dsc_t * decoder_dsc, const lv_area_t * coords,
+                                   lv_draw_image_core_cb draw_core_cb);
+
 #ifdef __cplusplus
 } /*extern "C"*/
 #endif
@@ -14,6 +14,7 @@
 #include "../misc/lv_assert.h"
 #include "../stdlib/lv_mem.h"
 #include "../stdlib/lv_string.h"
+#include "../font/lv_font_fmt_txt.h"
 
 /*********************
  *      DEFINES
@@ -79,7 +80,7 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_label(lv_layer_t * layer, const lv_draw_label
     LV_PROFILER_BEGIN;
     lv_draw_task_t * t = lv_draw_add_task(layer, coords);
 
-    t->draw_dsc = lv_malloc(sizeof(*dsc));
+    t->draw_dsc = lv_malloc_slab(sizeof(*dsc));
     lv_memcpy(t->draw_dsc, dsc, sizeof(*dsc));
     t->type = LV_DRAW_TASK_TYPE_LABEL;
 
@@ -398,27 +399,40 @@ static void draw_letter(lv_draw_unit_t * draw_unit, lv_draw_glyph_dsc_t * dsc,
         return;
     }
 
-    uint32_t bitmap_size = lv_draw_buf_width_to_stride(g.box_w, LV_COLOR_FORMAT_A8) * g.box_h;
-    bitmap_size = (bitmap_size + 63) &
-                  (~63);   /*Round up to avoid many allocations if the next buffer is just slightly larger*/
-    if(dsc->_bitmap_buf_size < bitmap_size) {
-        lv_draw_buf_free(dsc->_bitmap_buf_unaligned);
-        dsc->_bitmap_buf_unaligned = lv_draw_buf_malloc(bitmap_size, LV_COLOR_FORMAT_A8);
-        LV_ASSERT_MALLOC(dsc->_bitmap_buf_unaligned);
-        dsc->bitmap_buf = lv_draw_buf_align(dsc->_bitmap_buf_unaligned, LV_COLOR_FORMAT_A8);
-        dsc->_bitmap_buf_size = bitmap_size;
+    dsc->bitmap = NULL;
+
+#if LV_FONT_FMT_TXT_CACHE_SIZE > 0
+    /*The built-in fonts can use the already converted bitmaps from the glyph cache*/
+    lv_font_fmt_txt_cache_entry_t * cache_entry = NULL;
+    if(g.resolved_font && g.resolved_font->get_glyph_bitmap == lv_font_get_bitmap_fmt_txt) {
+        dsc->bitmap = _lv_font_fmt_txt_cache_acquire(g.resolved_font, letter, &cache_entry);
     }
+#endif
+
+    if(dsc->bitmap == NULL && g.resolved_font) {
+        uint32_t bitmap_size = lv_draw_buf_width_to_stride(g.box_w, LV_COLOR_FORMAT_A8) * g.box_h;
+        bitmap_size = (bitmap_size + 63) &
+                      (~63);   /*Round up to avoid many allocations if the next buffer is just slightly larger*/
+        if(dsc->_bitmap_buf_size < bitmap_size) {
+            lv_draw_buf_free(dsc->_bitmap_buf_unaligned);
+            dsc->_bitmap_buf_unaligned = lv_draw_buf_malloc(bitmap_size, LV_COLOR_FORMAT_A8);
+            LV_ASSERT_MALLOC(dsc->_bitmap_buf_unaligned);
+            dsc->bitmap_buf = lv_draw_buf_align(dsc->_bitmap_buf_unaligned, LV_COLOR_FORMAT_A8);
+            dsc->_bitmap_buf_size = bitmap_size;
+        }
 
-    if(g.resolved_font) {
         dsc->bitmap = lv_font_get_glyph_bitmap(g.resolved_font, letter, dsc->bitmap_buf);
     }
-    else {
-        dsc->bitmap = NULL;
-    }
+
     dsc->letter_coords = &letter_coords;
     if(g.bpp == LV_IMGFONT_BPP) dsc->format = LV_DRAW_LETTER_BITMAP_FORMAT_IMAGE;
     else dsc->format = LV_DRAW_LETTER_BITMAP_FORMAT_A8;
 
     cb(draw_unit, dsc, NULL, NULL);
+
+#if LV_FONT_FMT_TXT_CACHE_SIZE > 0
+    _lv_font_fmt_txt_cache_release(cache_entry);
+#endif
+
     LV_PROFILER_END;
 }
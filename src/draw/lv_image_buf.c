@@ -60,10 +60,10 @@ void lv_image_buf_free(lv_image_dsc_t * dsc)
 }
 
 void _lv_image_buf_get_transformed_area(lv_area_t * res, int32_t w, int32_t h, int32_t angle, uint16_t scale_x,
-                                        uint16_t scale_y,
+                                        uint16_t scale_y, int32_t skew_x, int32_t skew_y,
                                         const lv_point_t * pivot)
 {
-    if(angle == 0 && scale_x == LV_SCALE_NONE && scale_y == LV_SCALE_NONE) {
+    if(angle == 0 && scale_x == LV_SCALE_NONE && scale_y == LV_SCALE_NONE && skew_x == 0 && skew_y == 0) {
         res->x1 = 0;
         res->y1 = 0;
         res->x2 = w - 1;
@@ -77,6 +77,10 @@ void _lv_image_buf_get_transformed_area(lv_area_t * res, int32_t w, int32_t h, i
         {0, h - 1},
         {w - 1, h - 1},
     };
+    lv_point_skew(&p[0], skew_x, skew_y, pivot, false);
+    lv_point_skew(&p[1], skew_x, skew_y, pivot, false);
+    lv_point_skew(&p[2], skew_x, skew_y, pivot, false);
+    lv_point_skew(&p[3], skew_x, skew_y, pivot, false);
     lv_point_transform(&p[0], angle, scale_x, scale_y, pivot, true);
     lv_point_transform(&p[1], angle, scale_x, scale_y, pivot, true);
     lv_point_transform(&p[2], angle, scale_x, scale_y, pivot, true);
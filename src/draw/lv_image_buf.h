@@ -166,10 +166,12 @@ void lv_image_buf_free(lv_image_dsc_t * dsc);
  * @param angle angle of rotation
  * @param scale_x zoom in x direction, (256 no zoom)
  * @param scale_y zoom in y direction, (256 no zoom)
+ * @param skew_x horizontal skew in 0.1 degree units
+ * @param skew_y vertical skew in 0.1 degree units
  * @param pivot x,y pivot coordinates of rotation
  */
 void _lv_image_buf_get_transformed_area(lv_area_t * res, int32_t w, int32_t h, int32_t angle, uint16_t scale_x,
-                                        uint16_t scale_y,
+                                        uint16_t scale_y, int32_t skew_x, int32_t skew_y,
                                         const lv_point_t * pivot);
 
 static inline void lv_image_header_init(lv_image_header_t * header, uint32_t w, uint32_t h, lv_color_format_t cf,
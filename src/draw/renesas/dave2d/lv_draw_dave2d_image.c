@@ -58,7 +58,7 @@ static void dave2d_img_draw_normal(lv_draw_dave2d_unit_t * draw_unit, const lv_d
         int32_t h = lv_area_get_height(coords);
 
         _lv_image_buf_get_transformed_area(&draw_area, w, h, draw_dsc->rotation, draw_dsc->scale_x, draw_dsc->scale_y,
-                                           &draw_dsc->pivot);
+                                           draw_dsc->skew_x, draw_dsc->skew_y, &draw_dsc->pivot);
 
         draw_area.x1 += coords->x1;
         draw_area.y1 += coords->y1;
@@ -97,7 +97,9 @@ static void lv_draw_dave2d_draw_letter_cb(lv_draw_unit_t * u, lv_draw_glyph_dsc_
 
 #if defined(RENESAS_CORTEX_M85)
 #if (BSP_CFG_DCACHE_ENABLED)
-            d1_cacheblockflush(unit->d2_handle, 0, glyph_draw_dsc->bitmap, glyph_draw_dsc->_bitmap_buf_size);
+            /*The bitmap might come from the glyph cache so don't use the size of `bitmap_buf`*/
+            d1_cacheblockflush(unit->d2_handle, 0, glyph_draw_dsc->bitmap,
+                               lv_area_get_width(&mask_area) * lv_area_get_height(&mask_area));
 #endif
 #endif
             d2_settexture(unit->d2_handle, (void *)glyph_draw_dsc->bitmap,
@@ -39,6 +39,8 @@ static void execute_drawing(lv_draw_sdl_unit_t * u);
 
 static int32_t dispatch(lv_draw_unit_t * draw_unit, lv_layer_t * layer);
 
+static uint32_t hash_cb(const void * data, size_t data_size);
+
 static int32_t evaluate(lv_draw_unit_t * draw_unit, lv_draw_task_t * task);
 
 /**********************
@@ -65,6 +67,7 @@ void lv_draw_sdl_init(void)
     draw_sdl_unit->base_unit.dispatch_cb = dispatch;
     draw_sdl_unit->base_unit.evaluate_cb = evaluate;
     draw_sdl_unit->texture_cache_data_type = lv_cache_register_data_type();
+    lv_cache_set_data_hash_cb(draw_sdl_unit->texture_cache_data_type, hash_cb);
 }
 
 /**********************
@@ -138,6 +141,24 @@ bool compare_cb(const void * data1, const void * data2, size_t data_size)
 
 }
 
+/*Hash the same fields which are compared in `compare_cb`*/
+static uint32_t hash_cb(const void * data, size_t data_size)
+{
+    LV_UNUSED(data_size);
+    const cache_data_t * d = data;
+
+    /*FNV-1a*/
+    uint32_t h = 2166136261u;
+    const uint8_t * p = (const uint8_t *)d->draw_dsc;
+    uint32_t i;
+    for(i = 0; i < d->draw_dsc->dsc_size; i++) {
+        h ^= p[i];
+        h *= 16777619u;
+    }
+
+    return h ^ ((uint32_t)d->w * 31 + (uint32_t)d->h);
+}
+
 void invalidate_cb(lv_cache_entry_t * e)
 {
     const cache_data_t * d = e->data;
@@ -0,0 +1,1009 @@
+/**
+ * @file lv_blend_x86.c
+ *
+ * SSE2 and AVX2 implementation of the `LV_DRAW_SW_..._BLEND_...` hooks.
+ * Every kernel gives exactly the same result as the C implementation in
+ * `lv_draw_sw_blend_to_rgb565/rgb888/argb8888.c`. The leftover pixels at the
+ * end of the lines (and the cases which can't be vectorized, e.g. a non-opaque
+ * ARGB8888 background) are handled by scalar code using the same formulas.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_blend_x86.h"
+#if LV_USE_DRAW_SW && (LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_SSE2 || LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_AVX2)
+
+#if !defined(__SSE2__) && !defined(_M_X64) && !(defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #error "LV_DRAW_SW_ASM_SSE2 and LV_DRAW_SW_ASM_AVX2 require an x86 target with SSE2"
+#endif
+
+#include <emmintrin.h>
+#include "../../../../misc/lv_color.h"
+#include "../../../../misc/lv_color_op.h"
+#include "../../../../stdlib/lv_string.h"
+
+/*AVX2 is selected at runtime so the library can be compiled without `-mavx2`.
+ *It needs GCC or Clang for `__attribute__((target))` and `__builtin_cpu_supports`.*/
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_AVX2 && defined(__GNUC__)
+    #include <immintrin.h>
+    #define BLEND_AVX2          1
+    #define BLEND_AVX2_TARGET   __attribute__((target("avx2")))
+#else
+    #define BLEND_AVX2          0
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*The foreground is taken from an ARGB8888 source and its alpha channel is one of the factors of the mix ratio*/
+#define BLEND_SRC_ARGB8888      0x01
+
+/*`opa` is one of the factors of the mix ratio*/
+#define BLEND_OPA               0x02
+
+/*`mask_buf` is one of the factors of the mix ratio*/
+#define BLEND_MASK              0x04
+
+/*The foreground is taken from an RGB565 source*/
+#define BLEND_SRC_RGB565        0x08
+
+#define BLEND_RATIO_MASK        (BLEND_SRC_ARGB8888 | BLEND_OPA | BLEND_MASK)
+
+#define RGB565_NEUTRAL_MASK     0x07E0F81F
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/*Common descriptor for the fill and image blending to process them with the same kernels*/
+typedef struct {
+    uint8_t * dest_buf;
+    int32_t dest_w;
+    int32_t dest_h;
+    int32_t dest_stride;
+    const uint8_t * src_buf;
+    int32_t src_stride;
+    const lv_opa_t * mask_buf;
+    int32_t mask_stride;
+    lv_color32_t color32;
+    uint32_t color_u32;
+    uint16_t color16;
+    lv_opa_t opa;
+} blend_job_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void job_init_fill(blend_job_t * job, const _lv_draw_sw_blend_fill_dsc_t * dsc);
+static void job_init_image(blend_job_t * job, const _lv_draw_sw_blend_image_dsc_t * dsc);
+
+static void fill_rgb565(const blend_job_t * job);
+static void fill_rgb888(const blend_job_t * job, uint32_t dest_px_size);
+static void copy_rgb565(const blend_job_t * job);
+
+static void blend_to_rgb565(const blend_job_t * job, uint32_t flags);
+static void blend_to_rgb888(const blend_job_t * job, uint32_t flags, uint32_t dest_px_size);
+static void blend_to_argb8888(const blend_job_t * job, uint32_t flags);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+#if BLEND_AVX2
+    static bool avx2_disabled;
+#endif
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+bool lv_draw_sw_blend_x86_has_avx2(void)
+{
+#if BLEND_AVX2
+    return !avx2_disabled && __builtin_cpu_supports("avx2") != 0;
+#else
+    return false;
+#endif
+}
+
+void lv_draw_sw_blend_x86_enable_avx2(bool en)
+{
+#if BLEND_AVX2
+    avx2_disabled = !en;
+#else
+    LV_UNUSED(en);
+#endif
+}
+
+void _lv_color_blend_to_rgb565_x86(_lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    blend_job_t job;
+    job_init_fill(&job, dsc);
+    fill_rgb565(&job);
+}
+
+void _lv_color_blend_to_rgb565_with_opa_x86(_lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    blend_job_t job;
+    job_init_fill(&job, dsc);
+    blend_to_rgb565(&job, BLEND_OPA);
+}
+
+void _lv_color_blend_to_rgb565_with_mask_x86(_lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    blend_job_t job;
+    job_init_fill(&job, dsc);
+    blend_to_rgb565(&job, BLEND_MASK);
+}
+
+void _lv_color_blend_to_rgb565_mix_mask_opa_x86(_lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    blend_job_t job;
+    job_init_fill(&job, dsc);
+    blend_to_rgb565(&job, BLEND_OPA | BLEND_MASK);
+}
+
+void _lv_rgb565_blend_normal_to_rgb565_x86(_lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    blend_job_t job;
+    job_init_image(&job, dsc);
+    copy_rgb565(&job);
+}
+
+void _lv_rgb565_blend_normal_to_rgb565_with_opa_x86(_lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    blend_job_t job;
+    job_init_image(&job, dsc);
+    blend_to_rgb565(&job, BLEND_SRC_RGB565 | BLEND_OPA);
+}
+
+void _lv_rgb565_blend_normal_to_rgb565_with_mask_x86(_lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    blend_job_t job;
+    job_init_image(&job, dsc);
+    blend_to_rgb565(&job, BLEND_SRC_RGB565 | BLEND_MASK);
+}
+
+void _lv_rgb565_blend_normal_to_rgb565_mix_mask_opa_x86(_lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    blend_job_t job;
+    job_init_image(&job, dsc);
+    blend_to_rgb565(&job, BLEND_SRC_RGB565 | BLEND_OPA | BLEND_MASK);
+}
+
+void _lv_argb8888_blend_normal_to_rgb565_x86(_lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    blend_job_t job;
+    job_init_image(&job, dsc);
+    blend_to_rgb565(&job, BLEND_SRC_ARGB8888);
+}
+
+void _lv_argb8888_blend_normal_to_rgb565_with_opa_x86(_lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    blend_job_t job;
+    job_init_image(&job, dsc);
+    blend_to_rgb565(&job, BLEND_SRC_ARGB8888 | BLEND_OPA);
+}
+
+void _lv_argb8888_blend_normal_to_rgb565_with_mask_x86(_lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    blend_job_t job;
+    job_init_image(&job, dsc);
+    blend_to_rgb565(&job, BLEND_SRC_ARGB8888 | BLEND_MASK);
+}
+
+void _lv_argb8888_blend_normal_to_rgb565_mix_mask_opa_x86(_lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    blend_job_t job;
+    job_init_image(&job, dsc);
+    blend_to_rgb565(&job, BLEND_SRC_ARGB8888 | BLEND_OPA | BLEND_MASK);
+}
+
+void _lv_color_blend_to_rgb888_x86(_lv_draw_sw_blend_fill_dsc_t * dsc, uint32_t dst_px_size)
+{
+    blend_job_t job;
+    job_init_fill(&job, dsc);
+    fill_rgb888(&job, dst_px_size);
+}
+
+void _lv_color_blend_to_rgb888_with_opa_x86(_lv_draw_sw_blend_fill_dsc_t * dsc, uint32_t dst_px_size)
+{
+    blend_job_t job;
+    job_init_fill(&job, dsc);
+    blend_to_rgb888(&job, BLEND_OPA, dst_px_size);
+}
+
+void _lv_color_blend_to_rgb888_with_mask_x86(_lv_draw_sw_blend_fill_dsc_t * dsc, uint32_t dst_px_size)
+{
+    blend_job_t job;
+    job_init_fill(&job, dsc);
+    blend_to_rgb888(&job, BLEND_MASK, dst_px_size);
+}
+
+void _lv_color_blend_to_rgb888_mix_mask_opa_x86(_lv_draw_sw_blend_fill_dsc_t * dsc, uint32_t dst_px_size)
+{
+    blend_job_t job;
+    job_init_fill(&job, dsc);
+    blend_to_rgb888(&job, BLEND_OPA | BLEND_MASK, dst_px_size);
+}
+
+void _lv_argb8888_blend_normal_to_rgb888_x86(_lv_draw_sw_blend_image_dsc_t * dsc, uint32_t dst_px_size)
+{
+    blend_job_t job;
+    job_init_image(&job, dsc);
+    blend_to_rgb888(&job, BLEND_SRC_ARGB8888, dst_px_size);
+}
+
+void _lv_argb8888_blend_normal_to_rgb888_with_opa_x86(_lv_draw_sw_blend_image_dsc_t * dsc, uint32_t dst_px_size)
+{
+    blend_job_t job;
+    job_init_image(&job, dsc);
+    blend_to_rgb888(&job, BLEND_SRC_ARGB8888 | BLEND_OPA, dst_px_size);
+}
+
+void _lv_argb8888_blend_normal_to_rgb888_with_mask_x86(_lv_draw_sw_blend_image_dsc_t * dsc, uint32_t dst_px_size)
+{
+    blend_job_t job;
+    job_init_image(&job, dsc);
+    blend_to_rgb888(&job, BLEND_SRC_ARGB8888 | BLEND_MASK, dst_px_size);
+}
+
+void _lv_argb8888_blend_normal_to_rgb888_mix_mask_opa_x86(_lv_draw_sw_blend_image_dsc_t * dsc, uint32_t dst_px_size)
+{
+    blend_job_t job;
+    job_init_image(&job, dsc);
+    blend_to_rgb888(&job, BLEND_SRC_ARGB8888 | BLEND_OPA | BLEND_MASK, dst_px_size);
+}
+
+void _lv_color_blend_to_argb8888_x86(_lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    blend_job_t job;
+    job_init_fill(&job, dsc);
+    fill_rgb888(&job, 4);
+}
+
+void _lv_color_blend_to_argb8888_with_opa_x86(_lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    blend_job_t job;
+    job_init_fill(&job, dsc);
+    blend_to_argb8888(&job, BLEND_OPA);
+}
+
+void _lv_color_blend_to_argb8888_with_mask_x86(_lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    blend_job_t job;
+    job_init_fill(&job, dsc);
+    blend_to_argb8888(&job, BLEND_MASK);
+}
+
+void _lv_color_blend_to_argb8888_mix_mask_opa_x86(_lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    blend_job_t job;
+    job_init_fill(&job, dsc);
+    blend_to_argb8888(&job, BLEND_OPA | BLEND_MASK);
+}
+
+void _lv_argb8888_blend_normal_to_argb8888_x86(_lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    blend_job_t job;
+    job_init_image(&job, dsc);
+    blend_to_argb8888(&job, BLEND_SRC_ARGB8888);
+}
+
+void _lv_argb8888_blend_normal_to_argb8888_with_opa_x86(_lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    blend_job_t job;
+    job_init_image(&job, dsc);
+    blend_to_argb8888(&job, BLEND_SRC_ARGB8888 | BLEND_OPA);
+}
+
+void _lv_argb8888_blend_normal_to_argb8888_with_mask_x86(_lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    blend_job_t job;
+    job_init_image(&job, dsc);
+    blend_to_argb8888(&job, BLEND_SRC_ARGB8888 | BLEND_MASK);
+}
+
+void _lv_argb8888_blend_normal_to_argb8888_mix_mask_opa_x86(_lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    blend_job_t job;
+    job_init_image(&job, dsc);
+    blend_to_argb8888(&job, BLEND_SRC_ARGB8888 | BLEND_OPA | BLEND_MASK);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void job_init_fill(blend_job_t * job, const _lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    job->dest_buf = dsc->dest_buf;
+    job->dest_w = dsc->dest_w;
+    job->dest_h = dsc->dest_h;
+    job->dest_stride = dsc->dest_stride;
+    job->src_buf = NULL;
+    job->src_stride = 0;
+    job->mask_buf = dsc->mask_buf;
+    job->mask_stride = dsc->mask_stride;
+    job->color32 = lv_color_to_32(dsc->color, 0xff);
+    job->color_u32 = lv_color_to_u32(dsc->color);
+    job->color16 = lv_color_to_u16(dsc->color);
+    job->opa = dsc->opa;
+}
+
+static void job_init_image(blend_job_t * job, const _lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    job->dest_buf = dsc->dest_buf;
+    job->dest_w = dsc->dest_w;
+    job->dest_h = dsc->dest_h;
+    job->dest_stride = dsc->dest_stride;
+    job->src_buf = dsc->src_buf;
+    job->src_stride = dsc->src_stride;
+    job->mask_buf = dsc->mask_buf;
+    job->mask_stride = dsc->mask_stride;
+    lv_memzero(&job->color32, sizeof(job->color32));
+    job->color_u32 = 0;
+    job->color16 = 0;
+    job->opa = dsc->opa;
+}
+
+/*=====================
+ * Scalar helpers
+ *====================*/
+
+/**
+ * Get the mix ratio of a pixel from the factors selected in `flags`.
+ * The same as `LV_OPA_MIX2/3` in the C implementation.
+ */
+static inline uint32_t ratio_get(uint32_t flags, uint32_t src_alpha, uint32_t opa, uint32_t mask)
+{
+    switch(flags & BLEND_RATIO_MASK) {
+        case BLEND_SRC_ARGB8888:
+            return src_alpha;
+        case BLEND_OPA:
+            return opa;
+        case BLEND_MASK:
+            return mask;
+        case BLEND_SRC_ARGB8888 | BLEND_OPA:
+            return (uint32_t)LV_OPA_MIX2(src_alpha, opa);
+        case BLEND_SRC_ARGB8888 | BLEND_MASK:
+            return (uint32_t)LV_OPA_MIX2(src_alpha, mask);
+        case BLEND_OPA | BLEND_MASK:
+            return (uint32_t)LV_OPA_MIX2(mask, opa);
+        case BLEND_SRC_ARGB8888 | BLEND_OPA | BLEND_MASK:
+            return (uint32_t)LV_OPA_MIX3(src_alpha, opa, mask);
+        default:
+            return 255;
+    }
+}
+
+/*Same as `lv_color_32_32_mix` of the C implementation without the memoization*/
+static inline lv_color32_t mix_32_32(lv_color32_t fg, lv_color32_t bg)
+{
+    if(fg.alpha >= LV_OPA_MAX || bg.alpha <= LV_OPA_MIN) {
+        return fg;
+    }
+    else if(fg.alpha <= LV_OPA_MIN) {
+        return bg;
+    }
+    else if(bg.alpha == 255) {
+        return lv_color_mix32(fg, bg);
+    }
+    else {
+        uint32_t res_alpha = 255 - LV_OPA_MIX2(255 - fg.alpha, 255 - bg.alpha);
+        fg.alpha = (uint32_t)((uint32_t)fg.alpha * 255) / res_alpha;
+        lv_color32_t res = lv_color_mix32(fg, bg);
+        res.alpha = res_alpha;
+        return res;
+    }
+}
+
+/*Same as `lv_color_24_24_mix` of the C implementation*/
+static inline void mix_24_24(const uint8_t * src, uint8_t * dest, uint32_t mix)
+{
+    if(mix == 0) return;
+
+    if(mix >= LV_OPA_MAX) {
+        dest[0] = src[0];
+        dest[1] = src[1];
+        dest[2] = src[2];
+    }
+    else {
+        uint32_t mix_inv = 255 - mix;
+        dest[0] = (uint32_t)((uint32_t)src[0] * mix + dest[0] * mix_inv) >> 8;
+        dest[1] = (uint32_t)((uint32_t)src[1] * mix + dest[1] * mix_inv) >> 8;
+        dest[2] = (uint32_t)((uint32_t)src[2] * mix + dest[2] * mix_inv) >> 8;
+    }
+}
+
+/*Same as `lv_color_24_16_mix` of the C implementation*/
+static inline uint16_t mix_24_16(const uint8_t * c1, uint16_t c2, uint32_t mix)
+{
+    if(mix == 0) {
+        return c2;
+    }
+    else if(mix == 255) {
+        return ((c1[2] & 0xF8) << 8)  + ((c1[1] & 0xFC) << 3) + ((c1[0] & 0xF8) >> 3);
+    }
+    else {
+        uint32_t mix_inv = 255 - mix;
+
+        return ((((c1[2] >> 3) * mix + ((c2 >> 11) & 0x1F) * mix_inv) << 3) & 0xF800) +
+               ((((c1[1] >> 2) * mix + ((c2 >> 5) & 0x3F) * mix_inv) >> 3) & 0x07E0) +
+               (((c1[0] >> 3) * mix + (c2 & 0x1F) * mix_inv) >> 8);
+    }
+}
+
+static void rgb565_row_scalar(const blend_job_t * job, uint32_t flags, uint16_t * dest, const uint8_t * src,
+                              const lv_opa_t * mask, int32_t x, int32_t x_end)
+{
+    for(; x < x_end; x++) {
+        uint32_t m = (flags & BLEND_MASK) ? mask[x] : 255;
+        if(flags & BLEND_SRC_ARGB8888) {
+            const uint8_t * src_px = &src[x * 4];
+            dest[x] = mix_24_16(src_px, dest[x], ratio_get(flags, src_px[3], job->opa, m));
+        }
+        else {
+            uint16_t fg = (flags & BLEND_SRC_RGB565) ? ((const uint16_t *)src)[x] : job->color16;
+            dest[x] = lv_color_16_16_mix(fg, dest[x], ratio_get(flags, 255, job->opa, m));
+        }
+    }
+}
+
+static void rgb888_row_scalar(const blend_job_t * job, uint32_t flags, uint8_t * dest, const uint8_t * src,
+                              const lv_opa_t * mask, int32_t x, int32_t x_end, uint32_t dest_px_size)
+{
+    for(; x < x_end; x++) {
+        uint32_t m = (flags & BLEND_MASK) ? mask[x] : 255;
+        const uint8_t * src_px = (flags & BLEND_SRC_ARGB8888) ? &src[x * 4] : (const uint8_t *)&job->color32;
+        mix_24_24(src_px, &dest[x * dest_px_size], ratio_get(flags, src_px[3], job->opa, m));
+    }
+}
+
+static void argb8888_row_scalar(const blend_job_t * job, uint32_t flags, lv_color32_t * dest, const uint8_t * src,
+                                const lv_opa_t * mask, int32_t x, int32_t x_end)
+{
+    for(; x < x_end; x++) {
+        uint32_t m = (flags & BLEND_MASK) ? mask[x] : 255;
+        lv_color32_t fg = (flags & BLEND_SRC_ARGB8888) ? ((const lv_color32_t *)src)[x] : job->color32;
+        fg.alpha = ratio_get(flags, fg.alpha, job->opa, m);
+        dest[x] = mix_32_32(fg, dest[x]);
+    }
+}
+
+/*=====================
+ * SSE2 helpers
+ *====================*/
+
+static inline __m128i select_sse2(__m128i cond, __m128i a, __m128i b)
+{
+    return _mm_or_si128(_mm_and_si128(cond, a), _mm_andnot_si128(cond, b));
+}
+
+/*Low 32 bits of the product of the 32 bit lanes (`_mm_mullo_epi32` is SSE4.1)*/
+static inline __m128i mullo_epi32_sse2(__m128i a, __m128i b)
+{
+    __m128i even = _mm_mul_epu32(a, b);
+    __m128i odd = _mm_mul_epu32(_mm_srli_si128(a, 4), _mm_srli_si128(b, 4));
+    return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                              _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+}
+
+/*Load 4 mask values into the 32 bit lanes*/
+static inline __m128i mask_load_sse2(const lv_opa_t * mask)
+{
+    uint32_t m = (uint32_t)mask[0] | ((uint32_t)mask[1] << 8) | ((uint32_t)mask[2] << 16) | ((uint32_t)mask[3] << 24);
+    __m128i zero = _mm_setzero_si128();
+    __m128i v = _mm_unpacklo_epi8(_mm_cvtsi32_si128((int)m), zero);
+    return _mm_unpacklo_epi16(v, zero);
+}
+
+/**
+ * Get the mix ratio of 4 pixels into the 32 bit lanes
+ * @param flags     the factors to use
+ * @param src       4 ARGB8888 source pixels, used with `BLEND_SRC_ARGB8888`
+ * @param opa       `opa` in all lanes
+ * @param mask      pointer to 4 mask values, used with `BLEND_MASK`
+ */
+static inline __m128i ratio_get_sse2(uint32_t flags, __m128i src, __m128i opa, const lv_opa_t * mask)
+{
+    __m128i f[3];
+    uint32_t n = 0;
+    if(flags & BLEND_SRC_ARGB8888) f[n++] = _mm_srli_epi32(src, 24);
+    if(flags & BLEND_OPA) f[n++] = opa;
+    if(flags & BLEND_MASK) f[n++] = mask_load_sse2(mask);
+
+    if(n == 0) return _mm_set1_epi32(255);
+    if(n == 1) return f[0];
+
+    /*The factors are on the lower 16 bits of the 32 bit lanes, the upper 16 bits remain 0*/
+    __m128i f01 = _mm_mullo_epi16(f[0], f[1]);
+    if(n == 2) return _mm_srli_epi32(f01, 8);
+    return _mm_mulhi_epu16(f01, f[2]);
+}
+
+/*(fg * ratio + bg * (255 - ratio)) >> 8 on every byte. `ratio` is in the 32 bit lanes.*/
+static inline __m128i mix_u8_sse2(__m128i fg, __m128i bg, __m128i ratio)
+{
+    __m128i zero = _mm_setzero_si128();
+    __m128i r = _mm_or_si128(ratio, _mm_slli_epi32(ratio, 8));
+    r = _mm_or_si128(r, _mm_slli_epi32(r, 16));
+    __m128i r_inv = _mm_xor_si128(r, _mm_set1_epi8((char)0xFF));
+
+    __m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(fg, zero), _mm_unpacklo_epi8(r, zero)),
+                               _mm_mullo_epi16(_mm_unpacklo_epi8(bg, zero), _mm_unpacklo_epi8(r_inv, zero)));
+    __m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(fg, zero), _mm_unpackhi_epi8(r, zero)),
+                               _mm_mullo_epi16(_mm_unpackhi_epi8(bg, zero), _mm_unpackhi_epi8(r_inv, zero)));
+
+    return _mm_packus_epi16(_mm_srli_epi16(lo, 8), _mm_srli_epi16(hi, 8));
+}
+
+/*`lv_color_16_16_mix` on RGB565 colors stored in the 32 bit lanes*/
+static inline __m128i mix_16_16_sse2(__m128i fg, __m128i bg, __m128i ratio)
+{
+    const __m128i neutral = _mm_set1_epi32(RGB565_NEUTRAL_MASK);
+    __m128i m = _mm_srli_epi32(_mm_add_epi32(ratio, _mm_set1_epi32(4)), 3);
+    __m128i fg_n = _mm_and_si128(_mm_or_si128(fg, _mm_slli_epi32(fg, 16)), neutral);
+    __m128i bg_n = _mm_and_si128(_mm_or_si128(bg, _mm_slli_epi32(bg, 16)), neutral);
+
+#if defined(LV_USE_ALTERNATE_MIX_ROUTINE_FOR_RGB565_COLOR_FORMAT) && LV_USE_ALTERNATE_MIX_ROUTINE_FOR_RGB565_COLOR_FORMAT == 1
+    __m128i m_inv = _mm_sub_epi32(_mm_set1_epi32(32), m);
+    __m128i res = _mm_add_epi32(mullo_epi32_sse2(fg_n, m), mullo_epi32_sse2(bg_n, m_inv));
+    res = _mm_and_si128(_mm_srli_epi32(res, 5), neutral);
+#else
+    __m128i res = mullo_epi32_sse2(_mm_sub_epi32(fg_n, bg_n), m);
+    res = _mm_and_si128(_mm_add_epi32(_mm_srli_epi32(res, 5), bg_n), neutral);
+    res = select_sse2(_mm_cmpeq_epi32(ratio, _mm_set1_epi32(255)), fg, res);
+    res = select_sse2(_mm_cmpeq_epi32(ratio, _mm_setzero_si128()), bg, res);
+#endif
+
+    return _mm_and_si128(_mm_or_si128(res, _mm_srli_epi32(res, 16)), _mm_set1_epi32(0xFFFF));
+}
+
+/*`lv_color_24_16_mix` on ARGB8888 foreground and RGB565 background colors stored in the 32 bit lanes*/
+static inline __m128i mix_24_16_sse2(__m128i fg, __m128i bg, __m128i ratio)
+{
+    const __m128i mask_5 = _mm_set1_epi32(0x1F);
+    const __m128i mask_6 = _mm_set1_epi32(0x3F);
+    __m128i ratio_inv = _mm_sub_epi32(_mm_set1_epi32(255), ratio);
+
+    __m128i fg_r = _mm_and_si128(_mm_srli_epi32(fg, 19), mask_5);
+    __m128i fg_g = _mm_and_si128(_mm_srli_epi32(fg, 10), mask_6);
+    __m128i fg_b = _mm_and_si128(_mm_srli_epi32(fg, 3), mask_5);
+    __m128i bg_r = _mm_srli_epi32(bg, 11);
+    __m128i bg_g = _mm_and_si128(_mm_srli_epi32(bg, 5), mask_6);
+    __m128i bg_b = _mm_and_si128(bg, mask_5);
+
+    /*The products fit into 16 bit and the upper 16 bits of the lanes are 0*/
+    __m128i r = _mm_srli_epi32(_mm_add_epi32(_mm_mullo_epi16(fg_r, ratio), _mm_mullo_epi16(bg_r, ratio_inv)), 8);
+    __m128i g = _mm_srli_epi32(_mm_add_epi32(_mm_mullo_epi16(fg_g, ratio), _mm_mullo_epi16(bg_g, ratio_inv)), 8);
+    __m128i b = _mm_srli_epi32(_mm_add_epi32(_mm_mullo_epi16(fg_b, ratio), _mm_mullo_epi16(bg_b, ratio_inv)), 8);
+    __m128i res = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(r, 11), _mm_slli_epi32(g, 5)), b);
+
+    __m128i fg_565 = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(fg_r, 11), _mm_slli_epi32(fg_g, 5)), fg_b);
+    res = select_sse2(_mm_cmpeq_epi32(ratio, _mm_set1_epi32(255)), fg_565, res);
+    return select_sse2(_mm_cmpeq_epi32(ratio, _mm_setzero_si128()), bg, res);
+}
+
+/*Convert 4 lanes with 16 bit values to 4 x uint16_t in the lower 64 bits*/
+static inline __m128i pack_u16_sse2(__m128i v)
+{
+    /*`_mm_packs_epi32` saturates to int16_t so sign extend the values first*/
+    v = _mm_srai_epi32(_mm_slli_epi32(v, 16), 16);
+    return _mm_packs_epi32(v, v);
+}
+
+/*=====================
+ * AVX2 helpers
+ *====================*/
+
+#if BLEND_AVX2
+
+BLEND_AVX2_TARGET static inline __m256i select_avx2(__m256i cond, __m256i a, __m256i b)
+{
+    return _mm256_blendv_epi8(b, a, cond);
+}
+
+BLEND_AVX2_TARGET static inline __m256i ratio_get_avx2(uint32_t flags, __m256i src, __m256i opa,
+                                                       const lv_opa_t * mask)
+{
+    __m256i f[3];
+    uint32_t n = 0;
+    if(flags & BLEND_SRC_ARGB8888) f[n++] = _mm256_srli_epi32(src, 24);
+    if(flags & BLEND_OPA) f[n++] = opa;
+    if(flags & BLEND_MASK) f[n++] = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)mask));
+
+    if(n == 0) return _mm256_set1_epi32(255);
+    if(n == 1) return f[0];
+
+    __m256i f01 = _mm256_mullo_epi16(f[0], f[1]);
+    if(n == 2) return _mm256_srli_epi32(f01, 8);
+    return _mm256_mulhi_epu16(f01, f[2]);
+}
+
+BLEND_AVX2_TARGET static inline __m256i mix_u8_avx2(__m256i fg, __m256i bg, __m256i ratio)
+{
+    __m256i zero = _mm256_setzero_si256();
+    __m256i r = _mm256_or_si256(ratio, _mm256_slli_epi32(ratio, 8));
+    r = _mm256_or_si256(r, _mm256_slli_epi32(r, 16));
+    __m256i r_inv = _mm256_xor_si256(r, _mm256_set1_epi8((char)0xFF));
+
+    /*unpack and pack work on the 128 bit lanes so the order of the pixels is kept*/
+    __m256i lo = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(fg, zero), _mm256_unpacklo_epi8(r, zero)),
+                                  _mm256_mullo_epi16(_mm256_unpacklo_epi8(bg, zero), _mm256_unpacklo_epi8(r_inv, zero)));
+    __m256i hi = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(fg, zero), _mm256_unpackhi_epi8(r, zero)),
+                                  _mm256_mullo_epi16(_mm256_unpackhi_epi8(bg, zero), _mm256_unpackhi_epi8(r_inv, zero)));
+
+    return _mm256_packus_epi16(_mm256_srli_epi16(lo, 8), _mm256_srli_epi16(hi, 8));
+}
+
+BLEND_AVX2_TARGET static void fill_u32_avx2(const blend_job_t * job, uint32_t color)
+{
+    __m256i color_v = _mm256_set1_epi32((int)color);
+    uint8_t * dest_row = job->dest_buf;
+    int32_t y;
+    for(y = 0; y < job->dest_h; y++) {
+        uint32_t * dest = (uint32_t *)dest_row;
+        int32_t x;
+        for(x = 0; x + 8 <= job->dest_w; x += 8) {
+            _mm256_storeu_si256((__m256i *)&dest[x], color_v);
+        }
+        for(; x < job->dest_w; x++) {
+            dest[x] = color;
+        }
+        dest_row += job->dest_stride;
+    }
+}
+
+BLEND_AVX2_TARGET static void fill_rgb565_avx2(const blend_job_t * job)
+{
+    __m256i color_v = _mm256_set1_epi16((short)job->color16);
+    uint8_t * dest_row = job->dest_buf;
+    int32_t y;
+    for(y = 0; y < job->dest_h; y++) {
+        uint16_t * dest = (uint16_t *)dest_row;
+        int32_t x;
+        for(x = 0; x + 16 <= job->dest_w; x += 16) {
+            _mm256_storeu_si256((__m256i *)&dest[x], color_v);
+        }
+        for(; x < job->dest_w; x++) {
+            dest[x] = job->color16;
+        }
+        dest_row += job->dest_stride;
+    }
+}
+
+BLEND_AVX2_TARGET static void blend_to_xrgb8888_avx2(const blend_job_t * job, uint32_t flags)
+{
+    const __m256i opa_v = _mm256_set1_epi32(job->opa);
+    const __m256i color_v = _mm256_set1_epi32((int)job->color_u32);
+    const __m256i rgb_mask = _mm256_set1_epi32(0x00FFFFFF);
+    const __m256i x_mask = _mm256_set1_epi32((int)0xFF000000);
+    const __m256i v_252 = _mm256_set1_epi32(LV_OPA_MAX - 1);
+    const __m256i zero = _mm256_setzero_si256();
+
+    uint8_t * dest_row = job->dest_buf;
+    const uint8_t * src_row = job->src_buf;
+    const lv_opa_t * mask_row = job->mask_buf;
+    int32_t y;
+    for(y = 0; y < job->dest_h; y++) {
+        int32_t x;
+        for(x = 0; x + 8 <= job->dest_w; x += 8) {
+            __m256i fg = (flags & BLEND_SRC_ARGB8888) ? _mm256_loadu_si256((const __m256i *)&src_row[x * 4]) : color_v;
+            __m256i ratio = ratio_get_avx2(flags, fg, opa_v, (flags & BLEND_MASK) ? &mask_row[x] : NULL);
+            __m256i bg = _mm256_loadu_si256((const __m256i *)&dest_row[x * 4]);
+            __m256i bg_x = _mm256_and_si256(bg, x_mask);
+            __m256i fg_rgb = _mm256_or_si256(_mm256_and_si256(fg, rgb_mask), bg_x);
+            __m256i res = _mm256_or_si256(_mm256_and_si256(mix_u8_avx2(fg, bg, ratio), rgb_mask), bg_x);
+            res = select_avx2(_mm256_cmpgt_epi32(ratio, v_252), fg_rgb, res);
+            res = select_avx2(_mm256_cmpeq_epi32(ratio, zero), bg, res);
+            _mm256_storeu_si256((__m256i *)&dest_row[x * 4], res);
+        }
+        rgb888_row_scalar(job, flags, dest_row, src_row, mask_row, x, job->dest_w, 4);
+
+        dest_row += job->dest_stride;
+        if(flags & BLEND_SRC_ARGB8888) src_row += job->src_stride;
+        if(flags & BLEND_MASK) mask_row += job->mask_stride;
+    }
+}
+
+BLEND_AVX2_TARGET static void blend_to_argb8888_avx2(const blend_job_t * job, uint32_t flags)
+{
+    const __m256i opa_v = _mm256_set1_epi32(job->opa);
+    const __m256i color_v = _mm256_set1_epi32((int)job->color_u32);
+    const __m256i rgb_mask = _mm256_set1_epi32(0x00FFFFFF);
+    const __m256i alpha_mask = _mm256_set1_epi32((int)0xFF000000);
+    const __m256i v_252 = _mm256_set1_epi32(LV_OPA_MAX - 1);
+    const __m256i v_3 = _mm256_set1_epi32(LV_OPA_MIN + 1);
+
+    uint8_t * dest_row = job->dest_buf;
+    const uint8_t * src_row = job->src_buf;
+    const lv_opa_t * mask_row = job->mask_buf;
+    int32_t y;
+    for(y = 0; y < job->dest_h; y++) {
+        lv_color32_t * dest = (lv_color32_t *)dest_row;
+        int32_t x;
+        for(x = 0; x + 8 <= job->dest_w; x += 8) {
+            __m256i bg = _mm256_loadu_si256((const __m256i *)&dest[x]);
+            /*Only opaque backgrounds are vectorized*/
+            if(_mm256_movemask_epi8(_mm256_cmpeq_epi32(_mm256_and_si256(bg, alpha_mask), alpha_mask)) != -1) {
+                argb8888_row_scalar(job, flags, dest, src_row, mask_row, x, x + 8);
+                continue;
+            }
+
+            __m256i fg = (flags & BLEND_SRC_ARGB8888) ? _mm256_loadu_si256((const __m256i *)&src_row[x * 4]) : color_v;
+            __m256i ratio = ratio_get_avx2(flags, fg, opa_v, (flags & BLEND_MASK) ? &mask_row[x] : NULL);
+            fg = _mm256_or_si256(_mm256_and_si256(fg, rgb_mask), _mm256_slli_epi32(ratio, 24));
+            __m256i res = _mm256_or_si256(mix_u8_avx2(fg, bg, ratio), alpha_mask);
+            res = select_avx2(_mm256_cmpgt_epi32(ratio, v_252), fg, res);
+            res = select_avx2(_mm256_cmpgt_epi32(v_3, ratio), bg, res);
+            _mm256_storeu_si256((__m256i *)&dest[x], res);
+        }
+        argb8888_row_scalar(job, flags, dest, src_row, mask_row, x, job->dest_w);
+
+        dest_row += job->dest_stride;
+        if(flags & BLEND_SRC_ARGB8888) src_row += job->src_stride;
+        if(flags & BLEND_MASK) mask_row += job->mask_stride;
+    }
+}
+
+#endif /*BLEND_AVX2*/
+
+/*=====================
+ * Kernels
+ *====================*/
+
+static void fill_u32(const blend_job_t * job, uint32_t color)
+{
+#if BLEND_AVX2
+    if(lv_draw_sw_blend_x86_has_avx2()) {
+        fill_u32_avx2(job, color);
+        return;
+    }
+#endif
+
+    __m128i color_v = _mm_set1_epi32((int)color);
+    uint8_t * dest_row = job->dest_buf;
+    int32_t y;
+    for(y = 0; y < job->dest_h; y++) {
+        uint32_t * dest = (uint32_t *)dest_row;
+        int32_t x;
+        for(x = 0; x + 4 <= job->dest_w; x += 4) {
+            _mm_storeu_si128((__m128i *)&dest[x], color_v);
+        }
+        for(; x < job->dest_w; x++) {
+            dest[x] = color;
+        }
+        dest_row += job->dest_stride;
+    }
+}
+
+static void fill_rgb565(const blend_job_t * job)
+{
+#if BLEND_AVX2
+    if(lv_draw_sw_blend_x86_has_avx2()) {
+        fill_rgb565_avx2(job);
+        return;
+    }
+#endif
+
+    __m128i color_v = _mm_set1_epi16((short)job->color16);
+    uint8_t * dest_row = job->dest_buf;
+    int32_t y;
+    for(y = 0; y < job->dest_h; y++) {
+        uint16_t * dest = (uint16_t *)dest_row;
+        int32_t x;
+        for(x = 0; x + 8 <= job->dest_w; x += 8) {
+            _mm_storeu_si128((__m128i *)&dest[x], color_v);
+        }
+        for(; x < job->dest_w; x++) {
+            dest[x] = job->color16;
+        }
+        dest_row += job->dest_stride;
+    }
+}
+
+static void fill_rgb888(const blend_job_t * job, uint32_t dest_px_size)
+{
+    if(dest_px_size == 4) {
+        fill_u32(job, job->color_u32);
+        return;
+    }
+
+    /*16 pixels are 48 bytes, i.e. 3 vectors with a repeating pattern*/
+    uint8_t pattern[48];
+    uint32_t i;
+    for(i = 0; i < 48; i += 3) {
+        pattern[i + 0] = job->color32.blue;
+        pattern[i + 1] = job->color32.green;
+        pattern[i + 2] = job->color32.red;
+    }
+    __m128i p0 = _mm_loadu_si128((const __m128i *)&pattern[0]);
+    __m128i p1 = _mm_loadu_si128((const __m128i *)&pattern[16]);
+    __m128i p2 = _mm_loadu_si128((const __m128i *)&pattern[32]);
+
+    uint8_t * dest_row = job->dest_buf;
+    int32_t w_bytes = job->dest_w * 3;
+    int32_t y;
+    for(y = 0; y < job->dest_h; y++) {
+        int32_t x;
+        for(x = 0; x + 48 <= w_bytes; x += 48) {
+            _mm_storeu_si128((__m128i *)&dest_row[x + 0], p0);
+            _mm_storeu_si128((__m128i *)&dest_row[x + 16], p1);
+            _mm_storeu_si128((__m128i *)&dest_row[x + 32], p2);
+        }
+        for(; x < w_bytes; x += 3) {
+            dest_row[x + 0] = job->color32.blue;
+            dest_row[x + 1] = job->color32.green;
+            dest_row[x + 2] = job->color32.red;
+        }
+        dest_row += job->dest_stride;
+    }
+}
+
+static void copy_rgb565(const blend_job_t * job)
+{
+    uint8_t * dest_row = job->dest_buf;
+    const uint8_t * src_row = job->src_buf;
+    int32_t w_bytes = job->dest_w * 2;
+    int32_t y;
+    for(y = 0; y < job->dest_h; y++) {
+        int32_t x;
+        for(x = 0; x + 16 <= w_bytes; x += 16) {
+            _mm_storeu_si128((__m128i *)&dest_row[x], _mm_loadu_si128((const __m128i *)&src_row[x]));
+        }
+        for(; x < w_bytes; x += 2) {
+            ((uint16_t *)dest_row)[x / 2] = ((const uint16_t *)src_row)[x / 2];
+        }
+        dest_row += job->dest_stride;
+        src_row += job->src_stride;
+    }
+}
+
+static void blend_to_rgb565(const blend_job_t * job, uint32_t flags)
+{
+    const __m128i opa_v = _mm_set1_epi32(job->opa);
+    const __m128i color_v = _mm_set1_epi32(job->color16);
+    const __m128i zero = _mm_setzero_si128();
+
+    uint8_t * dest_row = job->dest_buf;
+    const uint8_t * src_row = job->src_buf;
+    const lv_opa_t * mask_row = job->mask_buf;
+    int32_t y;
+    for(y = 0; y < job->dest_h; y++) {
+        uint16_t * dest = (uint16_t *)dest_row;
+        int32_t x;
+        for(x = 0; x + 4 <= job->dest_w; x += 4) {
+            __m128i bg = _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i *)&dest[x]), zero);
+            __m128i fg;
+            if(flags & BLEND_SRC_ARGB8888) fg = _mm_loadu_si128((const __m128i *)&src_row[x * 4]);
+            else if(flags & BLEND_SRC_RGB565) fg = _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i *)&src_row[x * 2]), zero);
+            else fg = color_v;
+
+            __m128i ratio = ratio_get_sse2(flags, fg, opa_v, (flags & BLEND_MASK) ? &mask_row[x] : NULL);
+            __m128i res;
+            if(flags & BLEND_SRC_ARGB8888) res = mix_24_16_sse2(fg, bg, ratio);
+            else res = mix_16_16_sse2(fg, bg, ratio);
+
+            _mm_storel_epi64((__m128i *)&dest[x], pack_u16_sse2(res));
+        }
+        rgb565_row_scalar(job, flags, dest, src_row, mask_row, x, job->dest_w);
+
+        dest_row += job->dest_stride;
+        if(flags & (BLEND_SRC_ARGB8888 | BLEND_SRC_RGB565)) src_row += job->src_stride;
+        if(flags & BLEND_MASK) mask_row += job->mask_stride;
+    }
+}
+
+static void blend_to_rgb888(const blend_job_t * job, uint32_t flags, uint32_t dest_px_size)
+{
+    uint8_t * dest_row = job->dest_buf;
+    const uint8_t * src_row = job->src_buf;
+    const lv_opa_t * mask_row = job->mask_buf;
+    int32_t y;
+
+    /*The 3 byte pixels are not aligned to the vector lanes*/
+    if(dest_px_size != 4) {
+        for(y = 0; y < job->dest_h; y++) {
+            rgb888_row_scalar(job, flags, dest_row, src_row, mask_row, 0, job->dest_w, dest_px_size);
+            dest_row += job->dest_stride;
+            if(flags & BLEND_SRC_ARGB8888) src_row += job->src_stride;
+            if(flags & BLEND_MASK) mask_row += job->mask_stride;
+        }
+        return;
+    }
+
+#if BLEND_AVX2
+    if(lv_draw_sw_blend_x86_has_avx2()) {
+        blend_to_xrgb8888_avx2(job, flags);
+        return;
+    }
+#endif
+
+    const __m128i opa_v = _mm_set1_epi32(job->opa);
+    const __m128i color_v = _mm_set1_epi32((int)job->color_u32);
+    const __m128i rgb_mask = _mm_set1_epi32(0x00FFFFFF);
+    const __m128i x_mask = _mm_set1_epi32((int)0xFF000000);
+    const __m128i v_252 = _mm_set1_epi32(LV_OPA_MAX - 1);
+    const __m128i zero = _mm_setzero_si128();
+
+    for(y = 0; y < job->dest_h; y++) {
+        int32_t x;
+        for(x = 0; x + 4 <= job->dest_w; x += 4) {
+            __m128i fg = (flags & BLEND_SRC_ARGB8888) ? _mm_loadu_si128((const __m128i *)&src_row[x * 4]) : color_v;
+            __m128i ratio = ratio_get_sse2(flags, fg, opa_v, (flags & BLEND_MASK) ? &mask_row[x] : NULL);
+            __m128i bg = _mm_loadu_si128((const __m128i *)&dest_row[x * 4]);
+
+            /*The X byte of the destination is never changed*/
+            __m128i bg_x = _mm_and_si128(bg, x_mask);
+            __m128i fg_rgb = _mm_or_si128(_mm_and_si128(fg, rgb_mask), bg_x);
+            __m128i res = _mm_or_si128(_mm_and_si128(mix_u8_sse2(fg, bg, ratio), rgb_mask), bg_x);
+            res = select_sse2(_mm_cmpgt_epi32(ratio, v_252), fg_rgb, res);
+            res = select_sse2(_mm_cmpeq_epi32(ratio, zero), bg, res);
+            _mm_storeu_si128((__m128i *)&dest_row[x * 4], res);
+        }
+        rgb888_row_scalar(job, flags, dest_row, src_row, mask_row, x, job->dest_w, 4);
+
+        dest_row += job->dest_stride;
+        if(flags & BLEND_SRC_ARGB8888) src_row += job->src_stride;
+        if(flags & BLEND_MASK) mask_row += job->mask_stride;
+    }
+}
+
+static void blend_to_argb8888(const blend_job_t * job, uint32_t flags)
+{
+#if BLEND_AVX2
+    if(lv_draw_sw_blend_x86_has_avx2()) {
+        blend_to_argb8888_avx2(job, flags);
+        return;
+    }
+#endif
+
+    const __m128i opa_v = _mm_set1_epi32(job->opa);
+    const __m128i color_v = _mm_set1_epi32((int)job->color_u32);
+    const __m128i rgb_mask = _mm_set1_epi32(0x00FFFFFF);
+    const __m128i alpha_mask = _mm_set1_epi32((int)0xFF000000);
+    const __m128i v_252 = _mm_set1_epi32(LV_OPA_MAX - 1);
+    const __m128i v_3 = _mm_set1_epi32(LV_OPA_MIN + 1);
+
+    uint8_t * dest_row = job->dest_buf;
+    const uint8_t * src_row = job->src_buf;
+    const lv_opa_t * mask_row = job->mask_buf;
+    int32_t y;
+    for(y = 0; y < job->dest_h; y++) {
+        lv_color32_t * dest = (lv_color32_t *)dest_row;
+        int32_t x;
+        for(x = 0; x + 4 <= job->dest_w; x += 4) {
+            __m128i bg = _mm_loadu_si128((const __m128i *)&dest[x]);
+            /*Only opaque backgrounds are vectorized, else the result alpha needs a division*/
+            if(_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(bg, alpha_mask), alpha_mask)) != 0xFFFF) {
+                argb8888_row_scalar(job, flags, dest, src_row, mask_row, x, x + 4);
+                continue;
+            }
+
+            __m128i fg = (flags & BLEND_SRC_ARGB8888) ? _mm_loadu_si128((const __m128i *)&src_row[x * 4]) : color_v;
+            __m128i ratio = ratio_get_sse2(flags, fg, opa_v, (flags & BLEND_MASK) ? &mask_row[x] : NULL);
+
+            /*An (almost) opaque foreground is used as it is, with its own alpha*/
+            fg = _mm_or_si128(_mm_and_si128(fg, rgb_mask), _mm_slli_epi32(ratio, 24));
+            __m128i res = _mm_or_si128(mix_u8_sse2(fg, bg, ratio), alpha_mask);
+            res = select_sse2(_mm_cmpgt_epi32(ratio, v_252), fg, res);
+            res = select_sse2(_mm_cmplt_epi32(ratio, v_3), bg, res);
+            _mm_storeu_si128((__m128i *)&dest[x], res);
+        }
+        argb8888_row_scalar(job, flags, dest, src_row, mask_row, x, job->dest_w);
+
+        dest_row += job->dest_stride;
+        if(flags & BLEND_SRC_ARGB8888) src_row += job->src_stride;
+        if(flags & BLEND_MASK) mask_row += job->mask_stride;
+    }
+}
+
+#endif /*LV_USE_DRAW_SW && (LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_SSE2 || LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_AVX2)*/
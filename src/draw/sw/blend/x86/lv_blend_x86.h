@@ -0,0 +1,179 @@
+/**
+ * @file lv_blend_x86.h
+ *
+ */
+
+#ifndef LV_BLEND_X86_H
+#define LV_BLEND_X86_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../../../lv_conf_internal.h"
+
+#if (LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_SSE2 || LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_AVX2) && !defined(__ASSEMBLY__)
+
+#include "../lv_draw_sw_blend.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565(dsc) \
+    _lv_color_blend_to_rgb565_x86(dsc)
+
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_OPA(dsc) \
+    _lv_color_blend_to_rgb565_with_opa_x86(dsc)
+
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_MASK(dsc) \
+    _lv_color_blend_to_rgb565_with_mask_x86(dsc)
+
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565_MIX_MASK_OPA(dsc) \
+    _lv_color_blend_to_rgb565_mix_mask_opa_x86(dsc)
+
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565(dsc)  \
+    _lv_rgb565_blend_normal_to_rgb565_x86(dsc)
+
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc)  \
+    _lv_rgb565_blend_normal_to_rgb565_with_opa_x86(dsc)
+
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc)  \
+    _lv_rgb565_blend_normal_to_rgb565_with_mask_x86(dsc)
+
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(dsc)  \
+    _lv_rgb565_blend_normal_to_rgb565_mix_mask_opa_x86(dsc)
+
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565(dsc)  \
+    _lv_argb8888_blend_normal_to_rgb565_x86(dsc)
+
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc)  \
+    _lv_argb8888_blend_normal_to_rgb565_with_opa_x86(dsc)
+
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc)  \
+    _lv_argb8888_blend_normal_to_rgb565_with_mask_x86(dsc)
+
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(dsc)  \
+    _lv_argb8888_blend_normal_to_rgb565_mix_mask_opa_x86(dsc)
+
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB888(dsc, dst_px_size) \
+    _lv_color_blend_to_rgb888_x86(dsc, dst_px_size)
+
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB888_WITH_OPA(dsc, dst_px_size) \
+    _lv_color_blend_to_rgb888_with_opa_x86(dsc, dst_px_size)
+
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB888_WITH_MASK(dsc, dst_px_size) \
+    _lv_color_blend_to_rgb888_with_mask_x86(dsc, dst_px_size)
+
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB888_MIX_MASK_OPA(dsc, dst_px_size) \
+    _lv_color_blend_to_rgb888_mix_mask_opa_x86(dsc, dst_px_size)
+
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB888(dsc, dst_px_size)  \
+    _lv_argb8888_blend_normal_to_rgb888_x86(dsc, dst_px_size)
+
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB888_WITH_OPA(dsc, dst_px_size)  \
+    _lv_argb8888_blend_normal_to_rgb888_with_opa_x86(dsc, dst_px_size)
+
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB888_WITH_MASK(dsc, dst_px_size)  \
+    _lv_argb8888_blend_normal_to_rgb888_with_mask_x86(dsc, dst_px_size)
+
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB888_MIX_MASK_OPA(dsc, dst_px_size)  \
+    _lv_argb8888_blend_normal_to_rgb888_mix_mask_opa_x86(dsc, dst_px_size)
+
+#define LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888(dsc) \
+    _lv_color_blend_to_argb8888_x86(dsc)
+
+#define LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888_WITH_OPA(dsc) \
+    _lv_color_blend_to_argb8888_with_opa_x86(dsc)
+
+#define LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888_WITH_MASK(dsc) \
+    _lv_color_blend_to_argb8888_with_mask_x86(dsc)
+
+#define LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888_MIX_MASK_OPA(dsc) \
+    _lv_color_blend_to_argb8888_mix_mask_opa_x86(dsc)
+
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888(dsc)  \
+    _lv_argb8888_blend_normal_to_argb8888_x86(dsc)
+
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888_WITH_OPA(dsc)  \
+    _lv_argb8888_blend_normal_to_argb8888_with_opa_x86(dsc)
+
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888_WITH_MASK(dsc)  \
+    _lv_argb8888_blend_normal_to_argb8888_with_mask_x86(dsc)
+
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888_MIX_MASK_OPA(dsc)  \
+    _lv_argb8888_blend_normal_to_argb8888_mix_mask_opa_x86(dsc)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Tell whether the AVX2 kernels are used.
+ * It's decided at runtime by checking the features of the CPU.
+ * With `LV_DRAW_SW_ASM_SSE2` it always returns `false`.
+ * @return      true: the AVX2 kernels are used; false: the SSE2 kernels are used
+ */
+bool lv_draw_sw_blend_x86_has_avx2(void);
+
+/**
+ * Allow or forbid using the AVX2 kernels. E.g. to test or measure the SSE2 kernels on an AVX2 capable CPU.
+ * The AVX2 kernels are allowed by default, but used only if the CPU supports them.
+ * @param en    true: use AVX2 if supported; false: use only SSE2
+ */
+void lv_draw_sw_blend_x86_enable_avx2(bool en);
+
+void _lv_color_blend_to_rgb565_x86(_lv_draw_sw_blend_fill_dsc_t * dsc);
+void _lv_color_blend_to_rgb565_with_opa_x86(_lv_draw_sw_blend_fill_dsc_t * dsc);
+void _lv_color_blend_to_rgb565_with_mask_x86(_lv_draw_sw_blend_fill_dsc_t * dsc);
+void _lv_color_blend_to_rgb565_mix_mask_opa_x86(_lv_draw_sw_blend_fill_dsc_t * dsc);
+
+void _lv_rgb565_blend_normal_to_rgb565_x86(_lv_draw_sw_blend_image_dsc_t * dsc);
+void _lv_rgb565_blend_normal_to_rgb565_with_opa_x86(_lv_draw_sw_blend_image_dsc_t * dsc);
+void _lv_rgb565_blend_normal_to_rgb565_with_mask_x86(_lv_draw_sw_blend_image_dsc_t * dsc);
+void _lv_rgb565_blend_normal_to_rgb565_mix_mask_opa_x86(_lv_draw_sw_blend_image_dsc_t * dsc);
+
+void _lv_argb8888_blend_normal_to_rgb565_x86(_lv_draw_sw_blend_image_dsc_t * dsc);
+void _lv_argb8888_blend_normal_to_rgb565_with_opa_x86(_lv_draw_sw_blend_image_dsc_t * dsc);
+void _lv_argb8888_blend_normal_to_rgb565_with_mask_x86(_lv_draw_sw_blend_image_dsc_t * dsc);
+void _lv_argb8888_blend_normal_to_rgb565_mix_mask_opa_x86(_lv_draw_sw_blend_image_dsc_t * dsc);
+
+void _lv_color_blend_to_rgb888_x86(_lv_draw_sw_blend_fill_dsc_t * dsc, uint32_t dst_px_size);
+void _lv_color_blend_to_rgb888_with_opa_x86(_lv_draw_sw_blend_fill_dsc_t * dsc, uint32_t dst_px_size);
+void _lv_color_blend_to_rgb888_with_mask_x86(_lv_draw_sw_blend_fill_dsc_t * dsc, uint32_t dst_px_size);
+void _lv_color_blend_to_rgb888_mix_mask_opa_x86(_lv_draw_sw_blend_fill_dsc_t * dsc, uint32_t dst_px_size);
+
+void _lv_argb8888_blend_normal_to_rgb888_x86(_lv_draw_sw_blend_image_dsc_t * dsc, uint32_t dst_px_size);
+void _lv_argb8888_blend_normal_to_rgb888_with_opa_x86(_lv_draw_sw_blend_image_dsc_t * dsc, uint32_t dst_px_size);
+void _lv_argb8888_blend_normal_to_rgb888_with_mask_x86(_lv_draw_sw_blend_image_dsc_t * dsc, uint32_t dst_px_size);
+void _lv_argb8888_blend_normal_to_rgb888_mix_mask_opa_x86(_lv_draw_sw_blend_image_dsc_t * dsc, uint32_t dst_px_size);
+
+void _lv_color_blend_to_argb8888_x86(_lv_draw_sw_blend_fill_dsc_t * dsc);
+void _lv_color_blend_to_argb8888_with_opa_x86(_lv_draw_sw_blend_fill_dsc_t * dsc);
+void _lv_color_blend_to_argb8888_with_mask_x86(_lv_draw_sw_blend_fill_dsc_t * dsc);
+void _lv_color_blend_to_argb8888_mix_mask_opa_x86(_lv_draw_sw_blend_fill_dsc_t * dsc);
+
+void _lv_argb8888_blend_normal_to_argb8888_x86(_lv_draw_sw_blend_image_dsc_t * dsc);
+void _lv_argb8888_blend_normal_to_argb8888_with_opa_x86(_lv_draw_sw_blend_image_dsc_t * dsc);
+void _lv_argb8888_blend_normal_to_argb8888_with_mask_x86(_lv_draw_sw_blend_image_dsc_t * dsc);
+void _lv_argb8888_blend_normal_to_argb8888_mix_mask_opa_x86(_lv_draw_sw_blend_image_dsc_t * dsc);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*(LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_SSE2 || LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_AVX2) && !defined(__ASSEMBLY__)*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_BLEND_X86_H*/
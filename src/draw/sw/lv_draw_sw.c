@@ -44,6 +44,16 @@ static int32_t dispatch(lv_draw_unit_t * draw_unit, lv_layer_t * layer);
 static int32_t evaluate(lv_draw_unit_t * draw_unit, lv_draw_task_t * task);
 static int32_t lv_draw_sw_delete(lv_draw_unit_t * draw_unit);
 
+#if LV_DRAW_SW_TASK_BATCH_CNT > 1
+    static void batch_take(lv_draw_sw_unit_t * u, lv_layer_t * layer, lv_draw_task_t * t);
+    static bool batch_next(lv_draw_sw_unit_t * u);
+#endif
+#if LV_DRAW_SW_BAND_HEIGHT
+    static void band_job_start(lv_draw_sw_unit_t * u, lv_layer_t * layer, lv_draw_task_t * t);
+    static bool band_job_join(lv_draw_sw_unit_t * u, lv_layer_t * layer);
+    static bool band_job_next(lv_draw_sw_unit_t * u, bool * task_ready);
+#endif
+
 static void rotate90_argb8888(const uint32_t * src, uint32_t * dst, int32_t srcWidth, int32_t srcHeight,
                               int32_t srcStride,
                               int32_t dstStride);
@@ -71,6 +81,7 @@ static void rotate270_rgb565(const uint16_t * src, uint16_t * dst, int32_t srcWi
  *  STATIC VARIABLES
  **********************/
 #define _draw_info LV_GLOBAL_DEFAULT()->draw_info
+#define _band_job LV_GLOBAL_DEFAULT()->sw_band_job
 
 /**********************
  *      MACROS
@@ -87,6 +98,19 @@ void lv_draw_sw_init(void)
     lv_draw_sw_mask_init();
 #endif
 
+#if LV_DRAW_SW_BAND_HEIGHT
+    lv_memzero(&_band_job, sizeof(_band_job));
+    lv_mutex_init(&_band_job.mutex);
+#endif
+
+#if LV_DRAW_SW_GRADIENT_CACHE_CNT > 0
+    _lv_gradient_cache_init();
+#endif
+
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+    _lv_draw_sw_shadow_cache_init();
+#endif
+
     uint32_t i;
     for(i = 0; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
         lv_draw_sw_unit_t * draw_sw_unit = lv_draw_create_unit(sizeof(lv_draw_sw_unit_t));
@@ -114,6 +138,18 @@ void lv_draw_sw_deinit(void)
 #if LV_DRAW_SW_COMPLEX == 1
     lv_draw_sw_mask_deinit();
 #endif
+
+#if LV_DRAW_SW_BAND_HEIGHT
+    lv_mutex_delete(&_band_job.mutex);
+#endif
+
+#if LV_DRAW_SW_GRADIENT_CACHE_CNT > 0
+    _lv_gradient_cache_deinit();
+#endif
+
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+    _lv_draw_sw_shadow_cache_deinit();
+#endif
 }
 
 static int32_t lv_draw_sw_delete(lv_draw_unit_t * draw_unit)
@@ -194,7 +230,33 @@ static inline void execute_drawing_unit(lv_draw_sw_unit_t * u)
 {
     execute_drawing(u);
 
+#if LV_DRAW_SW_BAND_HEIGHT
+    if(u->base_unit.clip_area == &u->band_clip_area) {
+        /*Keep drawing the remaining bands of the task without waiting for the dispatcher*/
+        bool task_ready = false;
+        while(band_job_next(u, &task_ready)) {
+            execute_drawing(u);
+        }
+
+        /*Other units are still drawing bands of this task*/
+        if(!task_ready) {
+            u->task_act = NULL;
+            lv_draw_dispatch_request();
+            return;
+        }
+    }
+#endif
+
     u->task_act->state = LV_DRAW_TASK_STATE_READY;
+
+#if LV_DRAW_SW_TASK_BATCH_CNT > 1
+    /*Draw the rest of the batch. The dispatcher is needed only when the unit gets idle.*/
+    while(batch_next(u)) {
+        execute_drawing(u);
+        u->task_act->state = LV_DRAW_TASK_STATE_READY;
+    }
+#endif
+
     u->task_act = NULL;
 
     /*The draw unit is free now. Request a new dispatching as it can get a new task*/
@@ -205,21 +267,6 @@ static int32_t evaluate(lv_draw_unit_t * draw_unit, lv_draw_task_t * task)
 {
     LV_UNUSED(draw_unit);
 
-    switch(task->type) {
-        case LV_DRAW_TASK_TYPE_IMAGE:
-        case LV_DRAW_TASK_TYPE_LAYER: {
-                lv_draw_image_dsc_t * draw_dsc = task->draw_dsc;
-
-                /* not support skew */
-                if(draw_dsc->skew_x != 0 || draw_dsc->skew_y != 0) {
-                    return 0;
-                }
-            }
-            break;
-        default:
-            break;
-    }
-
     if(task->preference_score >= 100) {
         task->preference_score = 100;
         task->preferred_draw_unit_id = DRAW_UNIT_ID_SW;
@@ -239,6 +286,19 @@ static int32_t dispatch(lv_draw_unit_t * draw_unit, lv_layer_t * layer)
         return 0;
     }
 
+#if LV_DRAW_SW_BAND_HEIGHT
+    /*Help the other units to draw the bands of a large task*/
+    if(band_job_join(draw_sw_unit, layer)) {
+#if LV_USE_OS
+        if(draw_sw_unit->inited) lv_thread_sync_signal(&draw_sw_unit->sync);
+#else
+        execute_drawing_unit(draw_sw_unit);
+#endif
+        LV_PROFILER_END;
+        return 1;
+    }
+#endif
+
     lv_draw_task_t * t = NULL;
     t = lv_draw_get_next_available_task(layer, NULL, DRAW_UNIT_ID_SW);
     if(t == NULL) {
@@ -255,6 +315,16 @@ static int32_t dispatch(lv_draw_unit_t * draw_unit, lv_layer_t * layer)
     t->state = LV_DRAW_TASK_STATE_IN_PROGRESS;
     draw_sw_unit->base_unit.target_layer = layer;
     draw_sw_unit->base_unit.clip_area = &t->clip_area;
+
+#if LV_DRAW_SW_BAND_HEIGHT
+    band_job_start(draw_sw_unit, layer, t);
+#endif
+
+#if LV_DRAW_SW_TASK_BATCH_CNT > 1
+    batch_take(draw_sw_unit, layer, t);
+#endif
+
+    /*Set it last as the render thread starts drawing when it sees `task_act`*/
     draw_sw_unit->task_act = t;
 
 #if LV_USE_OS
@@ -297,6 +367,192 @@ static void render_thread_cb(void * ptr)
 }
 #endif
 
+#if LV_DRAW_SW_TASK_BATCH_CNT > 1
+
+/**
+ * Take more independent tasks after `t` to draw them without dispatching.
+ * Nothing is taken if an other SW draw unit is idle and can get these tasks in this dispatch round.
+ * @param u         pointer to a draw unit which has just taken `t`
+ * @param layer     the layer of `t`
+ * @param t         the task taken by `u`
+ */
+static void batch_take(lv_draw_sw_unit_t * u, lv_layer_t * layer, lv_draw_task_t * t)
+{
+    u->task_batch_cnt = 0;
+    u->task_batch_next = 0;
+
+#if LV_DRAW_SW_BAND_HEIGHT
+    /*The other units will help to draw the bands of `t` instead*/
+    if(u->base_unit.clip_area == &u->band_clip_area) return;
+#endif
+
+    /*The units are dispatched in list order so only the next units can take tasks in this round*/
+    lv_draw_unit_t * other = u->base_unit.next;
+    while(other) {
+        if(other->dispatch_cb == dispatch && ((lv_draw_sw_unit_t *)other)->task_act == NULL) return;
+        other = other->next;
+    }
+
+    while(u->task_batch_cnt < LV_DRAW_SW_TASK_BATCH_CNT - 1) {
+        t = lv_draw_get_next_available_task(layer, t, DRAW_UNIT_ID_SW);
+        if(t == NULL) break;
+
+        t->state = LV_DRAW_TASK_STATE_IN_PROGRESS;
+        u->task_batch[u->task_batch_cnt] = t;
+        u->task_batch_cnt++;
+    }
+}
+
+/**
+ * Make the next task of the batch the active task
+ * @param u         pointer to a draw unit which finished its active task
+ * @return          true: `task_act` is set to the next task; false: the batch is drawn
+ */
+static bool batch_next(lv_draw_sw_unit_t * u)
+{
+    if(u->task_batch_next >= u->task_batch_cnt) return false;
+
+    lv_draw_task_t * t = u->task_batch[u->task_batch_next];
+    u->task_batch_next++;
+    u->base_unit.clip_area = &t->clip_area;
+    u->task_act = t;
+    return true;
+}
+
+#endif /*LV_DRAW_SW_TASK_BATCH_CNT > 1*/
+
+#if LV_DRAW_SW_BAND_HEIGHT
+
+/**
+ * Start drawing a task in bands if it's large enough and no other task is drawn in bands.
+ * If started, the clip area of the draw unit is limited to the first band.
+ * @param u         pointer to a draw unit which has just taken `t`
+ * @param layer     the layer of `t`
+ * @param t         the task to draw
+ */
+static void band_job_start(lv_draw_sw_unit_t * u, lv_layer_t * layer, lv_draw_task_t * t)
+{
+    if(t->type != LV_DRAW_TASK_TYPE_FILL && t->type != LV_DRAW_TASK_TYPE_IMAGE && t->type != LV_DRAW_TASK_TYPE_LAYER) {
+        return;
+    }
+
+    /*Find the rows where the task really draws*/
+    lv_area_t draw_area = t->area;
+    if(t->type == LV_DRAW_TASK_TYPE_IMAGE || t->type == LV_DRAW_TASK_TYPE_LAYER) {
+        const lv_draw_image_dsc_t * draw_dsc = t->draw_dsc;
+        if(draw_dsc->tile) {
+            draw_area = t->clip_area;
+        }
+        else if(draw_dsc->rotation || draw_dsc->scale_x != LV_SCALE_NONE || draw_dsc->scale_y != LV_SCALE_NONE ||
+                draw_dsc->skew_x || draw_dsc->skew_y) {
+            int32_t w = lv_area_get_width(&t->area);
+            int32_t h = lv_area_get_height(&t->area);
+            _lv_image_buf_get_transformed_area(&draw_area, w, h, draw_dsc->rotation, draw_dsc->scale_x, draw_dsc->scale_y,
+                                               draw_dsc->skew_x, draw_dsc->skew_y, &draw_dsc->pivot);
+            lv_area_move(&draw_area, t->area.x1, t->area.y1);
+        }
+    }
+
+    if(!_lv_area_intersect(&draw_area, &draw_area, &t->clip_area)) return;
+
+    /*Not worth splitting into bands*/
+    if(lv_area_get_height(&draw_area) < 2 * LV_DRAW_SW_BAND_HEIGHT) return;
+
+    /*Only the dispatcher starts band jobs so the job remains free while the image is decoded*/
+    lv_mutex_lock(&_band_job.mutex);
+    bool busy = _band_job.task != NULL;
+    lv_mutex_unlock(&_band_job.mutex);
+    if(busy) return;
+
+    /*Decode the image only once, all the bands are drawn from the same decoded data*/
+    _band_job.decoded = false;
+    if(t->type == LV_DRAW_TASK_TYPE_IMAGE) {
+        const lv_draw_image_dsc_t * draw_dsc = t->draw_dsc;
+        if(lv_image_decoder_open(&_band_job.decoder_dsc, draw_dsc->src, NULL) != LV_RESULT_OK) return;
+
+        /*Images decoded in pieces can't be shared by the draw units*/
+        if(_band_job.decoder_dsc.decoded == NULL && _band_job.decoder_dsc.img_data == NULL) {
+            lv_image_decoder_close(&_band_job.decoder_dsc);
+            return;
+        }
+        _band_job.decoded = true;
+    }
+
+    lv_mutex_lock(&_band_job.mutex);
+    _band_job.task = t;
+    _band_job.layer = layer;
+    _band_job.next_y = draw_area.y1 + LV_DRAW_SW_BAND_HEIGHT;
+    _band_job.last_y = draw_area.y2;
+    _band_job.running_cnt = 1;
+
+    u->band_clip_area = t->clip_area;
+    u->band_clip_area.y1 = draw_area.y1;
+    u->band_clip_area.y2 = draw_area.y1 + LV_DRAW_SW_BAND_HEIGHT - 1;
+    u->base_unit.clip_area = &u->band_clip_area;
+    lv_mutex_unlock(&_band_job.mutex);
+}
+
+/**
+ * Take a band of the task being drawn in bands
+ * @param u         pointer to an idle draw unit
+ * @param layer     the layer being dispatched
+ * @return          true: a band was assigned to `u`
+ */
+static bool band_job_join(lv_draw_sw_unit_t * u, lv_layer_t * layer)
+{
+    bool joined = false;
+    lv_mutex_lock(&_band_job.mutex);
+    if(_band_job.task && _band_job.layer == layer && _band_job.next_y <= _band_job.last_y) {
+        _band_job.running_cnt++;
+        u->task_act = _band_job.task;
+        u->base_unit.target_layer = layer;
+        u->band_clip_area = _band_job.task->clip_area;
+        u->band_clip_area.y1 = _band_job.next_y;
+        u->band_clip_area.y2 = LV_MIN(_band_job.next_y + LV_DRAW_SW_BAND_HEIGHT - 1, _band_job.last_y);
+        u->base_unit.clip_area = &u->band_clip_area;
+        _band_job.next_y += LV_DRAW_SW_BAND_HEIGHT;
+        joined = true;
+    }
+    lv_mutex_unlock(&_band_job.mutex);
+
+    return joined;
+}
+
+/**
+ * Take the next band after a draw unit finished its band
+ * @param u             pointer to a draw unit drawing a band
+ * @param task_ready    set to true if there are no bands left and `u` finished the last running band
+ * @return              true: a new band was assigned to `u`; false: no bands left
+ */
+static bool band_job_next(lv_draw_sw_unit_t * u, bool * task_ready)
+{
+    bool has_band = false;
+    lv_mutex_lock(&_band_job.mutex);
+    if(_band_job.next_y <= _band_job.last_y) {
+        u->band_clip_area.y1 = _band_job.next_y;
+        u->band_clip_area.y2 = LV_MIN(_band_job.next_y + LV_DRAW_SW_BAND_HEIGHT - 1, _band_job.last_y);
+        _band_job.next_y += LV_DRAW_SW_BAND_HEIGHT;
+        has_band = true;
+    }
+    else {
+        _band_job.running_cnt--;
+        if(_band_job.running_cnt == 0) {
+            if(_band_job.decoded) {
+                lv_image_decoder_close(&_band_job.decoder_dsc);
+                _band_job.decoded = false;
+            }
+            _band_job.task = NULL;
+            _band_job.layer = NULL;
+            *task_ready = true;
+        }
+    }
+    lv_mutex_unlock(&_band_job.mutex);
+
+    return has_band;
+}
+
+#endif /*LV_DRAW_SW_BAND_HEIGHT*/
+
 static void execute_drawing(lv_draw_sw_unit_t * u)
 {
     LV_PROFILER_BEGIN;
@@ -316,6 +572,12 @@ static void execute_drawing(lv_draw_sw_unit_t * u)
             lv_draw_sw_label((lv_draw_unit_t *)u, t->draw_dsc, &t->area);
             break;
         case LV_DRAW_TASK_TYPE_IMAGE:
+#if LV_DRAW_SW_BAND_HEIGHT
+            if(u->base_unit.clip_area == &u->band_clip_area && _band_job.decoded) {
+                lv_draw_sw_image_decoded((lv_draw_unit_t *)u, t->draw_dsc, &_band_job.decoder_dsc, &t->area);
+                break;
+            }
+#endif
             lv_draw_sw_image((lv_draw_unit_t *)u, t->draw_dsc, &t->area);
             break;
         case LV_DRAW_TASK_TYPE_ARC:
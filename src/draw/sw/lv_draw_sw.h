@@ -18,6 +18,7 @@ extern "C" {
 
 #include "../../misc/lv_area.h"
 #include "../../misc/lv_color.h"
+#include "../../misc/lv_lru_rb.h"
 #include "../../display/lv_display.h"
 #include "../../osal/lv_os.h"
 
@@ -41,13 +42,41 @@ typedef struct {
     volatile bool exit_status;
 #endif
     uint32_t idx;
+#if LV_DRAW_SW_BAND_HEIGHT
+    /** The clip area of `task_act` limited to the band being drawn by this unit*/
+    lv_area_t band_clip_area;
+#endif
+#if LV_DRAW_SW_TASK_BATCH_CNT > 1
+    /** Tasks taken together with `task_act`. They are drawn after `task_act` without dispatching.*/
+    struct _lv_draw_task_t * task_batch[LV_DRAW_SW_TASK_BATCH_CNT - 1];
+    uint32_t task_batch_cnt;
+    uint32_t task_batch_next;
+#endif
 } lv_draw_sw_unit_t;
 
+#if LV_DRAW_SW_BAND_HEIGHT
+/**
+ * A draw task whose bands are drawn by several SW draw units in parallel.
+ * The draw units take the next band themselves when they finish one.
+ */
+typedef struct {
+    lv_draw_task_t * task;      /**< The task being drawn in bands or NULL*/
+    lv_layer_t * layer;         /**< The layer of `task`*/
+    int32_t next_y;             /**< The first row of the next band to draw*/
+    int32_t last_y;             /**< The last row to draw*/
+    uint32_t running_cnt;       /**< Number of bands being drawn now*/
+    lv_image_decoder_dsc_t decoder_dsc; /**< The decoded image of an image task, shared by all the bands*/
+    bool decoded;               /**< `decoder_dsc` is opened*/
+    lv_mutex_t mutex;
+} lv_draw_sw_band_job_t;
+#endif
+
 #if LV_DRAW_SW_SHADOW_CACHE_SIZE
 typedef struct {
-    uint8_t cache[LV_DRAW_SW_SHADOW_CACHE_SIZE * LV_DRAW_SW_SHADOW_CACHE_SIZE];
-    int32_t cache_size;
-    int32_t cache_r;
+    lv_lru_rb_t * lru;      /**< The blurred corners by shadow width, radius and size*/
+    lv_mutex_t lock;        /**< The draw units can read the same corners in parallel*/
+    uint32_t hit_cnt;       /**< Number of corners found in the cache*/
+    uint32_t miss_cnt;      /**< Number of corners calculated as they were not found in the cache*/
 } lv_draw_sw_shadow_cache_t;
 #endif
 
@@ -90,6 +119,27 @@ void lv_draw_sw_border(lv_draw_unit_t * draw_unit, const lv_draw_border_dsc_t *
  */
 void lv_draw_sw_box_shadow(lv_draw_unit_t * draw_unit, const lv_draw_box_shadow_dsc_t * dsc, const lv_area_t * coords);
 
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+
+/**
+ * Initialize the shadow corner cache. Called by `lv_draw_sw_init()`.
+ */
+void _lv_draw_sw_shadow_cache_init(void);
+
+/**
+ * Drop the cached shadow corners and free the cache. Called by `lv_draw_sw_deinit()`.
+ */
+void _lv_draw_sw_shadow_cache_deinit(void);
+
+/**
+ * Get the number of shadow corners found and not found in the cache
+ * @param hit_cnt   store the number of hits here. Can be NULL.
+ * @param miss_cnt  store the number of misses here. Can be NULL.
+ */
+void lv_draw_sw_shadow_cache_get_counters(uint32_t * hit_cnt, uint32_t * miss_cnt);
+
+#endif /*LV_DRAW_SW_SHADOW_CACHE_SIZE*/
+
 /**
  * Draw an image with SW render. It handles image decoding, tiling, transformations, and recoloring.
  * @param draw_unit     pointer to a draw unit
@@ -99,6 +149,16 @@ void lv_draw_sw_box_shadow(lv_draw_unit_t * draw_unit, const lv_draw_box_shadow_
 void lv_draw_sw_image(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t * draw_dsc,
                       const lv_area_t * coords);
 
+/**
+ * Draw an image with SW render using an already opened decoder
+ * @param draw_unit     pointer to a draw unit
+ * @param dsc           the draw descriptor
+ * @param decoder_dsc   the decoder opened for `dsc->src`
+ * @param coords        the coordinates of the image
+ */
+void lv_draw_sw_image_decoded(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t * draw_dsc,
+                              lv_image_decoder_dsc_t * decoder_dsc, const lv_area_t * coords);
+
 /**
  * Draw a label with SW render.
  * @param draw_unit     pointer to a draw unit
@@ -154,7 +214,8 @@ void lv_draw_sw_mask_rect(lv_draw_unit_t * draw_unit, const lv_draw_mask_rect_ds
  * @param src_h         source buffer height in pixels
  * @param src_stride    source buffer stride in bytes
  * @param dsc           the draw descriptor
- * @param sup           supplementary data
+ * @param sup           supplementary data. If `sup->mip_level > 0` `src_buf` is a downscaled copy of the image
+ *                      and `src_w`, `src_h` and `src_stride` describe the copy.
  * @param cf            color format of the source buffer
  * @param dest_buf      the destination buffer
  */
@@ -162,6 +223,28 @@ void lv_draw_sw_transform(lv_draw_unit_t * draw_unit, const lv_area_t * dest_are
                           int32_t src_w, int32_t src_h, int32_t src_stride,
                           const lv_draw_image_dsc_t * draw_dsc, const lv_draw_image_sup_t * sup, lv_color_format_t cf, void * dest_buf);
 
+#if LV_DRAW_SW_IMAGE_MIPMAP
+/**
+ * Get which downscaled copy of an image to sample for a given scale
+ * @param header        header of the decoded image
+ * @param scale_x       horizontal scale (256: 100%)
+ * @param scale_y       vertical scale (256: 100%)
+ * @return              0: use the original image, 1: use the half sized copy, 2: the quarter sized, etc.
+ */
+uint32_t lv_draw_sw_mipmap_get_level(const lv_image_header_t * header, int32_t scale_x, int32_t scale_y);
+
+/**
+ * Get a downscaled copy of a decoded image from the image cache. Generate and cache it if it's not there yet.
+ * The copies are stored with the same source as the image so they are invalidated together with it.
+ * @param decoder_dsc   an opened image. It needs to be stored in the image cache (`cache_entry != NULL`)
+ * @param level         1: half size, 2: quarter size, etc.
+ * @param cache_entry   store the cache entry of the copy here. Release it with `lv_cache_release()` when not used anymore.
+ * @return              the downscaled copy or NULL if the color format is not supported or out of memory
+ */
+const lv_draw_buf_t * lv_draw_sw_mipmap_get(const lv_image_decoder_dsc_t * decoder_dsc, uint32_t level,
+                                            lv_cache_entry_t ** cache_entry);
+#endif /*LV_DRAW_SW_IMAGE_MIPMAP*/
+
 #if LV_USE_VECTOR_GRAPHIC
 /**
  * Draw vector graphics with SW render.
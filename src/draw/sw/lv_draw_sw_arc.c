@@ -109,7 +109,7 @@ void lv_draw_sw_arc(lv_draw_unit_t * draw_unit, const lv_draw_arc_dsc_t * dsc, c
     int32_t blend_h = lv_area_get_height(&clipped_area);
     int32_t blend_w = lv_area_get_width(&clipped_area);
     int32_t h;
-    lv_opa_t * mask_buf = lv_malloc(blend_w);
+    lv_opa_t * mask_buf = lv_draw_arena_alloc(draw_unit, blend_w);
 
     lv_area_t blend_area = clipped_area;
     lv_area_t img_area;
@@ -140,7 +140,7 @@ void lv_draw_sw_arc(lv_draw_unit_t * draw_unit, const lv_draw_arc_dsc_t * dsc, c
     lv_area_t round_area_1;
     lv_area_t round_area_2;
     if(dsc->rounded) {
-        circle_mask = lv_malloc(width * width);
+        circle_mask = lv_draw_arena_alloc(draw_unit, width * width);
         lv_memset(circle_mask, 0xff, width * width);
         lv_area_t circle_area = {0, 0, width - 1, width - 1};
         lv_draw_sw_mask_radius_param_t circle_mask_param;
@@ -197,8 +197,8 @@ void lv_draw_sw_arc(lv_draw_unit_t * draw_unit, const lv_draw_arc_dsc_t * dsc, c
         lv_draw_sw_mask_free_param(&mask_in_param);
     }
 
-    lv_free(mask_buf);
-    if(circle_mask) lv_free(circle_mask);
+    lv_draw_arena_free(draw_unit, mask_buf);
+    if(circle_mask) lv_draw_arena_free(draw_unit, circle_mask);
 #else
     LV_LOG_WARN("Can't draw arc with LV_DRAW_SW_COMPLEX == 0");
     LV_UNUSED(center);
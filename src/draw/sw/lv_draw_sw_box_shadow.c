@@ -15,6 +15,7 @@
 #include "../../core/lv_refr.h"
 #include "../../misc/lv_assert.h"
 #include "../../stdlib/lv_string.h"
+#include "../../osal/lv_os.h"
 #include "../lv_draw_mask.h"
 
 /*********************
@@ -30,16 +31,45 @@
 /**********************
  *      TYPEDEFS
  **********************/
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+/*A cached corner. It's freed when it's dropped from the cache and no draw unit reads it.*/
+typedef struct {
+    uint32_t usage_cnt;
+    uint32_t cached : 1;
+    lv_opa_t buf[];
+} shadow_corner_t;
+
+/*The fields before `corner` are the key of the cache*/
+typedef struct {
+    int32_t sw;
+    int32_t r;
+    int32_t w;      /*Width of the blurred area. Larger widths don't change the corner, so it's limited.*/
+    int32_t h;      /*Height of the blurred area, limited like `w`*/
+    shadow_corner_t * corner;
+} shadow_cache_node_t;
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 #if LV_DRAW_SW_COMPLEX
-LV_ATTRIBUTE_FAST_MEM static void shadow_draw_corner_buf(const lv_area_t * coords, uint16_t * sh_buf, int32_t s,
-                                                         int32_t r);
-LV_ATTRIBUTE_FAST_MEM static void shadow_blur_corner(int32_t size, int32_t sw, uint16_t * sh_ups_buf);
+LV_ATTRIBUTE_FAST_MEM static void shadow_draw_corner_buf(lv_draw_unit_t * draw_unit, const lv_area_t * coords,
+                                                         uint16_t * sh_buf, int32_t s, int32_t r);
+LV_ATTRIBUTE_FAST_MEM static void shadow_blur_corner(lv_draw_unit_t * draw_unit, int32_t size, int32_t sw,
+                                                     uint16_t * sh_ups_buf);
+static inline uint64_t div_init(uint32_t d);
+static inline uint32_t div_apply(uint32_t x, uint64_t m);
 #endif /*LV_DRAW_SW_COMPLEX*/
 
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+    static void shadow_cache_init_key(shadow_cache_node_t * key, const lv_area_t * coords, int32_t sw, int32_t r);
+    static bool shadow_cache_read(const lv_area_t * coords, int32_t sw, int32_t r, lv_opa_t * sh_buf);
+    static void shadow_cache_add(const lv_area_t * coords, int32_t sw, int32_t r, const lv_opa_t * sh_buf);
+    static lv_lru_rb_compare_res_t shadow_cache_compare_cb(const shadow_cache_node_t * a, const shadow_cache_node_t * b);
+    static bool shadow_cache_create_cb(shadow_cache_node_t * node, void * user_data);
+    static void shadow_cache_free_cb(shadow_cache_node_t * node, void * user_data);
+#endif
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -52,6 +82,35 @@ LV_ATTRIBUTE_FAST_MEM static void shadow_blur_corner(int32_t size, int32_t sw, u
  *   GLOBAL FUNCTIONS
  **********************/
 
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+
+void _lv_draw_sw_shadow_cache_init(void)
+{
+    lv_memzero(&shadow_cache, sizeof(lv_draw_sw_shadow_cache_t));
+    lv_mutex_init(&shadow_cache.lock);
+    shadow_cache.lru = lv_lru_rb_create(sizeof(shadow_cache_node_t), LV_DRAW_SW_SHADOW_CACHE_CNT,
+                                        (lv_lru_rb_compare_cb_t)shadow_cache_compare_cb,
+                                        (lv_lru_rb_create_cb_t)shadow_cache_create_cb,
+                                        (lv_lru_rb_free_cb_t)shadow_cache_free_cb);
+}
+
+void _lv_draw_sw_shadow_cache_deinit(void)
+{
+    if(shadow_cache.lru) lv_lru_rb_destroy(shadow_cache.lru, NULL);
+    lv_mutex_delete(&shadow_cache.lock);
+    lv_memzero(&shadow_cache, sizeof(lv_draw_sw_shadow_cache_t));
+}
+
+void lv_draw_sw_shadow_cache_get_counters(uint32_t * hit_cnt, uint32_t * miss_cnt)
+{
+    lv_mutex_lock(&shadow_cache.lock);
+    if(hit_cnt) *hit_cnt = shadow_cache.hit_cnt;
+    if(miss_cnt) *miss_cnt = shadow_cache.miss_cnt;
+    lv_mutex_unlock(&shadow_cache.lock);
+}
+
+#endif /*LV_DRAW_SW_SHADOW_CACHE_SIZE*/
+
 void lv_draw_sw_box_shadow(lv_draw_unit_t * draw_unit, const lv_draw_box_shadow_dsc_t * dsc, const lv_area_t * coords)
 {
     /*Calculate the rectangle which is blurred to get the shadow in `shadow_area`*/
@@ -94,30 +153,19 @@ void lv_draw_sw_box_shadow(lv_draw_unit_t * draw_unit, const lv_draw_box_shadow_
     /*Get how many pixels are affected by the blur on the corners*/
     int32_t corner_size = dsc->width  + r_sh;
 
-    lv_opa_t * sh_buf;
+    /*A larger buffer is required for calculation*/
+    lv_opa_t * sh_buf = lv_draw_arena_alloc(draw_unit, corner_size * corner_size * sizeof(uint16_t));
 
 #if LV_DRAW_SW_SHADOW_CACHE_SIZE
-    lv_draw_sw_shadow_cache_t * cache = &shadow_cache;
-    if(cache->cache_size == corner_size && cache->cache_r == r_sh) {
-        /*Use the cache if available*/
-        sh_buf = lv_malloc(corner_size * corner_size);
-        lv_memcpy(sh_buf, cache->cache, corner_size * corner_size);
+    if(corner_size > LV_DRAW_SW_SHADOW_CACHE_SIZE) {
+        shadow_draw_corner_buf(draw_unit, &core_area, (uint16_t *)sh_buf, dsc->width, r_sh);
     }
-    else {
-        /*A larger buffer is required for calculation*/
-        sh_buf = lv_malloc(corner_size * corner_size * sizeof(uint16_t));
-        shadow_draw_corner_buf(&core_area, (uint16_t *)sh_buf, dsc->width, r_sh);
-
-        /*Cache the corner if it fits into the cache size*/
-        if((uint32_t)corner_size * corner_size < sizeof(cache->cache)) {
-            lv_memcpy(cache->cache, sh_buf, corner_size * corner_size);
-            cache->cache_size = corner_size;
-            cache->cache_r = r_sh;
-        }
+    else if(!shadow_cache_read(&core_area, dsc->width, r_sh, sh_buf)) {
+        shadow_draw_corner_buf(draw_unit, &core_area, (uint16_t *)sh_buf, dsc->width, r_sh);
+        shadow_cache_add(&core_area, dsc->width, r_sh, sh_buf);
     }
 #else
-    sh_buf = lv_malloc(corner_size * corner_size * sizeof(uint16_t));
-    shadow_draw_corner_buf(&core_area, (uint16_t *)sh_buf, dsc->width, r_sh);
+    shadow_draw_corner_buf(draw_unit, &core_area, (uint16_t *)sh_buf, dsc->width, r_sh);
 #endif /*LV_DRAW_SW_SHADOW_CACHE_SIZE*/
 
     /*Skip a lot of masking if the background will cover the shadow that would be masked out*/
@@ -132,7 +180,7 @@ void lv_draw_sw_box_shadow(lv_draw_unit_t * draw_unit, const lv_draw_box_shadow_
         masks[0] = &mask_rout_param;
     }
 
-    lv_opa_t * mask_buf = lv_malloc(lv_area_get_width(&shadow_area));
+    lv_opa_t * mask_buf = lv_draw_arena_alloc(draw_unit, lv_area_get_width(&shadow_area));
     lv_area_t blend_area;
     lv_area_t clip_area_sub;
     lv_opa_t * sh_buf_tmp;
@@ -549,8 +597,8 @@ void lv_draw_sw_box_shadow(lv_draw_unit_t * draw_unit, const lv_draw_box_shadow_
     if(!simple) {
         lv_draw_sw_mask_free_param(&mask_rout_param);
     }
-    lv_free(sh_buf);
-    lv_free(mask_buf);
+    lv_draw_arena_free(draw_unit, sh_buf);
+    lv_draw_arena_free(draw_unit, mask_buf);
 }
 #endif /*LV_USE_DRAW_SW*/
 
@@ -562,13 +610,14 @@ void lv_draw_sw_box_shadow(lv_draw_unit_t * draw_unit, const lv_draw_box_shadow_
 
 /**
  * Calculate a blurred corner
+ * @param draw_unit the draw unit to allocate the temporary buffers from
  * @param coords Coordinates of the shadow
  * @param sh_buf a buffer to store the result. Its size should be `(sw + r)^2 * 2`
  * @param sw shadow width
  * @param r radius
  */
-LV_ATTRIBUTE_FAST_MEM static void shadow_draw_corner_buf(const lv_area_t * coords, uint16_t * sh_buf, int32_t sw,
-                                                         int32_t r)
+LV_ATTRIBUTE_FAST_MEM static void shadow_draw_corner_buf(lv_draw_unit_t * draw_unit, const lv_area_t * coords,
+                                                         uint16_t * sh_buf, int32_t sw, int32_t r)
 {
     int32_t sw_ori = sw;
     int32_t size = sw_ori  + r;
@@ -591,7 +640,8 @@ LV_ATTRIBUTE_FAST_MEM static void shadow_draw_corner_buf(const lv_area_t * coord
 #endif /*SHADOW_ENHANCE*/
 
     int32_t y;
-    lv_opa_t * mask_line = lv_malloc(size);
+    uint64_t sw_div = div_init(sw);
+    lv_opa_t * mask_line = lv_draw_arena_alloc(draw_unit, size);
     uint16_t * sh_ups_tmp_buf = (uint16_t *)sh_buf;
     for(y = 0; y < size; y++) {
         lv_memset(mask_line, 0xff, size);
@@ -601,16 +651,16 @@ LV_ATTRIBUTE_FAST_MEM static void shadow_draw_corner_buf(const lv_area_t * coord
         }
         else {
             int32_t i;
-            sh_ups_tmp_buf[0] = (mask_line[0] << SHADOW_UPSCALE_SHIFT) / sw;
+            sh_ups_tmp_buf[0] = div_apply(mask_line[0] << SHADOW_UPSCALE_SHIFT, sw_div);
             for(i = 1; i < size; i++) {
                 if(mask_line[i] == mask_line[i - 1]) sh_ups_tmp_buf[i] = sh_ups_tmp_buf[i - 1];
-                else  sh_ups_tmp_buf[i] = (mask_line[i] << SHADOW_UPSCALE_SHIFT) / sw;
+                else  sh_ups_tmp_buf[i] = div_apply(mask_line[i] << SHADOW_UPSCALE_SHIFT, sw_div);
             }
         }
 
         sh_ups_tmp_buf += size;
     }
-    lv_free(mask_line);
+    lv_draw_arena_free(draw_unit, mask_line);
 
     lv_draw_sw_mask_free_param(&mask_param);
 
@@ -623,7 +673,7 @@ LV_ATTRIBUTE_FAST_MEM static void shadow_draw_corner_buf(const lv_area_t * coord
         return;
     }
 
-    shadow_blur_corner(size, sw, sh_buf);
+    shadow_blur_corner(draw_unit, size, sw, sh_buf);
 
 #if SHADOW_ENHANCE == 0
     /*The result is required in lv_opa_t not uint16_t*/
@@ -637,13 +687,14 @@ LV_ATTRIBUTE_FAST_MEM static void shadow_draw_corner_buf(const lv_area_t * coord
     if(sw > 1) {
         uint32_t i;
         uint32_t max_v_div = (LV_OPA_COVER << SHADOW_UPSCALE_SHIFT) / sw;
+        sw_div = div_init(sw);
         for(i = 0; i < (uint32_t)size * size; i++) {
             if(sh_buf[i] == 0) continue;
             else if(sh_buf[i] == LV_OPA_COVER) sh_buf[i] = max_v_div;
-            else  sh_buf[i] = (sh_buf[i] << SHADOW_UPSCALE_SHIFT) / sw;
+            else  sh_buf[i] = div_apply(sh_buf[i] << SHADOW_UPSCALE_SHIFT, sw_div);
         }
 
-        shadow_blur_corner(size, sw, sh_buf);
+        shadow_blur_corner(draw_unit, size, sw, sh_buf);
     }
     int32_t x;
     lv_opa_t * res_buf = (lv_opa_t *)sh_buf;
@@ -654,14 +705,15 @@ LV_ATTRIBUTE_FAST_MEM static void shadow_draw_corner_buf(const lv_area_t * coord
 
 }
 
-LV_ATTRIBUTE_FAST_MEM static void shadow_blur_corner(int32_t size, int32_t sw, uint16_t * sh_ups_buf)
+LV_ATTRIBUTE_FAST_MEM static void shadow_blur_corner(lv_draw_unit_t * draw_unit, int32_t size, int32_t sw,
+                                                     uint16_t * sh_ups_buf)
 {
     int32_t s_left = sw >> 1;
     int32_t s_right = (sw >> 1);
     if((sw & 1) == 0) s_left--;
 
     /*Horizontal blur*/
-    uint16_t * sh_ups_blur_buf = lv_malloc(size * sizeof(uint16_t));
+    uint16_t * sh_ups_blur_buf = lv_draw_arena_alloc(draw_unit, size * sizeof(uint16_t));
 
     int32_t x;
     int32_t y;
@@ -692,10 +744,11 @@ LV_ATTRIBUTE_FAST_MEM static void shadow_blur_corner(int32_t size, int32_t sw, u
     uint32_t i;
     uint32_t max_v = LV_OPA_COVER << SHADOW_UPSCALE_SHIFT;
     uint32_t max_v_div = max_v / sw;
+    uint64_t sw_div = div_init(sw);
     for(i = 0; i < (uint32_t)size * size; i++) {
         if(sh_ups_buf[i] == 0) continue;
         else if(sh_ups_buf[i] == max_v) sh_ups_buf[i] = max_v_div;
-        else sh_ups_buf[i] = sh_ups_buf[i] / sw;
+        else sh_ups_buf[i] = div_apply(sh_ups_buf[i], sw_div);
     }
 
     for(x = 0; x < size; x++) {
@@ -724,6 +777,123 @@ LV_ATTRIBUTE_FAST_MEM static void shadow_blur_corner(int32_t size, int32_t sw, u
         }
     }
 
-    lv_free(sh_ups_blur_buf);
+    lv_draw_arena_free(draw_unit, sh_ups_blur_buf);
+}
+
+/**
+ * Prepare dividing by `d` with a multiplication and a shift.
+ * The result of `div_apply` is exact if `x * d < 2^40`, which is always true
+ * as `x` is at most `LV_OPA_COVER << SHADOW_UPSCALE_SHIFT` and `d` is the shadow width.
+ * @param d     the divisor, > 0
+ * @return      the multiplier to pass to `div_apply`
+ */
+static inline uint64_t div_init(uint32_t d)
+{
+    return ((1ULL << 40) + d - 1) / d;
+}
+
+static inline uint32_t div_apply(uint32_t x, uint64_t m)
+{
+    return (uint32_t)((x * m) >> 40);
 }
 #endif /*LV_DRAW_SW_COMPLEX*/
+
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+
+static void shadow_cache_init_key(shadow_cache_node_t * key, const lv_area_t * coords, int32_t sw, int32_t r)
+{
+    /*The corner depends on the size of the blurred area only if it's small*/
+    int32_t size_max = (sw + r) * 2;
+    lv_memzero(key, sizeof(shadow_cache_node_t));
+    key->sw = sw;
+    key->r = r;
+    key->w = LV_MIN(lv_area_get_width(coords), size_max);
+    key->h = LV_MIN(lv_area_get_height(coords), size_max);
+}
+
+/**
+ * Copy a cached corner into `sh_buf`
+ * @return  true: the corner was found; false: it needs to be calculated
+ */
+static bool shadow_cache_read(const lv_area_t * coords, int32_t sw, int32_t r, lv_opa_t * sh_buf)
+{
+    shadow_cache_node_t key;
+    shadow_cache_init_key(&key, coords, sw, r);
+
+    lv_mutex_lock(&shadow_cache.lock);
+    shadow_cache_node_t * node = lv_lru_rb_get_or_create(shadow_cache.lru, &key, NULL);
+    shadow_corner_t * corner = node ? node->corner : NULL;
+    if(corner == NULL) {
+        shadow_cache.miss_cnt++;
+        lv_mutex_unlock(&shadow_cache.lock);
+        return false;
+    }
+    corner->usage_cnt++;
+    shadow_cache.hit_cnt++;
+    lv_mutex_unlock(&shadow_cache.lock);
+
+    /*Copy without holding the lock. The corner is kept alive by `usage_cnt`.*/
+    int32_t size = sw + r;
+    lv_memcpy(sh_buf, corner->buf, size * size);
+
+    lv_mutex_lock(&shadow_cache.lock);
+    corner->usage_cnt--;
+    if(corner->usage_cnt == 0 && !corner->cached) lv_free(corner);
+    lv_mutex_unlock(&shadow_cache.lock);
+
+    return true;
+}
+
+static void shadow_cache_add(const lv_area_t * coords, int32_t sw, int32_t r, const lv_opa_t * sh_buf)
+{
+    shadow_cache_node_t key;
+    shadow_cache_init_key(&key, coords, sw, r);
+
+    int32_t size = sw + r;
+    lv_mutex_lock(&shadow_cache.lock);
+    shadow_cache_node_t * node = lv_lru_rb_get_or_create(shadow_cache.lru, &key, NULL);
+    /*Another draw unit might have added it in the meantime*/
+    if(node && node->corner == NULL) {
+        shadow_corner_t * corner = lv_malloc(sizeof(shadow_corner_t) + size * size);
+        if(corner) {
+            corner->usage_cnt = 0;
+            corner->cached = 1;
+            lv_memcpy(corner->buf, sh_buf, size * size);
+            node->corner = corner;
+        }
+        else {
+            lv_lru_rb_drop(shadow_cache.lru, &key, NULL);
+        }
+    }
+    lv_mutex_unlock(&shadow_cache.lock);
+}
+
+static lv_lru_rb_compare_res_t shadow_cache_compare_cb(const shadow_cache_node_t * a, const shadow_cache_node_t * b)
+{
+    if(a->sw != b->sw) return a->sw > b->sw ? 1 : -1;
+    if(a->r != b->r) return a->r > b->r ? 1 : -1;
+    if(a->w != b->w) return a->w > b->w ? 1 : -1;
+    if(a->h != b->h) return a->h > b->h ? 1 : -1;
+    return 0;
+}
+
+static bool shadow_cache_create_cb(shadow_cache_node_t * node, void * user_data)
+{
+    LV_UNUSED(user_data);
+    node->corner = NULL;
+    return true;
+}
+
+static void shadow_cache_free_cb(shadow_cache_node_t * node, void * user_data)
+{
+    LV_UNUSED(user_data);
+    shadow_corner_t * corner = node->corner;
+    if(corner == NULL) return;
+
+    /*If a draw unit is still copying it, the last one will free it*/
+    corner->cached = 0;
+    if(corner->usage_cnt == 0) lv_free(corner);
+    node->corner = NULL;
+}
+
+#endif /*LV_DRAW_SW_SHADOW_CACHE_SIZE*/
@@ -11,6 +11,8 @@
 
 #include "../../misc/lv_types.h"
 #include "../../osal/lv_os.h"
+#include "../../core/lv_global.h"
+#include "../../stdlib/lv_string.h"
 
 /*********************
  *      DEFINES
@@ -18,6 +20,10 @@
 #define GRAD_CM(r,g,b) lv_color_make(r,g,b)
 #define GRAD_CONV(t, x) t = x
 
+#if LV_DRAW_SW_GRADIENT_CACHE_CNT > 0
+    #define grad_cache LV_GLOBAL_DEFAULT()->sw_grad_cache
+#endif
+
 #undef ALIGN
 #if defined(LV_ARCH_64)
     #define ALIGN(X)    (((X) + 7) & ~7)
@@ -25,11 +31,31 @@
     #define ALIGN(X)    (((X) + 3) & ~3)
 #endif
 
+/**********************
+ *      TYPEDEFS
+ **********************/
+#if LV_DRAW_SW_GRADIENT_CACHE_CNT > 0
+/*The fields before `grad` are the key of the cache*/
+typedef struct {
+    int32_t size;
+    lv_grad_dir_t dir;
+    uint8_t stops_count;
+    lv_gradient_stop_t stops[LV_GRADIENT_MAX_STOPS];
+    lv_grad_t * grad;
+} grad_cache_node_t;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 typedef lv_result_t (*op_cache_t)(lv_grad_t * c, void * ctx);
 static lv_grad_t * allocate_item(const lv_grad_dsc_t * g, int32_t w, int32_t h);
+static void fill_item(const lv_grad_dsc_t * g, lv_grad_t * item);
+#if LV_DRAW_SW_GRADIENT_CACHE_CNT > 0
+    static lv_lru_rb_compare_res_t cache_compare_cb(const grad_cache_node_t * a, const grad_cache_node_t * b);
+    static bool cache_create_cb(grad_cache_node_t * node, void * user_data);
+    static void cache_free_cb(grad_cache_node_t * node, void * user_data);
+#endif
 
 /**********************
  *   STATIC VARIABLE
@@ -52,30 +78,211 @@ static lv_grad_t * allocate_item(const lv_grad_dsc_t * g, int32_t w, int32_t h)
     item->color_map = (lv_color_t *)(p + ALIGN(sizeof(*item)));
     item->opa_map = (lv_opa_t *)(p + ALIGN(sizeof(*item)) + ALIGN(size * sizeof(lv_color_t)));
     item->size = size;
+    item->usage_cnt = 1;
+    item->cached = 0;
     return item;
 }
 
+/**
+ * Calculate the maps of a gradient. Unlike calling `lv_gradient_color_calculate()` for each pixel
+ * the stops are not searched again and again, and the mix ratio is stepped instead of dividing
+ * on each pixel. The result is the same.
+ */
+static void fill_item(const lv_grad_dsc_t * g, lv_grad_t * item)
+{
+    int32_t size = item->size;
+    int32_t stop_cnt = g->stops_count;
+    int32_t pos[LV_GRADIENT_MAX_STOPS];
+    int32_t i;
+    for(i = 0; i < stop_cnt; i++) {
+        pos[i] = (g->stops[i].frac * size) >> 8;
+
+        /*With unordered stops the first matching stop can't be tracked incrementally*/
+        if(i > 0 && pos[i] < pos[i - 1]) {
+            int32_t p;
+            for(p = 0; p < size; p++) {
+                lv_gradient_color_calculate(g, size, p, &item->color_map[p], &item->opa_map[p]);
+            }
+            return;
+        }
+    }
+
+    lv_color_t * color_map = item->color_map;
+    lv_opa_t * opa_map = item->opa_map;
+    int32_t last_pos = pos[stop_cnt - 1];
+    int32_t p = 0;
+
+    /*Before the first stop*/
+    for(; p < size && p <= pos[0]; p++) {
+        color_map[p] = g->stops[0].color;
+        opa_map[p] = g->stops[0].opa;
+    }
+
+    for(i = 1; i < stop_cnt && p < size; i++) {
+        /*The pixels on or after the last stop are set below*/
+        int32_t end = LV_MIN3(pos[i], last_pos - 1, size - 1);
+        if(p > end) continue;
+
+        lv_color_t one = g->stops[i - 1].color;
+        lv_color_t two = g->stops[i].color;
+        lv_opa_t opa_one = g->stops[i - 1].opa;
+        lv_opa_t opa_two = g->stops[i].opa;
+
+        /*mix = (p - pos[i - 1]) * 255 / d, as quotient and remainder*/
+        int32_t d = pos[i] - pos[i - 1];
+        int32_t mix_q = ((p - pos[i - 1]) * 255) / d;
+        int32_t mix_r = ((p - pos[i - 1]) * 255) % d;
+        int32_t step_q = 255 / d;
+        int32_t step_r = 255 % d;
+
+        for(; p <= end; p++) {
+            int32_t mix = mix_q;
+            int32_t imix = 255 - mix;
+            color_map[p] = GRAD_CM(LV_UDIV255(two.red * mix   + one.red * imix),
+                                   LV_UDIV255(two.green * mix + one.green * imix),
+                                   LV_UDIV255(two.blue * mix  + one.blue * imix));
+            opa_map[p] = LV_UDIV255(opa_two * mix + opa_one * imix);
+
+            mix_q += step_q;
+            mix_r += step_r;
+            if(mix_r >= d) {
+                mix_q++;
+                mix_r -= d;
+            }
+        }
+    }
+
+    /*After the last stop*/
+    for(; p < size; p++) {
+        color_map[p] = g->stops[stop_cnt - 1].color;
+        opa_map[p] = g->stops[stop_cnt - 1].opa;
+    }
+}
+
+#if LV_DRAW_SW_GRADIENT_CACHE_CNT > 0
+
+static lv_lru_rb_compare_res_t cache_compare_cb(const grad_cache_node_t * a, const grad_cache_node_t * b)
+{
+    if(a->size != b->size) return a->size < b->size ? -1 : 1;
+    if(a->dir != b->dir) return a->dir < b->dir ? -1 : 1;
+    if(a->stops_count != b->stops_count) return a->stops_count < b->stops_count ? -1 : 1;
+
+    uint32_t i;
+    for(i = 0; i < a->stops_count; i++) {
+        const lv_gradient_stop_t * sa = &a->stops[i];
+        const lv_gradient_stop_t * sb = &b->stops[i];
+        if(sa->frac != sb->frac) return sa->frac < sb->frac ? -1 : 1;
+        if(sa->opa != sb->opa) return sa->opa < sb->opa ? -1 : 1;
+        uint32_t ca = lv_color_to_u32(sa->color);
+        uint32_t cb = lv_color_to_u32(sb->color);
+        if(ca != cb) return ca < cb ? -1 : 1;
+    }
+
+    return 0;
+}
+
+static bool cache_create_cb(grad_cache_node_t * node, void * user_data)
+{
+    LV_UNUSED(user_data);
+    /*Calculated by `lv_gradient_get()`*/
+    node->grad = NULL;
+    return true;
+}
+
+static void cache_free_cb(grad_cache_node_t * node, void * user_data)
+{
+    LV_UNUSED(user_data);
+    lv_grad_t * grad = node->grad;
+    if(grad == NULL) return;
+
+    /*If a draw task still uses it the last `lv_gradient_cleanup()` will free it*/
+    grad->cached = 0;
+    if(grad->usage_cnt == 0) lv_free(grad);
+}
+
+#endif /*LV_DRAW_SW_GRADIENT_CACHE_CNT > 0*/
+
 /**********************
  *     FUNCTIONS
  **********************/
 
+#if LV_DRAW_SW_GRADIENT_CACHE_CNT > 0
+
+void _lv_gradient_cache_init(void)
+{
+    lv_memzero(&grad_cache, sizeof(lv_draw_sw_grad_cache_t));
+    lv_mutex_init(&grad_cache.lock);
+    grad_cache.lru = lv_lru_rb_create(sizeof(grad_cache_node_t), LV_DRAW_SW_GRADIENT_CACHE_CNT,
+                                      (lv_lru_rb_compare_cb_t)cache_compare_cb,
+                                      (lv_lru_rb_create_cb_t)cache_create_cb,
+                                      (lv_lru_rb_free_cb_t)cache_free_cb);
+}
+
+void _lv_gradient_cache_deinit(void)
+{
+    if(grad_cache.lru) lv_lru_rb_destroy(grad_cache.lru, NULL);
+    lv_mutex_delete(&grad_cache.lock);
+    lv_memzero(&grad_cache, sizeof(lv_draw_sw_grad_cache_t));
+}
+
+void lv_gradient_cache_get_counters(uint32_t * hit_cnt, uint32_t * miss_cnt)
+{
+    lv_mutex_lock(&grad_cache.lock);
+    if(hit_cnt) *hit_cnt = grad_cache.hit_cnt;
+    if(miss_cnt) *miss_cnt = grad_cache.miss_cnt;
+    lv_mutex_unlock(&grad_cache.lock);
+}
+
+#endif /*LV_DRAW_SW_GRADIENT_CACHE_CNT > 0*/
+
 lv_grad_t * lv_gradient_get(const lv_grad_dsc_t * g, int32_t w, int32_t h)
 {
     /* No gradient, no cache */
     if(g->dir == LV_GRAD_DIR_NONE) return NULL;
 
+#if LV_DRAW_SW_GRADIENT_CACHE_CNT > 0
     /* Step 1: Search cache for the given key */
+    grad_cache_node_t key;
+    lv_memzero(&key, sizeof(key));
+    key.size = g->dir == LV_GRAD_DIR_HOR ? w : h;
+    key.dir = g->dir;
+    key.stops_count = g->stops_count;
+    lv_memcpy(key.stops, g->stops, g->stops_count * sizeof(lv_gradient_stop_t));
+
+    lv_mutex_lock(&grad_cache.lock);
+    grad_cache_node_t * node = grad_cache.lru ? lv_lru_rb_get_or_create(grad_cache.lru, &key, NULL) : NULL;
+    if(node && node->grad) {
+        grad_cache.hit_cnt++;
+        node->grad->usage_cnt++;
+        lv_grad_t * item = node->grad;
+        lv_mutex_unlock(&grad_cache.lock);
+        return item;
+    }
+    grad_cache.miss_cnt++;
+#endif
+
+    /* Step 2: Allocate a new item */
     lv_grad_t * item = allocate_item(g, w, h);
     if(item == NULL) {
         LV_LOG_WARN("Failed to allocate item for the gradient");
+#if LV_DRAW_SW_GRADIENT_CACHE_CNT > 0
+        if(node) lv_lru_rb_drop(grad_cache.lru, &key, NULL);
+        lv_mutex_unlock(&grad_cache.lock);
+#endif
         return item;
     }
 
     /* Step 3: Fill it with the gradient, as expected */
-    uint32_t i;
-    for(i = 0; i < item->size; i++) {
-        lv_gradient_color_calculate(g, item->size, i, &item->color_map[i], &item->opa_map[i]);
+    fill_item(g, item);
+
+#if LV_DRAW_SW_GRADIENT_CACHE_CNT > 0
+    if(node) {
+        node->grad = item;
+        item->cached = 1;
     }
+    lv_mutex_unlock(&grad_cache.lock);
+#endif
+
     return item;
 }
 
@@ -134,7 +341,15 @@ LV_ATTRIBUTE_FAST_MEM void lv_gradient_color_calculate(const lv_grad_dsc_t * dsc
 
 void lv_gradient_cleanup(lv_grad_t * grad)
 {
+#if LV_DRAW_SW_GRADIENT_CACHE_CNT > 0
+    lv_mutex_lock(&grad_cache.lock);
+    if(grad->usage_cnt > 0) grad->usage_cnt--;
+    bool drop = grad->usage_cnt == 0 && grad->cached == 0;
+    lv_mutex_unlock(&grad_cache.lock);
+    if(drop) lv_free(grad);
+#else
     lv_free(grad);
+#endif
 }
 
 #endif /*LV_USE_DRAW_SW*/
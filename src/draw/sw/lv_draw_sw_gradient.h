@@ -15,6 +15,8 @@ extern "C" {
  *********************/
 #include "../../misc/lv_color.h"
 #include "../../misc/lv_style.h"
+#include "../../misc/lv_lru_rb.h"
+#include "../../osal/lv_os.h"
 
 #if LV_USE_DRAW_SW
 
@@ -34,8 +36,19 @@ typedef struct _lv_gradient_cache_t {
     lv_color_t   *  color_map;
     lv_opa_t   *  opa_map;
     uint32_t size;
+    uint32_t usage_cnt;     /**< Number of draw tasks using the gradient. It's freed only when it's 0.*/
+    uint32_t cached : 1;    /**< 1: the gradient is in the cache and it will be freed when it's dropped*/
 } lv_grad_t;
 
+#if LV_DRAW_SW_GRADIENT_CACHE_CNT > 0
+typedef struct {
+    lv_lru_rb_t * lru;      /**< The cached gradients by their stops, direction and size*/
+    lv_mutex_t lock;        /**< The draw units can get and release the gradients in parallel*/
+    uint32_t hit_cnt;       /**< Number of gradients found in the cache*/
+    uint32_t miss_cnt;      /**< Number of gradients calculated as they were not found in the cache*/
+} lv_draw_sw_grad_cache_t;
+#endif
+
 /**********************
  *      PROTOTYPES
  **********************/
@@ -49,15 +62,44 @@ typedef struct _lv_gradient_cache_t {
 LV_ATTRIBUTE_FAST_MEM void lv_gradient_color_calculate(const lv_grad_dsc_t * dsc, int32_t range,
                                                        int32_t frac, lv_grad_color_t * color_out, lv_opa_t * opa_out);
 
-/** Get a gradient cache from the given parameters */
+/**
+ * Get the color and opacity map of a gradient. With `LV_DRAW_SW_GRADIENT_CACHE_CNT > 0`
+ * it's taken from the cache if the same gradient was used recently.
+ * @param gradient  the gradient descriptor
+ * @param w         width of the area to fill
+ * @param h         height of the area to fill
+ * @return          the maps of the gradient or NULL if there is no gradient or on out of memory.
+ *                  Needs to be released with `lv_gradient_cleanup()`.
+ */
 lv_grad_t * lv_gradient_get(const lv_grad_dsc_t * gradient, int32_t w, int32_t h);
 
 /**
- * Clean up the gradient item after it was get with `lv_grad_get_from_cache`.
+ * Clean up the gradient item after it was get with `lv_gradient_get()`.
  * @param grad      pointer to a gradient
  */
 void lv_gradient_cleanup(lv_grad_t * grad);
 
+#if LV_DRAW_SW_GRADIENT_CACHE_CNT > 0
+
+/**
+ * Initialize the gradient cache. Called by `lv_draw_sw_init()`.
+ */
+void _lv_gradient_cache_init(void);
+
+/**
+ * Drop the cached gradients and free the cache. Called by `lv_draw_sw_deinit()`.
+ */
+void _lv_gradient_cache_deinit(void);
+
+/**
+ * Get the number of gradients found and not found in the cache
+ * @param hit_cnt   store the number of hits here. Can be NULL.
+ * @param miss_cnt  store the number of misses here. Can be NULL.
+ */
+void lv_gradient_cache_get_counters(uint32_t * hit_cnt, uint32_t * miss_cnt);
+
+#endif /*LV_DRAW_SW_GRADIENT_CACHE_CNT > 0*/
+
 #endif /*LV_USE_DRAW_SW*/
 
 #ifdef __cplusplus
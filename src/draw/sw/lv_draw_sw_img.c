@@ -74,12 +74,13 @@ void lv_draw_sw_layer(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t * dr
 #if LV_USE_LAYER_DEBUG || LV_USE_PARALLEL_DRAW_DEBUG
     lv_area_t area_rot;
     lv_area_copy(&area_rot, coords);
-    if(draw_dsc->rotation || draw_dsc->scale_x != LV_SCALE_NONE || draw_dsc->scale_y != LV_SCALE_NONE) {
+    if(draw_dsc->rotation || draw_dsc->scale_x != LV_SCALE_NONE || draw_dsc->scale_y != LV_SCALE_NONE ||
+       draw_dsc->skew_x || draw_dsc->skew_y) {
         int32_t w = lv_area_get_width(coords);
         int32_t h = lv_area_get_height(coords);
 
         _lv_image_buf_get_transformed_area(&area_rot, w, h, draw_dsc->rotation, draw_dsc->scale_x, draw_dsc->scale_y,
-                                           &draw_dsc->pivot);
+                                           draw_dsc->skew_x, draw_dsc->skew_y, &draw_dsc->pivot);
 
         area_rot.x1 += coords->x1;
         area_rot.y1 += coords->y1;
@@ -161,6 +162,12 @@ void lv_draw_sw_image(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t * dr
     }
 }
 
+void lv_draw_sw_image_decoded(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t * draw_dsc,
+                              lv_image_decoder_dsc_t * decoder_dsc, const lv_area_t * coords)
+{
+    _lv_draw_image_decoded_helper(draw_unit, draw_dsc, decoder_dsc, coords, img_draw_core);
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -170,7 +177,8 @@ static void img_draw_core(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t
                           const lv_area_t * img_coords, const lv_area_t * clipped_img_area)
 {
     bool transformed = draw_dsc->rotation != 0 || draw_dsc->scale_x != LV_SCALE_NONE ||
-                       draw_dsc->scale_y != LV_SCALE_NONE ? true : false;
+                       draw_dsc->scale_y != LV_SCALE_NONE || draw_dsc->skew_x != 0 ||
+                       draw_dsc->skew_y != 0 ? true : false;
 
     lv_draw_sw_blend_dsc_t blend_dsc;
     const uint8_t * src_buf = decoder_dsc->img_data;
@@ -242,6 +250,27 @@ static void img_draw_core(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t
         int32_t blend_w = lv_area_get_width(&blend_area);
         int32_t blend_h = lv_area_get_height(&blend_area);
 
+#if LV_DRAW_SW_IMAGE_MIPMAP
+        /*Sample a prefiltered smaller copy if the whole image is scaled down a lot*/
+        lv_cache_entry_t * mip_entry = NULL;
+        lv_draw_image_sup_t mip_sup;
+        if(transformed && decoder_dsc->decoded &&
+           src_w == (int32_t)decoder_dsc->decoded->header.w && src_h == (int32_t)decoder_dsc->decoded->header.h) {
+            uint32_t level = lv_draw_sw_mipmap_get_level(&decoder_dsc->decoded->header, draw_dsc->scale_x,
+                                                         draw_dsc->scale_y);
+            const lv_draw_buf_t * mip = level ? lv_draw_sw_mipmap_get(decoder_dsc, level, &mip_entry) : NULL;
+            if(mip) {
+                src_buf = mip->data;
+                img_stride = mip->header.stride;
+                src_w = mip->header.w;
+                src_h = mip->header.h;
+                mip_sup = *sup;
+                mip_sup.mip_level = level;
+                sup = &mip_sup;
+            }
+        }
+#endif
+
         lv_color_format_t cf_final = cf;
         if(transformed) {
             if(cf == LV_COLOR_FORMAT_RGB888 || cf == LV_COLOR_FORMAT_XRGB8888) cf_final = LV_COLOR_FORMAT_ARGB8888;
@@ -254,13 +283,13 @@ static void img_draw_core(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t
             uint32_t buf_stride = blend_w * 3;
             buf_h = MAX_BUF_SIZE / buf_stride;
             if(buf_h > blend_h) buf_h = blend_h;
-            tmp_buf = lv_malloc(buf_stride * buf_h);
+            tmp_buf = lv_draw_arena_alloc(draw_unit, buf_stride * buf_h);
         }
         else {
             uint32_t buf_stride = blend_w * lv_color_format_get_size(cf_final);
             buf_h = MAX_BUF_SIZE / buf_stride;
             if(buf_h > blend_h) buf_h = blend_h;
-            tmp_buf = lv_malloc(buf_stride * buf_h);
+            tmp_buf = lv_draw_arena_alloc(draw_unit, buf_stride * buf_h);
         }
 
         blend_dsc.src_buf = tmp_buf;
@@ -380,7 +409,15 @@ static void img_draw_core(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t
             }
         }
 
-        lv_free(tmp_buf);
+        lv_draw_arena_free(draw_unit, tmp_buf);
+
+#if LV_DRAW_SW_IMAGE_MIPMAP
+        if(mip_entry) {
+            lv_cache_lock();
+            lv_cache_release(mip_entry);
+            lv_cache_unlock();
+        }
+#endif
     }
 }
 
@@ -136,7 +136,7 @@ LV_ATTRIBUTE_FAST_MEM static void draw_line_hor(lv_draw_unit_t * draw_unit, cons
 
         int32_t dash_start = blend_area.x1 % (dsc->dash_gap + dsc->dash_width);
 
-        lv_opa_t * mask_buf = lv_malloc(blend_area_w);
+        lv_opa_t * mask_buf = lv_draw_arena_alloc(draw_unit, blend_area_w);
         blend_dsc.mask_buf = mask_buf;
         blend_dsc.mask_area = &blend_area;
         blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
@@ -167,7 +167,7 @@ LV_ATTRIBUTE_FAST_MEM static void draw_line_hor(lv_draw_unit_t * draw_unit, cons
             blend_area.y1++;
             blend_area.y2++;
         }
-        lv_free(mask_buf);
+        lv_draw_arena_free(draw_unit, mask_buf);
     }
 #endif /*LV_DRAW_SW_COMPLEX*/
 }
@@ -209,7 +209,7 @@ LV_ATTRIBUTE_FAST_MEM static void draw_line_ver(lv_draw_unit_t * draw_unit, cons
         int32_t y2 = blend_area.y2;
         blend_area.y2 = blend_area.y1;
 
-        lv_opa_t * mask_buf = lv_malloc(draw_area_w);
+        lv_opa_t * mask_buf = lv_draw_arena_alloc(draw_unit, draw_area_w);
         blend_dsc.mask_buf = mask_buf;
         blend_dsc.mask_area = &blend_area;
         blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
@@ -238,7 +238,7 @@ LV_ATTRIBUTE_FAST_MEM static void draw_line_ver(lv_draw_unit_t * draw_unit, cons
             blend_area.y1++;
             blend_area.y2++;
         }
-        lv_free(mask_buf);
+        lv_draw_arena_free(draw_unit, mask_buf);
     }
 #endif /*LV_DRAW_SW_COMPLEX*/
 }
@@ -340,7 +340,7 @@ LV_ATTRIBUTE_FAST_MEM static void draw_line_skew(lv_draw_unit_t * draw_unit, con
     int32_t h;
     uint32_t hor_res = (uint32_t)lv_display_get_horizontal_resolution(_lv_refr_get_disp_refreshing());
     size_t mask_buf_size = LV_MIN(lv_area_get_size(&blend_area), hor_res);
-    lv_opa_t * mask_buf = lv_malloc(mask_buf_size);
+    lv_opa_t * mask_buf = lv_draw_arena_alloc(draw_unit, mask_buf_size);
 
     int32_t y2 = blend_area.y2;
     blend_area.y2 = blend_area.y1;
@@ -385,7 +385,7 @@ LV_ATTRIBUTE_FAST_MEM static void draw_line_skew(lv_draw_unit_t * draw_unit, con
         lv_draw_sw_blend(draw_unit, &blend_dsc);
     }
 
-    lv_free(mask_buf);
+    lv_draw_arena_free(draw_unit, mask_buf);
 
     lv_draw_sw_mask_free_param(&mask_left_param);
     lv_draw_sw_mask_free_param(&mask_right_param);
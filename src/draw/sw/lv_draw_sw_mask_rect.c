@@ -57,7 +57,7 @@ void lv_draw_sw_mask_rect(lv_draw_unit_t * draw_unit, const lv_draw_mask_rect_ds
     masks[0] = &param;
 
     uint32_t area_w = lv_area_get_width(&draw_area);
-    lv_opa_t * mask_buf = lv_malloc(area_w);
+    lv_opa_t * mask_buf = lv_draw_arena_alloc(draw_unit, area_w);
 
     int32_t y;
     for(y = draw_area.y1; y <= draw_area.y2; y++) {
@@ -85,7 +85,7 @@ void lv_draw_sw_mask_rect(lv_draw_unit_t * draw_unit, const lv_draw_mask_rect_ds
         }
     }
 
-    lv_free(mask_buf);
+    lv_draw_arena_free(draw_unit, mask_buf);
     lv_draw_sw_mask_free_param(&param);
 }
 
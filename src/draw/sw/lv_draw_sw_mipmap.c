@@ -0,0 +1,340 @@
+/**
+ * @file lv_draw_sw_mipmap.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_sw.h"
+#if LV_USE_DRAW_SW && LV_DRAW_SW_IMAGE_MIPMAP
+
+#include "../../core/lv_global.h"
+#include "../../misc/lv_math.h"
+#include "../../misc/lv_cache.h"
+#include "../../stdlib/lv_string.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+/*`lv_draw_image_sup_t::mip_level` has 4 bits*/
+#define MIPMAP_LEVEL_MAX    8
+
+#define mipmap_data_type LV_GLOBAL_DEFAULT()->sw_mipmap_cache_data_type
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static lv_draw_buf_t * downscale(const lv_draw_buf_t * src);
+static void downscale_argb8888(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t src_stride,
+                               uint8_t * dest, int32_t dest_w, int32_t dest_h, int32_t dest_stride);
+static void downscale_rgb888(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t src_stride,
+                             uint8_t * dest, int32_t dest_w, int32_t dest_h, int32_t dest_stride, uint32_t px_size);
+static void downscale_rgb565(const uint8_t * src, const uint8_t * src_a, int32_t src_w, int32_t src_h,
+                             int32_t src_stride, uint8_t * dest, int32_t dest_w, int32_t dest_h, int32_t dest_stride);
+static void downscale_a8(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t src_stride,
+                         uint8_t * dest, int32_t dest_w, int32_t dest_h, int32_t dest_stride);
+static void cache_invalidate_cb(lv_cache_entry_t * entry);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+uint32_t lv_draw_sw_mipmap_get_level(const lv_image_header_t * header, int32_t scale_x, int32_t scale_y)
+{
+    /*Use the larger scale to not blur the image in the other direction*/
+    int32_t scale = LV_MAX(scale_x, scale_y);
+    if(scale <= 0) return 0;
+
+    /*Go down while the copy still doesn't need to be upscaled*/
+    uint32_t level = 0;
+    while(level < MIPMAP_LEVEL_MAX && (scale << (level + 1)) <= LV_SCALE_NONE &&
+          (header->w >> (level + 1)) > 0 && (header->h >> (level + 1)) > 0) {
+        level++;
+    }
+
+    return level;
+}
+
+const lv_draw_buf_t * lv_draw_sw_mipmap_get(const lv_image_decoder_dsc_t * decoder_dsc, uint32_t level,
+                                            lv_cache_entry_t ** cache_entry)
+{
+    const lv_draw_buf_t * decoded = decoder_dsc->decoded;
+    lv_cache_entry_t * img_entry = decoder_dsc->cache_entry;
+    if(decoded == NULL || img_entry == NULL || level == 0) return NULL;
+
+    switch(decoded->header.cf) {
+        case LV_COLOR_FORMAT_ARGB8888:
+        case LV_COLOR_FORMAT_XRGB8888:
+        case LV_COLOR_FORMAT_RGB888:
+        case LV_COLOR_FORMAT_RGB565:
+        case LV_COLOR_FORMAT_RGB565A8:
+        case LV_COLOR_FORMAT_A8:
+            break;
+        default:
+            return NULL;
+    }
+
+    lv_cache_lock();
+    if(mipmap_data_type == 0) mipmap_data_type = lv_cache_register_data_type();
+
+    /*Start from the smallest copy which is already generated and not smaller than the requested one*/
+    lv_cache_entry_t * src_entry = NULL;
+    lv_cache_entry_t * entry = lv_cache_find_by_src(NULL, img_entry->src, img_entry->src_type);
+    while(entry) {
+        if(entry->data_type == mipmap_data_type && entry->param1 <= (int32_t)level &&
+           (src_entry == NULL || entry->param1 > src_entry->param1)) {
+            src_entry = entry;
+        }
+        entry = lv_cache_find_by_src(entry, img_entry->src, img_entry->src_type);
+    }
+
+    /*Get the data to be sure the copy is not dropped while the next level is generated from it*/
+    const lv_draw_buf_t * src_buf = src_entry ? lv_cache_get_data(src_entry) : decoded;
+    uint32_t src_level = src_entry ? (uint32_t)src_entry->param1 : 0;
+
+    while(src_level < level) {
+        uint32_t t = lv_tick_get();
+        lv_draw_buf_t * new_buf = downscale(src_buf);
+        if(new_buf == NULL) break;
+
+        lv_cache_entry_t * new_entry = lv_cache_add(new_buf, 0, mipmap_data_type, new_buf->data_size);
+        if(new_entry == NULL) {
+            lv_draw_buf_destroy(new_buf);
+            break;
+        }
+
+        src_level++;
+        new_entry->weight = LV_MAX(lv_tick_elaps(t), 1);
+        new_entry->invalidate_cb = cache_invalidate_cb;
+        new_entry->param1 = src_level;
+        new_entry->src_type = img_entry->src_type;
+        if(img_entry->src_type == LV_CACHE_SRC_TYPE_PATH) new_entry->src = lv_strdup(img_entry->src);
+        else new_entry->src = img_entry->src;
+
+        if(src_entry) lv_cache_release(src_entry);
+        src_entry = new_entry;
+        src_buf = lv_cache_get_data(new_entry);
+    }
+
+    if(src_level != level) {
+        LV_LOG_WARN("Couldn't create mip level %" LV_PRIu32, level);
+        if(src_entry) lv_cache_release(src_entry);
+        lv_cache_unlock();
+        return NULL;
+    }
+
+    lv_cache_unlock();
+
+    *cache_entry = src_entry;
+    return src_buf;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Create a half sized copy of a buffer by averaging 2x2 pixels.
+ * On odd sizes the last row and column are repeated.
+ * @param src   the buffer to downscale
+ * @return      the new buffer or NULL if out of memory
+ */
+static lv_draw_buf_t * downscale(const lv_draw_buf_t * src)
+{
+    lv_color_format_t cf = src->header.cf;
+    int32_t src_w = src->header.w;
+    int32_t src_h = src->header.h;
+    int32_t src_stride = src->header.stride;
+    int32_t dest_w = (src_w + 1) >> 1;
+    int32_t dest_h = (src_h + 1) >> 1;
+
+    /*The alpha map of RGB565A8 is stored after the color map with half stride*/
+    uint32_t dest_stride = cf == LV_COLOR_FORMAT_RGB565A8 ?
+                           lv_draw_buf_width_to_stride(dest_w, LV_COLOR_FORMAT_RGB565) : 0;
+    lv_draw_buf_t * dest = lv_draw_buf_create(dest_w, dest_h, cf, dest_stride);
+    if(dest == NULL) return NULL;
+    dest_stride = dest->header.stride;
+
+    const uint8_t * src_data = src->data;
+    uint8_t * dest_data = dest->data;
+
+    switch(cf) {
+        case LV_COLOR_FORMAT_ARGB8888:
+            downscale_argb8888(src_data, src_w, src_h, src_stride, dest_data, dest_w, dest_h, dest_stride);
+            break;
+        case LV_COLOR_FORMAT_XRGB8888:
+            downscale_rgb888(src_data, src_w, src_h, src_stride, dest_data, dest_w, dest_h, dest_stride, 4);
+            break;
+        case LV_COLOR_FORMAT_RGB888:
+            downscale_rgb888(src_data, src_w, src_h, src_stride, dest_data, dest_w, dest_h, dest_stride, 3);
+            break;
+        case LV_COLOR_FORMAT_RGB565:
+            downscale_rgb565(src_data, NULL, src_w, src_h, src_stride, dest_data, dest_w, dest_h, dest_stride);
+            break;
+        case LV_COLOR_FORMAT_RGB565A8:
+            downscale_rgb565(src_data, src_data + src_stride * src_h, src_w, src_h, src_stride,
+                             dest_data, dest_w, dest_h, dest_stride);
+            downscale_a8(src_data + src_stride * src_h, src_w, src_h, src_stride / 2,
+                         dest_data + dest_stride * dest_h, dest_w, dest_h, dest_stride / 2);
+            break;
+        case LV_COLOR_FORMAT_A8:
+            downscale_a8(src_data, src_w, src_h, src_stride, dest_data, dest_w, dest_h, dest_stride);
+            break;
+        default:
+            lv_draw_buf_destroy(dest);
+            return NULL;
+    }
+
+    return dest;
+}
+
+static void downscale_argb8888(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t src_stride,
+                               uint8_t * dest, int32_t dest_w, int32_t dest_h, int32_t dest_stride)
+{
+    int32_t y;
+    for(y = 0; y < dest_h; y++) {
+        const lv_color32_t * row0 = (const lv_color32_t *)(src + 2 * y * src_stride);
+        const lv_color32_t * row1 = (const lv_color32_t *)(src + LV_MIN(2 * y + 1, src_h - 1) * src_stride);
+        lv_color32_t * dest_row = (lv_color32_t *)(dest + y * dest_stride);
+        int32_t x;
+        for(x = 0; x < dest_w; x++) {
+            int32_t x0 = 2 * x;
+            int32_t x1 = LV_MIN(x0 + 1, src_w - 1);
+            const lv_color32_t * px[4] = {&row0[x0], &row0[x1], &row1[x0], &row1[x1]};
+
+            /*Weight the colors with their opacity to not mix in the color of the transparent pixels*/
+            uint32_t a_sum = px[0]->alpha + px[1]->alpha + px[2]->alpha + px[3]->alpha;
+            if(a_sum == 0) {
+                lv_memzero(&dest_row[x], sizeof(lv_color32_t));
+                continue;
+            }
+
+            uint32_t r = 0;
+            uint32_t g = 0;
+            uint32_t b = 0;
+            uint32_t i;
+            for(i = 0; i < 4; i++) {
+                r += px[i]->red * px[i]->alpha;
+                g += px[i]->green * px[i]->alpha;
+                b += px[i]->blue * px[i]->alpha;
+            }
+
+            dest_row[x].red = (r + (a_sum >> 1)) / a_sum;
+            dest_row[x].green = (g + (a_sum >> 1)) / a_sum;
+            dest_row[x].blue = (b + (a_sum >> 1)) / a_sum;
+            dest_row[x].alpha = (a_sum + 2) >> 2;
+        }
+    }
+}
+
+static void downscale_rgb888(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t src_stride,
+                             uint8_t * dest, int32_t dest_w, int32_t dest_h, int32_t dest_stride, uint32_t px_size)
+{
+    int32_t y;
+    for(y = 0; y < dest_h; y++) {
+        const uint8_t * row0 = src + 2 * y * src_stride;
+        const uint8_t * row1 = src + LV_MIN(2 * y + 1, src_h - 1) * src_stride;
+        uint8_t * dest_px = dest + y * dest_stride;
+        int32_t x;
+        for(x = 0; x < dest_w; x++) {
+            uint32_t i0 = 2 * x * px_size;
+            uint32_t i1 = LV_MIN(2 * x + 1, src_w - 1) * px_size;
+            uint32_t c;
+            for(c = 0; c < 3; c++) {
+                dest_px[c] = (row0[i0 + c] + row0[i1 + c] + row1[i0 + c] + row1[i1 + c] + 2) >> 2;
+            }
+            if(px_size == 4) dest_px[3] = 0xff;
+            dest_px += px_size;
+        }
+    }
+}
+
+/**
+ * Downscale an RGB565 color map
+ * @param src_a     if not NULL the alpha map of an RGB565A8 image to weight the colors with
+ */
+static void downscale_rgb565(const uint8_t * src, const uint8_t * src_a, int32_t src_w, int32_t src_h,
+                             int32_t src_stride, uint8_t * dest, int32_t dest_w, int32_t dest_h, int32_t dest_stride)
+{
+    int32_t src_a_stride = src_stride / 2;
+    int32_t y;
+    for(y = 0; y < dest_h; y++) {
+        int32_t y0 = 2 * y;
+        int32_t y1 = LV_MIN(y0 + 1, src_h - 1);
+        const uint16_t * row0 = (const uint16_t *)(src + y0 * src_stride);
+        const uint16_t * row1 = (const uint16_t *)(src + y1 * src_stride);
+        uint16_t * dest_row = (uint16_t *)(dest + y * dest_stride);
+        int32_t x;
+        for(x = 0; x < dest_w; x++) {
+            int32_t x0 = 2 * x;
+            int32_t x1 = LV_MIN(x0 + 1, src_w - 1);
+            uint16_t px[4] = {row0[x0], row0[x1], row1[x0], row1[x1]};
+            uint32_t a[4] = {1, 1, 1, 1};
+            if(src_a) {
+                a[0] = src_a[y0 * src_a_stride + x0];
+                a[1] = src_a[y0 * src_a_stride + x1];
+                a[2] = src_a[y1 * src_a_stride + x0];
+                a[3] = src_a[y1 * src_a_stride + x1];
+            }
+
+            uint32_t a_sum = a[0] + a[1] + a[2] + a[3];
+            if(a_sum == 0) {
+                dest_row[x] = 0;
+                continue;
+            }
+
+            uint32_t r = 0;
+            uint32_t g = 0;
+            uint32_t b = 0;
+            uint32_t i;
+            for(i = 0; i < 4; i++) {
+                r += (px[i] >> 11) * a[i];
+                g += ((px[i] >> 5) & 0x3F) * a[i];
+                b += (px[i] & 0x1F) * a[i];
+            }
+
+            r = (r + (a_sum >> 1)) / a_sum;
+            g = (g + (a_sum >> 1)) / a_sum;
+            b = (b + (a_sum >> 1)) / a_sum;
+            dest_row[x] = (uint16_t)((r << 11) | (g << 5) | b);
+        }
+    }
+}
+
+static void downscale_a8(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t src_stride,
+                         uint8_t * dest, int32_t dest_w, int32_t dest_h, int32_t dest_stride)
+{
+    int32_t y;
+    for(y = 0; y < dest_h; y++) {
+        const uint8_t * row0 = src + 2 * y * src_stride;
+        const uint8_t * row1 = src + LV_MIN(2 * y + 1, src_h - 1) * src_stride;
+        uint8_t * dest_row = dest + y * dest_stride;
+        int32_t x;
+        for(x = 0; x < dest_w; x++) {
+            int32_t x0 = 2 * x;
+            int32_t x1 = LV_MIN(x0 + 1, src_w - 1);
+            dest_row[x] = (row0[x0] + row0[x1] + row1[x0] + row1[x1] + 2) >> 2;
+        }
+    }
+}
+
+static void cache_invalidate_cb(lv_cache_entry_t * entry)
+{
+    lv_draw_buf_destroy((lv_draw_buf_t *)entry->data);
+    if(entry->src_type == LV_CACHE_SRC_TYPE_PATH) lv_free((void *)entry->src);
+}
+
+#endif /*LV_USE_DRAW_SW && LV_DRAW_SW_IMAGE_MIPMAP*/
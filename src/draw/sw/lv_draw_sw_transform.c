@@ -22,27 +22,46 @@
 /**********************
  *      TYPEDEFS
  **********************/
+/*Maps the destination pixels back to the image: out = M * (in - pivot) + pivot.
+ *The matrix elements are upscaled by 2^18 (256 for the sub-pixel output and 1024 for the trigonometry)*/
 typedef struct {
-    int32_t x_in;
-    int32_t y_in;
-    int32_t x_out;
-    int32_t y_out;
-    int32_t sinma;
-    int32_t cosma;
-    int32_t scale_x;
-    int32_t scale_y;
-    int32_t angle;
+    int64_t m00;
+    int64_t m01;
+    int64_t m10;
+    int64_t m11;
     int32_t pivot_x_256;
     int32_t pivot_y_256;
     lv_point_t pivot;
 } point_transform_dsc_t;
 
+/*Where to sample the image along one axis with 1/256 precision*/
+typedef struct {
+    int32_t i;          /*Index of the nearest pixel or -1 if it's out of the image*/
+    int16_t next;       /*-1 or 1: direction of the neighbor to mix with. 0 if it's out of the image*/
+    uint8_t fract;      /*Weight of the neighbor in 0x00..0x7F range*/
+} scale_sample_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+/**
+ * Initialize the inverse transformation of a draw descriptor
+ * @param t         pointer to a `point_transform_dsc_t` structure to initialize
+ * @param draw_dsc  the rotation, scale, skew and pivot are used from it
+ */
+static void transform_dsc_init(point_transform_dsc_t * t, const lv_draw_image_dsc_t * draw_dsc);
+
+/**
+ * Get the sine and cosine of an angle with 0.1 degree resolution
+ * @param angle     the angle in 0.1 degree units
+ * @param sinma     store the sine upscaled by 1024 here
+ * @param cosma     store the cosine upscaled by 1024 here
+ */
+static void get_sin_cos_1024(int32_t angle, int32_t * sinma, int32_t * cosma);
+
 /**
  * Transform a point with 1/256 precision (the output coordinates are upscaled by 256)
- * @param t         pointer to n initialized `point_transform_dsc_t` structure
+ * @param t         pointer to an initialized `point_transform_dsc_t` structure
  * @param xin       X coordinate to rotate
  * @param yin       Y coordinate to rotate
  * @param xout      upscaled, transformed X
@@ -67,6 +86,29 @@ static void transform_a8(const uint8_t * src, int32_t src_w, int32_t src_h, int3
                          int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
                          int32_t x_end, uint8_t * abuf, bool aa);
 
+/**
+ * Get the nearest pixel, the neighbor to mix with and its weight along one axis.
+ * Gives the same results as the per-pixel calculations of the `transform_...` functions.
+ * @param s         store the result here
+ * @param ups       the upscaled coordinate in the image
+ * @param size      width or height of the image
+ */
+static void scale_sample_init(scale_sample_t * s, int32_t ups, int32_t size);
+
+/*Scale-only variants of the `transform_...` functions: one row is sampled using the precalculated columns*/
+static void scale_rgb888(const uint8_t * src, int32_t src_stride, const scale_sample_t * cols,
+                         const scale_sample_t * row, int32_t x_end, uint8_t * dest_buf, bool aa, uint32_t px_size);
+
+static void scale_argb8888(const uint8_t * src, int32_t src_stride, const scale_sample_t * cols,
+                           const scale_sample_t * row, int32_t x_end, uint8_t * dest_buf, bool aa);
+
+static void scale_rgb565a8(const uint8_t * src, int32_t src_h, int32_t src_stride, const scale_sample_t * cols,
+                           const scale_sample_t * row, int32_t x_end, uint16_t * cbuf, uint8_t * abuf,
+                           bool src_has_a8, bool aa);
+
+static void scale_a8(const uint8_t * src, int32_t src_stride, const scale_sample_t * cols,
+                     const scale_sample_t * row, int32_t x_end, uint8_t * abuf, bool aa);
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -83,31 +125,8 @@ void lv_draw_sw_transform(lv_draw_unit_t * draw_unit, const lv_area_t * dest_are
                           int32_t src_w, int32_t src_h, int32_t src_stride,
                           const lv_draw_image_dsc_t * draw_dsc, const lv_draw_image_sup_t * sup, lv_color_format_t src_cf, void * dest_buf)
 {
-    LV_UNUSED(draw_unit);
-    LV_UNUSED(sup);
-
     point_transform_dsc_t tr_dsc;
-    tr_dsc.angle = -draw_dsc->rotation;
-    tr_dsc.scale_x = (256 * 256) / draw_dsc->scale_x;
-    tr_dsc.scale_y = (256 * 256) / draw_dsc->scale_y;
-    tr_dsc.pivot = draw_dsc->pivot;
-
-    int32_t angle_low = tr_dsc.angle / 10;
-    int32_t angle_high = angle_low + 1;
-    int32_t angle_rem = tr_dsc.angle  - (angle_low * 10);
-
-    int32_t s1 = lv_trigo_sin(angle_low);
-    int32_t s2 = lv_trigo_sin(angle_high);
-
-    int32_t c1 = lv_trigo_sin(angle_low + 90);
-    int32_t c2 = lv_trigo_sin(angle_high + 90);
-
-    tr_dsc.sinma = (s1 * (10 - angle_rem) + s2 * angle_rem) / 10;
-    tr_dsc.cosma = (c1 * (10 - angle_rem) + c2 * angle_rem) / 10;
-    tr_dsc.sinma = tr_dsc.sinma >> (LV_TRIGO_SHIFT - 10);
-    tr_dsc.cosma = tr_dsc.cosma >> (LV_TRIGO_SHIFT - 10);
-    tr_dsc.pivot_x_256 = tr_dsc.pivot.x * 256;
-    tr_dsc.pivot_y_256 = tr_dsc.pivot.y * 256;
+    transform_dsc_init(&tr_dsc, draw_dsc);
 
     int32_t dest_w = lv_area_get_width(dest_area);
     int32_t dest_h = lv_area_get_height(dest_area);
@@ -134,6 +153,67 @@ void lv_draw_sw_transform(lv_draw_unit_t * draw_unit, const lv_area_t * dest_are
     }
 
     bool aa = draw_dsc->antialias;
+    int32_t mip_level = sup ? sup->mip_level : 0;
+
+    /*If the image is only scaled the columns are sampled the same way in every row
+     *so calculate them only once and sample each row using them*/
+    scale_sample_t * cols = NULL;
+    if(tr_dsc.m01 == 0 && tr_dsc.m10 == 0) {
+        cols = lv_draw_arena_alloc(draw_unit, dest_w * sizeof(scale_sample_t));
+    }
+
+    if(cols) {
+        int32_t xs1_ups, xs2_ups, ys_ups;
+        transform_point_upscaled(&tr_dsc, dest_area->x1, dest_area->y1, &xs1_ups, &ys_ups);
+        transform_point_upscaled(&tr_dsc, dest_area->x2, dest_area->y1, &xs2_ups, &ys_ups);
+
+        int32_t xs_step_256 = 0;
+        if(dest_w > 1) xs_step_256 = (256 * (xs2_ups - xs1_ups)) / (dest_w - 1);
+        int32_t xs_ups = (xs1_ups + 0x80) >> mip_level;
+        xs_step_256 = xs_step_256 >> mip_level;
+
+        int32_t x;
+        for(x = 0; x < dest_w; x++) {
+            scale_sample_init(&cols[x], xs_ups + ((xs_step_256 * x) >> 8), src_w);
+        }
+
+        int32_t y;
+        for(y = 0; y < dest_h; y++) {
+            /*The X coordinates are the same in each row, only Y is needed*/
+            transform_point_upscaled(&tr_dsc, dest_area->x1, dest_area->y1 + y, &xs1_ups, &ys_ups);
+            scale_sample_t row;
+            scale_sample_init(&row, (ys_ups + 0x80) >> mip_level, src_h);
+
+            switch(src_cf) {
+                case LV_COLOR_FORMAT_XRGB8888:
+                    scale_rgb888(src_buf, src_stride, cols, &row, dest_w, dest_buf, aa, 4);
+                    break;
+                case LV_COLOR_FORMAT_RGB888:
+                    scale_rgb888(src_buf, src_stride, cols, &row, dest_w, dest_buf, aa, 3);
+                    break;
+                case LV_COLOR_FORMAT_A8:
+                    scale_a8(src_buf, src_stride, cols, &row, dest_w, dest_buf, aa);
+                    break;
+                case LV_COLOR_FORMAT_ARGB8888:
+                    scale_argb8888(src_buf, src_stride, cols, &row, dest_w, dest_buf, aa);
+                    break;
+                case LV_COLOR_FORMAT_RGB565:
+                    scale_rgb565a8(src_buf, src_h, src_stride, cols, &row, dest_w, dest_buf, alpha_buf, false, aa);
+                    break;
+                case LV_COLOR_FORMAT_RGB565A8:
+                    scale_rgb565a8(src_buf, src_h, src_stride, cols, &row, dest_w, dest_buf, alpha_buf, true, aa);
+                    break;
+                default:
+                    break;
+            }
+
+            dest_buf = (uint8_t *)dest_buf + dest_stride;
+            if(alpha_buf) alpha_buf += dest_stride_a8;
+        }
+
+        lv_draw_arena_free(draw_unit, cols);
+        return;
+    }
 
     int32_t y;
     for(y = 0; y < dest_h; y++) {
@@ -154,6 +234,14 @@ void lv_draw_sw_transform(lv_draw_unit_t * draw_unit, const lv_area_t * dest_are
         int32_t xs_ups = xs1_ups + 0x80;
         int32_t ys_ups = ys1_ups + 0x80;
 
+        /*A pixel of a mip level covers 2^mip_level x 2^mip_level pixels of the image*/
+        if(mip_level) {
+            xs_ups = xs_ups >> mip_level;
+            ys_ups = ys_ups >> mip_level;
+            xs_step_256 = xs_step_256 >> mip_level;
+            ys_step_256 = ys_step_256 >> mip_level;
+        }
+
         switch(src_cf) {
             case LV_COLOR_FORMAT_XRGB8888:
                 transform_rgb888(src_buf, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step_256, ys_step_256, dest_w, dest_buf, aa,
@@ -485,6 +573,9 @@ static void transform_rgb565a8(const uint8_t * src, int32_t src_w, int32_t src_h
             else if((ys_int == 0 && y_next < 0) || (ys_int == src_h - 1 && y_next > 0))  {
                 abuf[x] = (a * (0xFF - ys_fract)) >> 8;
             }
+            else {
+                abuf[x] = a;
+            }
         }
     }
 }
@@ -563,30 +654,336 @@ static void transform_a8(const uint8_t * src, int32_t src_w, int32_t src_h, int3
     }
 }
 
-static void transform_point_upscaled(point_transform_dsc_t * t, int32_t xin, int32_t yin, int32_t * xout,
-                                     int32_t * yout)
+static void scale_sample_init(scale_sample_t * s, int32_t ups, int32_t size)
 {
-    if(t->angle == 0 && t->scale_x == LV_SCALE_NONE && t->scale_y == LV_SCALE_NONE) {
-        *xout = xin * 256;
-        *yout = yin * 256;
+    s->i = ups >> 8;
+    if(s->i < 0 || s->i >= size) {
+        s->i = -1;
+        s->next = 0;
+        s->fract = 0;
         return;
     }
 
-    xin -= t->pivot.x;
-    yin -= t->pivot.y;
+    int32_t fract = ups & 0xFF;
+    if(fract < 0x80) {
+        s->next = -1;
+        s->fract = 0x7F - fract;
+    }
+    else {
+        s->next = 1;
+        s->fract = fract - 0x80;
+    }
 
-    if(t->angle == 0) {
-        *xout = ((int32_t)(xin * t->scale_x)) + (t->pivot_x_256);
-        *yout = ((int32_t)(yin * t->scale_y)) + (t->pivot_y_256);
+    if(s->i + s->next < 0 || s->i + s->next > size - 1) s->next = 0;
+}
+
+static void scale_rgb888(const uint8_t * src, int32_t src_stride, const scale_sample_t * cols,
+                         const scale_sample_t * row, int32_t x_end, uint8_t * dest_buf, bool aa, uint32_t px_size)
+{
+    lv_color32_t * dest_c32 = (lv_color32_t *) dest_buf;
+    int32_t x;
+
+    /*Fully out of the image*/
+    if(row->i < 0) {
+        for(x = 0; x < x_end; x++) dest_c32[x].alpha = 0x00;
+        return;
     }
-    else if(t->scale_x == LV_SCALE_NONE && t->scale_y == LV_SCALE_NONE) {
-        *xout = ((t->cosma * xin - t->sinma * yin) >> 2) + (t->pivot_x_256);
-        *yout = ((t->sinma * xin + t->cosma * yin) >> 2) + (t->pivot_y_256);
+
+    const uint8_t * src_row = src + row->i * src_stride;
+    int32_t ver_ofs = row->next * src_stride;
+    int32_t ys_fract = row->fract;
+
+    for(x = 0; x < x_end; x++) {
+        const scale_sample_t * col = &cols[x];
+        if(col->i < 0) {
+            dest_c32[x].alpha = 0x00;
+            continue;
+        }
+
+        const uint8_t * src_u8 = src_row + col->i * px_size;
+        dest_c32[x].red = src_u8[2];
+        dest_c32[x].green = src_u8[1];
+        dest_c32[x].blue = src_u8[0];
+        dest_c32[x].alpha = 0xff;
+
+        if(aa && col->next && row->next) {
+            const uint8_t * px_hor_u8 = src_u8 + (int32_t)(col->next * px_size);
+            lv_color32_t px_hor;
+            px_hor.red = px_hor_u8[2];
+            px_hor.green = px_hor_u8[1];
+            px_hor.blue = px_hor_u8[0];
+            px_hor.alpha = 0xff;
+
+            const uint8_t * px_ver_u8 = src_u8 + ver_ofs;
+            lv_color32_t px_ver;
+            px_ver.red = px_ver_u8[2];
+            px_ver.green = px_ver_u8[1];
+            px_ver.blue = px_ver_u8[0];
+            px_ver.alpha = 0xff;
+
+            if(!lv_color32_eq(dest_c32[x], px_ver)) {
+                px_ver.alpha = ys_fract;
+                dest_c32[x] = lv_color_mix32(px_ver, dest_c32[x]);
+            }
+
+            if(!lv_color32_eq(dest_c32[x], px_hor)) {
+                px_hor.alpha = col->fract;
+                dest_c32[x] = lv_color_mix32(px_hor, dest_c32[x]);
+            }
+        }
+        /*Partially out of the image*/
+        else if(col->next == 0) {
+            dest_c32[x].alpha = (0xFF * (0xFF - col->fract)) >> 8;
+        }
+        else if(row->next == 0) {
+            dest_c32[x].alpha = (0xFF * (0xFF - ys_fract)) >> 8;
+        }
     }
-    else {
-        *xout = (((t->cosma * xin - t->sinma * yin) * t->scale_x) >> 10) + (t->pivot_x_256);
-        *yout = (((t->sinma * xin + t->cosma * yin) * t->scale_y) >> 10) + (t->pivot_y_256);
+}
+
+static void scale_argb8888(const uint8_t * src, int32_t src_stride, const scale_sample_t * cols,
+                           const scale_sample_t * row, int32_t x_end, uint8_t * dest_buf, bool aa)
+{
+    /*Fully out of the image*/
+    if(row->i < 0) {
+        lv_memzero(dest_buf, x_end * sizeof(lv_color32_t));
+        return;
     }
+
+    lv_color32_t * dest_c32 = (lv_color32_t *) dest_buf;
+    const lv_color32_t * src_row = (const lv_color32_t *)(src + row->i * src_stride);
+    int32_t ver_ofs = row->next * src_stride;
+    int32_t ys_fract = row->fract;
+
+    int32_t x;
+    for(x = 0; x < x_end; x++) {
+        const scale_sample_t * col = &cols[x];
+        if(col->i < 0) {
+            ((uint32_t *)dest_buf)[x] = 0x00000000;
+            continue;
+        }
+
+        const lv_color32_t * src_c32 = src_row + col->i;
+        dest_c32[x] = src_c32[0];
+
+        if(aa && col->next && row->next) {
+            int32_t xs_fract = col->fract;
+            lv_color32_t px_hor = src_c32[col->next];
+            lv_color32_t px_ver = *(const lv_color32_t *)((const uint8_t *)src_c32 + ver_ofs);
+
+            if(px_ver.alpha == 0) {
+                dest_c32[x].alpha = (dest_c32[x].alpha * (0xFF - ys_fract)) >> 8;
+            }
+            else if(!lv_color32_eq(dest_c32[x], px_ver)) {
+                dest_c32[x].alpha = ((px_ver.alpha * ys_fract) + (dest_c32[x].alpha * (0xFF - ys_fract))) >> 8;
+                px_ver.alpha = ys_fract;
+                dest_c32[x] = lv_color_mix32(px_ver, dest_c32[x]);
+            }
+
+            if(px_hor.alpha == 0) {
+                dest_c32[x].alpha = (dest_c32[x].alpha * (0xFF - xs_fract)) >> 8;
+            }
+            else if(!lv_color32_eq(dest_c32[x], px_hor)) {
+                dest_c32[x].alpha = ((px_hor.alpha * xs_fract) + (dest_c32[x].alpha * (0xFF - xs_fract))) >> 8;
+                px_hor.alpha = xs_fract;
+                dest_c32[x] = lv_color_mix32(px_hor, dest_c32[x]);
+            }
+        }
+        /*Partially out of the image*/
+        else if(col->next == 0) {
+            dest_c32[x].alpha = (dest_c32[x].alpha * (0x7F - col->fract)) >> 7;
+        }
+        else if(row->next == 0) {
+            dest_c32[x].alpha = (dest_c32[x].alpha * (0x7F - ys_fract)) >> 7;
+        }
+    }
+}
+
+static void scale_rgb565a8(const uint8_t * src, int32_t src_h, int32_t src_stride, const scale_sample_t * cols,
+                           const scale_sample_t * row, int32_t x_end, uint16_t * cbuf, uint8_t * abuf,
+                           bool src_has_a8, bool aa)
+{
+    /*Fully out of the image*/
+    if(row->i < 0) {
+        lv_memzero(abuf, x_end);
+        return;
+    }
+
+    /*Must be signed type, because we would use negative array index calculated from stride*/
+    int32_t alpha_stride = src_stride / 2; /*alpha map stride is always half of RGB map stride*/
+
+    const uint16_t * src_row = (const uint16_t *)(src + row->i * src_stride);
+    const lv_opa_t * src_alpha_row = src + src_stride * src_h + row->i * alpha_stride;
+    int32_t ver_ofs = row->next * src_stride;
+    int32_t ys_fract = row->fract * 2;
+
+    int32_t x;
+    for(x = 0; x < x_end; x++) {
+        const scale_sample_t * col = &cols[x];
+        if(col->i < 0) {
+            abuf[x] = 0x00;
+            continue;
+        }
+
+        int32_t xs_fract = col->fract * 2;
+        const uint16_t * src_tmp_u16 = src_row + col->i;
+        cbuf[x] = src_tmp_u16[0];
+
+        lv_opa_t a = src_has_a8 ? src_alpha_row[col->i] : 0xff;
+
+        if(aa && col->next && row->next) {
+            uint16_t px_hor = src_tmp_u16[col->next];
+            uint16_t px_ver = *(const uint16_t *)((const uint8_t *)src_tmp_u16 + ver_ofs);
+
+            if(src_has_a8) {
+                const lv_opa_t * src_alpha_tmp = src_alpha_row + col->i;
+                abuf[x] = a;
+
+                lv_opa_t a_hor = src_alpha_tmp[col->next];
+                lv_opa_t a_ver = src_alpha_tmp[row->next * alpha_stride];
+
+                if(a_ver != abuf[x]) a_ver = ((a_ver * ys_fract) + (abuf[x] * (0x100 - ys_fract))) >> 8;
+                if(a_hor != abuf[x]) a_hor = ((a_hor * xs_fract) + (abuf[x] * (0x100 - xs_fract))) >> 8;
+                abuf[x] = (a_ver + a_hor) >> 1;
+
+                if(abuf[x] == 0x00) continue;
+            }
+            else {
+                abuf[x] = 0xff;
+            }
+
+            if(cbuf[x] != px_ver || cbuf[x] != px_hor) {
+                uint16_t v = lv_color_16_16_mix(px_ver, cbuf[x], ys_fract);
+                uint16_t h = lv_color_16_16_mix(px_hor, cbuf[x], xs_fract);
+                cbuf[x] = lv_color_16_16_mix(h, v, LV_OPA_50);
+            }
+        }
+        /*Partially out of the image*/
+        else if(col->next == 0) {
+            abuf[x] = (a * (0xFF - xs_fract)) >> 8;
+        }
+        else if(row->next == 0) {
+            abuf[x] = (a * (0xFF - ys_fract)) >> 8;
+        }
+        else {
+            abuf[x] = a;
+        }
+    }
+}
+
+static void scale_a8(const uint8_t * src, int32_t src_stride, const scale_sample_t * cols,
+                     const scale_sample_t * row, int32_t x_end, uint8_t * abuf, bool aa)
+{
+    /*Fully out of the image*/
+    if(row->i < 0) {
+        lv_memzero(abuf, x_end);
+        return;
+    }
+
+    const uint8_t * src_row = src + row->i * src_stride;
+    int32_t ver_ofs = row->next * src_stride;
+    int32_t ys_fract = row->fract * 2;
+
+    int32_t x;
+    for(x = 0; x < x_end; x++) {
+        const scale_sample_t * col = &cols[x];
+        if(col->i < 0) {
+            abuf[x] = 0x00;
+            continue;
+        }
+
+        int32_t xs_fract = col->fract * 2;
+        const uint8_t * src_tmp = src_row + col->i;
+        abuf[x] = src_tmp[0];
+
+        if(aa && col->next && row->next) {
+            lv_opa_t a_ver = src_tmp[col->next];
+            lv_opa_t a_hor = src_tmp[ver_ofs];
+
+            if(a_ver != abuf[x]) a_ver = ((a_ver * ys_fract) + (abuf[x] * (0x100 - ys_fract))) >> 8;
+            if(a_hor != abuf[x]) a_hor = ((a_hor * xs_fract) + (abuf[x] * (0x100 - xs_fract))) >> 8;
+            abuf[x] = (a_ver + a_hor) >> 1;
+        }
+        /*Partially out of the image*/
+        else if(col->next == 0) {
+            abuf[x] = (src_tmp[0] * (0xFF - xs_fract)) >> 8;
+        }
+        else if(row->next == 0) {
+            abuf[x] = (src_tmp[0] * (0xFF - ys_fract)) >> 8;
+        }
+    }
+}
+
+static void transform_dsc_init(point_transform_dsc_t * t, const lv_draw_image_dsc_t * draw_dsc)
+{
+    /*Inverse rotation and scale*/
+    int32_t sinma = 0;
+    int32_t cosma = 1024;
+    if(draw_dsc->rotation) get_sin_cos_1024(-draw_dsc->rotation, &sinma, &cosma);
+    int32_t scale_x = (256 * 256) / draw_dsc->scale_x;
+    int32_t scale_y = (256 * 256) / draw_dsc->scale_y;
+
+    t->m00 = (int64_t)cosma * scale_x;
+    t->m01 = -(int64_t)sinma * scale_x;
+    t->m10 = (int64_t)sinma * scale_y;
+    t->m11 = (int64_t)cosma * scale_y;
+
+    /*The skew is applied first, so its inverse is applied last.
+     *inv([[1, tan_x], [tan_y, 1]]) = [[1, -tan_x], [-tan_y, 1]] / (1 - tan_x * tan_y)*/
+    if(draw_dsc->skew_x || draw_dsc->skew_y) {
+        int32_t s;
+        int32_t c;
+        get_sin_cos_1024(LV_MIN(LV_ABS(draw_dsc->skew_x), 890), &s, &c);
+        int64_t tan_x = (int64_t)s * 1024 / c;
+        if(draw_dsc->skew_x < 0) tan_x = -tan_x;
+        get_sin_cos_1024(LV_MIN(LV_ABS(draw_dsc->skew_y), 890), &s, &c);
+        int64_t tan_y = (int64_t)s * 1024 / c;
+        if(draw_dsc->skew_y < 0) tan_y = -tan_y;
+
+        int64_t det = 1024 * 1024 - tan_x * tan_y;
+        if(det == 0) det = 1;   /*Degenerated to a line. Just avoid dividing by zero.*/
+
+        int64_t m00 = t->m00;
+        int64_t m01 = t->m01;
+        int64_t m10 = t->m10;
+        int64_t m11 = t->m11;
+        t->m00 = (m00 * 1024 - tan_x * m10) * 1024 / det;
+        t->m01 = (m01 * 1024 - tan_x * m11) * 1024 / det;
+        t->m10 = (m10 * 1024 - tan_y * m00) * 1024 / det;
+        t->m11 = (m11 * 1024 - tan_y * m01) * 1024 / det;
+    }
+
+    t->pivot = draw_dsc->pivot;
+    t->pivot_x_256 = t->pivot.x * 256;
+    t->pivot_y_256 = t->pivot.y * 256;
+}
+
+static void get_sin_cos_1024(int32_t angle, int32_t * sinma, int32_t * cosma)
+{
+    int32_t angle_low = angle / 10;
+    int32_t angle_high = angle_low + 1;
+    int32_t angle_rem = angle  - (angle_low * 10);
+
+    int32_t s1 = lv_trigo_sin(angle_low);
+    int32_t s2 = lv_trigo_sin(angle_high);
+
+    int32_t c1 = lv_trigo_sin(angle_low + 90);
+    int32_t c2 = lv_trigo_sin(angle_high + 90);
+
+    *sinma = (s1 * (10 - angle_rem) + s2 * angle_rem) / 10;
+    *cosma = (c1 * (10 - angle_rem) + c2 * angle_rem) / 10;
+    *sinma = *sinma >> (LV_TRIGO_SHIFT - 10);
+    *cosma = *cosma >> (LV_TRIGO_SHIFT - 10);
+}
+
+static void transform_point_upscaled(point_transform_dsc_t * t, int32_t xin, int32_t yin, int32_t * xout,
+                                     int32_t * yout)
+{
+    xin -= t->pivot.x;
+    yin -= t->pivot.y;
+
+    *xout = (int32_t)((t->m00 * xin + t->m01 * yin) >> 10) + t->pivot_x_256;
+    *yout = (int32_t)((t->m10 * xin + t->m11 * yin) >> 10) + t->pivot_y_256;
 }
 
 #endif /*LV_USE_DRAW_SW*/
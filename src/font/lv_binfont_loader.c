@@ -121,6 +121,8 @@ lv_result_t lv_binfont_load_from_buffer(lv_font_t * font, void * buffer, uint32_
 void lv_font_free(lv_font_t * font)
 {
     if(NULL != font) {
+        lv_font_fmt_txt_cache_invalidate(font);
+
         lv_font_fmt_txt_dsc_t * dsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
 
         if(NULL != dsc) {
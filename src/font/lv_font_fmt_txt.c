@@ -14,6 +14,7 @@
 #include "../misc/lv_log.h"
 #include "../misc/lv_utils.h"
 #include "../stdlib/lv_mem.h"
+#include "../stdlib/lv_string.h"
 
 /*********************
  *      DEFINES
@@ -22,19 +23,84 @@
     #define font_rle LV_GLOBAL_DEFAULT()->font_fmt_rle
 #endif /*LV_USE_FONT_COMPRESSED*/
 
+#if LV_FONT_FMT_TXT_CACHE_SIZE > 0
+    #define glyph_cache LV_GLOBAL_DEFAULT()->font_fmt_txt_cache
+
+    /*Number of buckets allocated when the first glyph is cached*/
+    #define CACHE_BUCKET_CNT_MIN 32
+#endif /*LV_FONT_FMT_TXT_CACHE_SIZE > 0*/
+
+#if LV_USE_FONT_FMT_TXT_ACCEL
+    #define font_accel LV_GLOBAL_DEFAULT()->font_fmt_txt_accel
+
+    /*Number of slots in the lookup tables. The low 8 bits of the letter and
+     *the low 4 bits of both glyph IDs of a kerning pair select the slot.*/
+    #define ACCEL_CMAP_CNT 256
+    #define ACCEL_KERN_CNT 256
+    #define ACCEL_KERN_EMPTY 0xFFFFFFFF
+#endif /*LV_USE_FONT_FMT_TXT_ACCEL*/
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+#if LV_FONT_FMT_TXT_CACHE_SIZE > 0
+struct _lv_font_fmt_txt_cache_entry_t {
+    const lv_font_t * font;
+    uint32_t gid;
+    uint32_t size;          /*Size of the bitmap in bytes*/
+    uint32_t usage_cnt;     /*The entry can't be dropped while it's used*/
+    void * bitmap_unaligned;
+    uint8_t * bitmap;
+    lv_font_fmt_txt_cache_entry_t * next;   /*Next entry in the same bucket*/
+    lv_font_fmt_txt_cache_entry_t * lru_prev;
+    lv_font_fmt_txt_cache_entry_t * lru_next;
+};
+#endif /*LV_FONT_FMT_TXT_CACHE_SIZE > 0*/
+
+#if LV_USE_FONT_FMT_TXT_ACCEL
+struct _lv_font_fmt_txt_accel_t {
+    const lv_font_fmt_txt_dsc_t * fdsc;
+    lv_font_fmt_txt_accel_t * next;
+
+    /*`(letter >> 8) + 1` in the upper and the glyph ID in the lower 16 bits. 0: empty slot.
+     *The slots are read and written as a whole so the draw units can use them concurrently.*/
+    uint32_t cmap[ACCEL_CMAP_CNT];
+
+    /*Upper 12 bits of the left and right glyph IDs in bit 20..31 and 8..19, the kerning value
+     *in bit 0..7. ACCEL_KERN_EMPTY: empty slot*/
+    uint32_t kern[ACCEL_KERN_CNT];
+};
+#endif /*LV_USE_FONT_FMT_TXT_ACCEL*/
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter);
+static uint32_t find_glyph_dsc_id(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t letter);
+static const uint8_t * expand_glyph(const lv_font_fmt_txt_dsc_t * fdsc, const lv_font_fmt_txt_glyph_dsc_t * gdsc,
+                                    uint8_t * bitmap_out);
+static void unpack_plain(const uint8_t * in, uint8_t * out, int32_t w, int32_t h, uint8_t bpp);
 static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t gid_right);
+static int8_t find_kern_value(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t gid_left, uint32_t gid_right);
 static int32_t unicode_list_compare(const void * ref, const void * element);
 static int32_t kern_pair_8_compare(const void * ref, const void * element);
 static int32_t kern_pair_16_compare(const void * ref, const void * element);
 
+#if LV_FONT_FMT_TXT_CACHE_SIZE > 0
+    static uint32_t cache_hash(const lv_font_t * font, uint32_t gid);
+    static void cache_drop(lv_font_fmt_txt_cache_entry_t * entry);
+    static bool cache_drop_lru(void);
+    static bool cache_resize(void);
+    static void cache_lru_remove(lv_font_fmt_txt_cache_entry_t * entry);
+    static void cache_lru_ins_head(lv_font_fmt_txt_cache_entry_t * entry);
+#endif /*LV_FONT_FMT_TXT_CACHE_SIZE > 0*/
+
+#if LV_USE_FONT_FMT_TXT_ACCEL
+    static lv_font_fmt_txt_accel_t * accel_get(const lv_font_fmt_txt_dsc_t * fdsc);
+    static void accel_drop(const lv_font_t * font);
+#endif /*LV_USE_FONT_FMT_TXT_ACCEL*/
+
 #if LV_USE_FONT_COMPRESSED
     static void decompress(const uint8_t * in, uint8_t * out, int32_t w, int32_t h, uint8_t bpp, bool prefilter);
     static inline void decompress_line(uint8_t * out, int32_t w);
@@ -47,17 +113,17 @@ static int32_t kern_pair_16_compare(const void * ref, const void * element);
  *  STATIC VARIABLES
  **********************/
 
+#if LV_USE_FONT_COMPRESSED
 static const uint8_t opa4_table[16] = {0,  17, 34,  51,
                                        68, 85, 102, 119,
                                        136, 153, 170, 187,
                                        204, 221, 238, 255
                                       };
 
-#if LV_USE_FONT_COMPRESSED
 static const uint8_t opa3_table[8] = {0, 36, 73, 109, 146, 182, 218, 255};
-#endif
 
 static const uint8_t opa2_table[4] = {0, 85, 170, 255};
+#endif
 
 /**********************
  * GLOBAL PROTOTYPES
@@ -84,80 +150,7 @@ const uint8_t * lv_font_get_bitmap_fmt_txt(const lv_font_t * font, uint32_t unic
     int32_t gsize = (int32_t) gdsc->box_w * gdsc->box_h;
     if(gsize == 0) return NULL;
 
-    if(fdsc->bitmap_format == LV_FONT_FMT_TXT_PLAIN) {
-        const uint8_t * bitmap_in = &fdsc->glyph_bitmap[gdsc->bitmap_index];
-        uint8_t * bitmap_out_tmp = bitmap_out;
-        int32_t i = 0;
-        int32_t x, y;
-        uint32_t stride = lv_draw_buf_width_to_stride(gdsc->box_w, LV_COLOR_FORMAT_A8);
-
-        if(fdsc->bpp == 1) {
-            for(y = 0; y < gdsc->box_h; y ++) {
-                for(x = 0; x < gdsc->box_w; x++, i++) {
-                    i = i & 0x7;
-                    if(i == 0) bitmap_out_tmp[x] = (*bitmap_in) & 0x80 ? 0xff : 0x00;
-                    else if(i == 1) bitmap_out_tmp[x] = (*bitmap_in) & 0x40 ? 0xff : 0x00;
-                    else if(i == 2) bitmap_out_tmp[x] = (*bitmap_in) & 0x20 ? 0xff : 0x00;
-                    else if(i == 3) bitmap_out_tmp[x] = (*bitmap_in) & 0x10 ? 0xff : 0x00;
-                    else if(i == 4) bitmap_out_tmp[x] = (*bitmap_in) & 0x08 ? 0xff : 0x00;
-                    else if(i == 5) bitmap_out_tmp[x] = (*bitmap_in) & 0x04 ? 0xff : 0x00;
-                    else if(i == 6) bitmap_out_tmp[x] = (*bitmap_in) & 0x02 ? 0xff : 0x00;
-                    else if(i == 7) {
-                        bitmap_out_tmp[x] = (*bitmap_in) & 0x01 ? 0xff : 0x00;
-                        bitmap_in++;
-                    }
-                }
-                bitmap_out_tmp += stride;
-            }
-        }
-        else if(fdsc->bpp == 2) {
-            for(y = 0; y < gdsc->box_h; y ++) {
-                for(x = 0; x < gdsc->box_w; x++, i++) {
-                    i = i & 0x3;
-                    if(i == 0) bitmap_out_tmp[x] = opa2_table[(*bitmap_in) >> 6];
-                    else if(i == 1) bitmap_out_tmp[x] = opa2_table[((*bitmap_in) >> 4) & 0x3];
-                    else if(i == 2) bitmap_out_tmp[x] = opa2_table[((*bitmap_in) >> 2) & 0x3];
-                    else if(i == 3) {
-                        bitmap_out_tmp[x] = opa2_table[((*bitmap_in) >> 0) & 0x3];
-                        bitmap_in++;
-                    }
-                }
-                bitmap_out_tmp += stride;
-            }
-
-        }
-        else if(fdsc->bpp == 4) {
-            for(y = 0; y < gdsc->box_h; y ++) {
-                for(x = 0; x < gdsc->box_w; x++, i++) {
-                    i = i & 0x1;
-                    if(i == 0) {
-                        bitmap_out_tmp[x] = opa4_table[(*bitmap_in) >> 4];
-                    }
-                    else if(i == 1) {
-                        bitmap_out_tmp[x] = opa4_table[(*bitmap_in) & 0xF];
-                        bitmap_in++;
-                    }
-                }
-                bitmap_out_tmp += stride;
-            }
-        }
-        return bitmap_out;
-    }
-    /*Handle compressed bitmap*/
-    else {
-#if LV_USE_FONT_COMPRESSED
-        bool prefilter = fdsc->bitmap_format == LV_FONT_FMT_TXT_COMPRESSED;
-        decompress(&fdsc->glyph_bitmap[gdsc->bitmap_index], bitmap_out, gdsc->box_w, gdsc->box_h,
-                   (uint8_t)fdsc->bpp, prefilter);
-        return bitmap_out;
-#else /*!LV_USE_FONT_COMPRESSED*/
-        LV_LOG_WARN("Compressed fonts is used but LV_USE_FONT_COMPRESSED is not enabled in lv_conf.h");
-        return NULL;
-#endif
-    }
-
-    /*If not returned earlier then the letter is not found in this font*/
-    return NULL;
+    return expand_glyph(fdsc, gdsc, bitmap_out);
 }
 
 bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter,
@@ -204,16 +197,327 @@ bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t *
     return true;
 }
 
+#if LV_FONT_FMT_TXT_CACHE_SIZE > 0
+
+void _lv_font_fmt_txt_cache_init(void)
+{
+    lv_memzero(&glyph_cache, sizeof(lv_font_fmt_txt_cache_t));
+    lv_mutex_init(&glyph_cache.lock);
+}
+
+void _lv_font_fmt_txt_cache_deinit(void)
+{
+    lv_font_fmt_txt_cache_invalidate(NULL);
+    lv_free(glyph_cache.buckets);
+    lv_mutex_delete(&glyph_cache.lock);
+    lv_memzero(&glyph_cache, sizeof(lv_font_fmt_txt_cache_t));
+}
+
+const uint8_t * _lv_font_fmt_txt_cache_acquire(const lv_font_t * font, uint32_t unicode_letter,
+                                               lv_font_fmt_txt_cache_entry_t ** entry_out)
+{
+    *entry_out = NULL;
+
+    if(unicode_letter == '\t') unicode_letter = ' ';
+
+    const lv_font_fmt_txt_dsc_t * fdsc = (const lv_font_fmt_txt_dsc_t *)font->dsc;
+    uint32_t gid = get_glyph_dsc_id(font, unicode_letter);
+    if(!gid) return NULL;
+
+    const lv_font_fmt_txt_glyph_dsc_t * gdsc = &fdsc->glyph_dsc[gid];
+    uint32_t size = lv_draw_buf_width_to_stride(gdsc->box_w, LV_COLOR_FORMAT_A8) * gdsc->box_h;
+    if(size == 0 || size > LV_FONT_FMT_TXT_CACHE_SIZE) return NULL;
+
+    lv_mutex_lock(&glyph_cache.lock);
+
+    uint32_t hash = cache_hash(font, gid);
+    lv_font_fmt_txt_cache_entry_t * entry = NULL;
+    if(glyph_cache.bucket_cnt) {
+        entry = glyph_cache.buckets[hash & (glyph_cache.bucket_cnt - 1)];
+        while(entry && (entry->font != font || entry->gid != gid)) entry = entry->next;
+    }
+
+    if(entry) {
+        glyph_cache.hit_cnt++;
+        if(glyph_cache.lru_head != entry) {
+            cache_lru_remove(entry);
+            cache_lru_ins_head(entry);
+        }
+    }
+    else {
+        glyph_cache.miss_cnt++;
+
+        /*Make space for the new bitmap by dropping the least recently used ones.
+         *If the glyphs in use take too much space the caller needs to expand the glyph itself.*/
+        while(glyph_cache.cur_size + size > LV_FONT_FMT_TXT_CACHE_SIZE) {
+            if(!cache_drop_lru()) break;
+        }
+
+        if(glyph_cache.entry_cnt >= glyph_cache.bucket_cnt) cache_resize();
+
+        if(glyph_cache.cur_size + size <= LV_FONT_FMT_TXT_CACHE_SIZE && glyph_cache.bucket_cnt) {
+            entry = lv_malloc_zeroed(sizeof(lv_font_fmt_txt_cache_entry_t));
+            LV_ASSERT_MALLOC(entry);
+        }
+
+        if(entry) {
+            entry->bitmap_unaligned = lv_draw_buf_malloc(size, LV_COLOR_FORMAT_A8);
+            LV_ASSERT_MALLOC(entry->bitmap_unaligned);
+            if(entry->bitmap_unaligned == NULL) {
+                lv_free(entry);
+                entry = NULL;
+            }
+        }
+
+        if(entry) {
+            entry->bitmap = lv_draw_buf_align(entry->bitmap_unaligned, LV_COLOR_FORMAT_A8);
+            entry->font = font;
+            entry->gid = gid;
+            entry->size = size;
+
+            /*Expand it inside the lock as decompressing uses a global state*/
+            if(expand_glyph(fdsc, gdsc, entry->bitmap) == NULL) {
+                lv_draw_buf_free(entry->bitmap_unaligned);
+                lv_free(entry);
+                entry = NULL;
+            }
+        }
+
+        if(entry) {
+            uint32_t i = hash & (glyph_cache.bucket_cnt - 1);
+            entry->next = glyph_cache.buckets[i];
+            glyph_cache.buckets[i] = entry;
+            cache_lru_ins_head(entry);
+            glyph_cache.entry_cnt++;
+            glyph_cache.cur_size += size;
+        }
+    }
+
+    if(entry) entry->usage_cnt++;
+
+    lv_mutex_unlock(&glyph_cache.lock);
+
+    *entry_out = entry;
+    return entry ? entry->bitmap : NULL;
+}
+
+void _lv_font_fmt_txt_cache_release(lv_font_fmt_txt_cache_entry_t * entry)
+{
+    if(entry == NULL) return;
+
+    lv_mutex_lock(&glyph_cache.lock);
+    if(entry->usage_cnt > 0) entry->usage_cnt--;
+    lv_mutex_unlock(&glyph_cache.lock);
+}
+
+#endif /*LV_FONT_FMT_TXT_CACHE_SIZE > 0*/
+
+#if LV_USE_FONT_FMT_TXT_ACCEL
+
+void _lv_font_fmt_txt_accel_init(void)
+{
+    lv_memzero(&font_accel, sizeof(lv_font_fmt_txt_accel_list_t));
+    lv_mutex_init(&font_accel.lock);
+}
+
+void _lv_font_fmt_txt_accel_deinit(void)
+{
+    accel_drop(NULL);
+    lv_mutex_delete(&font_accel.lock);
+    lv_memzero(&font_accel, sizeof(lv_font_fmt_txt_accel_list_t));
+}
+
+#endif /*LV_USE_FONT_FMT_TXT_ACCEL*/
+
+void lv_font_fmt_txt_cache_invalidate(const lv_font_t * font)
+{
+#if LV_FONT_FMT_TXT_CACHE_SIZE > 0
+    lv_mutex_lock(&glyph_cache.lock);
+    lv_font_fmt_txt_cache_entry_t * entry = glyph_cache.lru_head;
+    while(entry) {
+        lv_font_fmt_txt_cache_entry_t * next = entry->lru_next;
+        if(font == NULL || entry->font == font) cache_drop(entry);
+        entry = next;
+    }
+    lv_mutex_unlock(&glyph_cache.lock);
+#endif
+
+#if LV_USE_FONT_FMT_TXT_ACCEL
+    accel_drop(font);
+#endif
+
+    LV_UNUSED(font);
+}
+
+void lv_font_fmt_txt_cache_get_info(lv_font_fmt_txt_cache_info_t * info)
+{
+    lv_memzero(info, sizeof(lv_font_fmt_txt_cache_info_t));
+#if LV_FONT_FMT_TXT_CACHE_SIZE > 0
+    lv_mutex_lock(&glyph_cache.lock);
+    info->hit_cnt = glyph_cache.hit_cnt;
+    info->miss_cnt = glyph_cache.miss_cnt;
+    info->entry_cnt = glyph_cache.entry_cnt;
+    info->cur_size = glyph_cache.cur_size;
+    lv_mutex_unlock(&glyph_cache.lock);
+#endif
+}
+
+void lv_font_fmt_txt_cache_reset_counters(void)
+{
+#if LV_FONT_FMT_TXT_CACHE_SIZE > 0
+    lv_mutex_lock(&glyph_cache.lock);
+    glyph_cache.hit_cnt = 0;
+    glyph_cache.miss_cnt = 0;
+    lv_mutex_unlock(&glyph_cache.lock);
+#endif
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
+/*Convert the bitmap of a glyph to A8 format with `lv_draw_buf_width_to_stride(box_w, A8)` stride*/
+static const uint8_t * expand_glyph(const lv_font_fmt_txt_dsc_t * fdsc, const lv_font_fmt_txt_glyph_dsc_t * gdsc,
+                                    uint8_t * bitmap_out)
+{
+    if(fdsc->bitmap_format == LV_FONT_FMT_TXT_PLAIN) {
+        unpack_plain(&fdsc->glyph_bitmap[gdsc->bitmap_index], bitmap_out, gdsc->box_w, gdsc->box_h, (uint8_t)fdsc->bpp);
+        return bitmap_out;
+    }
+    /*Handle compressed bitmap*/
+    else {
+#if LV_USE_FONT_COMPRESSED
+        bool prefilter = fdsc->bitmap_format == LV_FONT_FMT_TXT_COMPRESSED;
+        decompress(&fdsc->glyph_bitmap[gdsc->bitmap_index], bitmap_out, gdsc->box_w, gdsc->box_h,
+                   (uint8_t)fdsc->bpp, prefilter);
+        return bitmap_out;
+#else /*!LV_USE_FONT_COMPRESSED*/
+        LV_LOG_WARN("Compressed fonts is used but LV_USE_FONT_COMPRESSED is not enabled in lv_conf.h");
+        return NULL;
+#endif
+    }
+
+    /*If not returned earlier then the letter is not found in this font*/
+    return NULL;
+}
+
+/**
+ * Convert a plain 1, 2, 4 or 8 bpp bitmap to A8.
+ * The rows are not padded in the input so a row can start in the middle of a byte.
+ * Only the pixels of these partial bytes are converted one by one,
+ * the other pixels are converted a whole byte at once.
+ * @param in    the plain bitmap
+ * @param out   buffer to store the result with `lv_draw_buf_width_to_stride(w, A8)` stride
+ * @param w     width of the glyph
+ * @param h     height of the glyph
+ * @param bpp   bit per pixel
+ */
+static void unpack_plain(const uint8_t * in, uint8_t * out, int32_t w, int32_t h, uint8_t bpp)
+{
+    uint32_t stride = lv_draw_buf_width_to_stride(w, LV_COLOR_FORMAT_A8);
+    int32_t y;
+
+    if(bpp == 8) {
+        for(y = 0; y < h; y++) {
+            lv_memcpy(out, in, w);
+            in += w;
+            out += stride;
+        }
+        return;
+    }
+
+    if(bpp != 1 && bpp != 2 && bpp != 4) {
+        LV_LOG_WARN("%d bpp is not handled", bpp);
+        return;
+    }
+
+    /*The multiplier scales the values to 0..255 (0xFF, 0x55, 0x11 for 1, 2, 4 bpp)*/
+    const uint8_t mask = (1 << bpp) - 1;
+    const uint8_t mul = 0xFF / mask;
+    uint32_t bit_pos = 0;
+
+    for(y = 0; y < h; y++) {
+        const uint8_t * in_tmp = &in[bit_pos >> 3];
+        uint32_t shift = bit_pos & 0x7;
+        int32_t x = 0;
+
+        /*Finish the byte started by the previous row*/
+        if(shift) {
+            uint8_t b = *in_tmp++;
+            for(; shift < 8 && x < w; shift += bpp, x++) {
+                out[x] = ((b >> (8 - bpp - shift)) & mask) * mul;
+            }
+        }
+
+        /*Convert whole bytes*/
+        if(bpp == 1) {
+            for(; x + 8 <= w; x += 8, in_tmp++) {
+                uint8_t b = *in_tmp;
+                out[x + 0] = ((b >> 7) & 0x1) * 0xFF;
+                out[x + 1] = ((b >> 6) & 0x1) * 0xFF;
+                out[x + 2] = ((b >> 5) & 0x1) * 0xFF;
+                out[x + 3] = ((b >> 4) & 0x1) * 0xFF;
+                out[x + 4] = ((b >> 3) & 0x1) * 0xFF;
+                out[x + 5] = ((b >> 2) & 0x1) * 0xFF;
+                out[x + 6] = ((b >> 1) & 0x1) * 0xFF;
+                out[x + 7] = ((b >> 0) & 0x1) * 0xFF;
+            }
+        }
+        else if(bpp == 2) {
+            for(; x + 4 <= w; x += 4, in_tmp++) {
+                uint8_t b = *in_tmp;
+                out[x + 0] = ((b >> 6) & 0x3) * 0x55;
+                out[x + 1] = ((b >> 4) & 0x3) * 0x55;
+                out[x + 2] = ((b >> 2) & 0x3) * 0x55;
+                out[x + 3] = ((b >> 0) & 0x3) * 0x55;
+            }
+        }
+        else {
+            for(; x + 2 <= w; x += 2, in_tmp++) {
+                uint8_t b = *in_tmp;
+                out[x + 0] = (b >> 4) * 0x11;
+                out[x + 1] = (b & 0xF) * 0x11;
+            }
+        }
+
+        /*Start of the last partial byte*/
+        for(shift = 0; x < w; shift += bpp, x++) {
+            out[x] = ((*in_tmp >> (8 - bpp - shift)) & mask) * mul;
+        }
+
+        bit_pos += (uint32_t)w * bpp;
+        out += stride;
+    }
+}
+
 static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
 {
     if(letter == '\0') return 0;
 
-    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
+    const lv_font_fmt_txt_dsc_t * fdsc = (const lv_font_fmt_txt_dsc_t *)font->dsc;
+
+#if LV_USE_FONT_FMT_TXT_ACCEL
+    /*Only the letters of Unicode's range and 16 bit glyph IDs fit into a slot*/
+    if(letter > 0x10FFFF) return find_glyph_dsc_id(fdsc, letter);
+
+    lv_font_fmt_txt_accel_t * accel = accel_get(fdsc);
+    if(accel == NULL) return find_glyph_dsc_id(fdsc, letter);
 
+    uint32_t * slot = &accel->cmap[letter & (ACCEL_CMAP_CNT - 1)];
+    uint32_t tag = ((letter >> 8) + 1) << 16;
+    uint32_t v = *slot;
+    if((v & 0xFFFF0000) == tag) return v & 0xFFFF;
+
+    uint32_t gid = find_glyph_dsc_id(fdsc, letter);
+    if(gid <= 0xFFFF) *slot = tag | gid;
+    return gid;
+#else
+    return find_glyph_dsc_id(fdsc, letter);
+#endif
+}
+
+static uint32_t find_glyph_dsc_id(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t letter)
+{
     uint16_t i;
     for(i = 0; i < fdsc->cmap_num; i++) {
 
@@ -257,10 +561,115 @@ static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
 
 }
 
+#if LV_FONT_FMT_TXT_CACHE_SIZE > 0
+
+static uint32_t cache_hash(const lv_font_t * font, uint32_t gid)
+{
+    uint64_t v = (uint64_t)(lv_uintptr_t)font;
+    uint32_t h = (uint32_t)v ^ (uint32_t)(v >> 32) ^ (gid * 0x9e3779b1);
+    h ^= h >> 16;
+    h *= 0x85ebca6b;
+    h ^= h >> 13;
+    return h;
+}
+
+static void cache_drop(lv_font_fmt_txt_cache_entry_t * entry)
+{
+    lv_font_fmt_txt_cache_entry_t ** next_p = &glyph_cache.buckets[cache_hash(entry->font,
+                                                                              entry->gid) & (glyph_cache.bucket_cnt - 1)];
+    while(*next_p != entry) next_p = &(*next_p)->next;
+    *next_p = entry->next;
+
+    cache_lru_remove(entry);
+    glyph_cache.entry_cnt--;
+    glyph_cache.cur_size -= entry->size;
+
+    lv_draw_buf_free(entry->bitmap_unaligned);
+    lv_free(entry);
+}
+
+static bool cache_drop_lru(void)
+{
+    lv_font_fmt_txt_cache_entry_t * entry = glyph_cache.lru_tail;
+    while(entry && entry->usage_cnt) entry = entry->lru_prev;
+    if(entry == NULL) return false;
+
+    cache_drop(entry);
+    return true;
+}
+
+static bool cache_resize(void)
+{
+    uint32_t new_cnt = glyph_cache.bucket_cnt ? glyph_cache.bucket_cnt * 2 : CACHE_BUCKET_CNT_MIN;
+    lv_font_fmt_txt_cache_entry_t ** buckets = lv_malloc_zeroed(new_cnt * sizeof(lv_font_fmt_txt_cache_entry_t *));
+    if(buckets == NULL) return false;
+
+    lv_font_fmt_txt_cache_entry_t * entry = glyph_cache.lru_tail;
+    while(entry) {
+        uint32_t i = cache_hash(entry->font, entry->gid) & (new_cnt - 1);
+        entry->next = buckets[i];
+        buckets[i] = entry;
+        entry = entry->lru_prev;
+    }
+
+    lv_free(glyph_cache.buckets);
+    glyph_cache.buckets = buckets;
+    glyph_cache.bucket_cnt = new_cnt;
+    return true;
+}
+
+static void cache_lru_remove(lv_font_fmt_txt_cache_entry_t * entry)
+{
+    if(entry->lru_prev) entry->lru_prev->lru_next = entry->lru_next;
+    else glyph_cache.lru_head = entry->lru_next;
+
+    if(entry->lru_next) entry->lru_next->lru_prev = entry->lru_prev;
+    else glyph_cache.lru_tail = entry->lru_prev;
+
+    entry->lru_prev = NULL;
+    entry->lru_next = NULL;
+}
+
+static void cache_lru_ins_head(lv_font_fmt_txt_cache_entry_t * entry)
+{
+    entry->lru_prev = NULL;
+    entry->lru_next = glyph_cache.lru_head;
+    if(glyph_cache.lru_head) glyph_cache.lru_head->lru_prev = entry;
+    else glyph_cache.lru_tail = entry;
+    glyph_cache.lru_head = entry;
+}
+
+#endif /*LV_FONT_FMT_TXT_CACHE_SIZE > 0*/
+
 static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t gid_right)
 {
-    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
+    const lv_font_fmt_txt_dsc_t * fdsc = (const lv_font_fmt_txt_dsc_t *)font->dsc;
 
+#if LV_USE_FONT_FMT_TXT_ACCEL
+    /*Kerning classes are simple array lookups, only the binary search of the pairs needs to be avoided.
+     *The glyph IDs need to fit into 16 bits and the key can't be the same as ACCEL_KERN_EMPTY.*/
+    if(fdsc->kern_classes || gid_left >= 0xFFF0 || gid_right > 0xFFFF) {
+        return find_kern_value(fdsc, gid_left, gid_right);
+    }
+
+    lv_font_fmt_txt_accel_t * accel = accel_get(fdsc);
+    if(accel == NULL) return find_kern_value(fdsc, gid_left, gid_right);
+
+    uint32_t * slot = &accel->kern[((gid_left & 0xF) << 4) | (gid_right & 0xF)];
+    uint32_t tag = ((gid_left >> 4) << 20) | ((gid_right >> 4) << 8);
+    uint32_t v = *slot;
+    if((v & 0xFFFFFF00) == tag) return (int8_t)(v & 0xFF);
+
+    int8_t value = find_kern_value(fdsc, gid_left, gid_right);
+    *slot = tag | (uint8_t)value;
+    return value;
+#else
+    return find_kern_value(fdsc, gid_left, gid_right);
+#endif
+}
+
+static int8_t find_kern_value(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t gid_left, uint32_t gid_right)
+{
     int8_t value = 0;
 
     if(fdsc->kern_classes == 0) {
@@ -313,6 +722,62 @@ static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t
     return value;
 }
 
+#if LV_USE_FONT_FMT_TXT_ACCEL
+
+static lv_font_fmt_txt_accel_t * accel_get(const lv_font_fmt_txt_dsc_t * fdsc)
+{
+    /*The tables are added only to the head and removed only when the font is not used anymore
+     *so the list can be searched without locking*/
+    lv_font_fmt_txt_accel_t * accel = font_accel.head;
+    while(accel && accel->fdsc != fdsc) accel = accel->next;
+    if(accel) return accel;
+
+    lv_mutex_lock(&font_accel.lock);
+
+    /*Another thread might have added it in the meantime*/
+    accel = font_accel.head;
+    while(accel && accel->fdsc != fdsc) accel = accel->next;
+
+    if(accel == NULL) {
+        accel = lv_malloc(sizeof(lv_font_fmt_txt_accel_t));
+        LV_ASSERT_MALLOC(accel);
+        if(accel) {
+            accel->fdsc = fdsc;
+            lv_memzero(accel->cmap, sizeof(accel->cmap));
+            lv_memset(accel->kern, 0xFF, sizeof(accel->kern));
+            accel->next = font_accel.head;
+            font_accel.head = accel;
+        }
+    }
+
+    lv_mutex_unlock(&font_accel.lock);
+
+    return accel;
+}
+
+/**
+ * Free the lookup tables of a font
+ * @param font      pointer to a font or NULL to free all tables
+ */
+static void accel_drop(const lv_font_t * font)
+{
+    lv_mutex_lock(&font_accel.lock);
+    lv_font_fmt_txt_accel_t ** next_p = &font_accel.head;
+    while(*next_p) {
+        lv_font_fmt_txt_accel_t * accel = *next_p;
+        if(font == NULL || accel->fdsc == font->dsc) {
+            *next_p = accel->next;
+            lv_free(accel);
+        }
+        else {
+            next_p = &accel->next;
+        }
+    }
+    lv_mutex_unlock(&font_accel.lock);
+}
+
+#endif /*LV_USE_FONT_FMT_TXT_ACCEL*/
+
 static int32_t kern_pair_8_compare(const void * ref, const void * element)
 {
     const uint8_t * ref8_p = ref;
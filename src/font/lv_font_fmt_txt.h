@@ -17,6 +17,7 @@ extern "C" {
 #include <stddef.h>
 #include <stdbool.h>
 #include "lv_font.h"
+#include "../osal/lv_os.h"
 
 /*********************
  *      DEFINES
@@ -210,6 +211,38 @@ typedef struct {
 } lv_font_fmt_rle_t;
 #endif
 
+typedef struct _lv_font_fmt_txt_cache_entry_t lv_font_fmt_txt_cache_entry_t;
+
+#if LV_FONT_FMT_TXT_CACHE_SIZE > 0
+typedef struct {
+    lv_font_fmt_txt_cache_entry_t ** buckets;   /**< Entries hashed by font and glyph ID*/
+    lv_font_fmt_txt_cache_entry_t * lru_head;   /**< The most recently used entry*/
+    lv_font_fmt_txt_cache_entry_t * lru_tail;   /**< The least recently used entry*/
+    uint32_t bucket_cnt;
+    uint32_t entry_cnt;
+    uint32_t cur_size;
+    uint32_t hit_cnt;
+    uint32_t miss_cnt;
+    lv_mutex_t lock;
+} lv_font_fmt_txt_cache_t;
+#endif
+
+#if LV_USE_FONT_FMT_TXT_ACCEL
+typedef struct _lv_font_fmt_txt_accel_t lv_font_fmt_txt_accel_t;
+
+typedef struct {
+    lv_font_fmt_txt_accel_t * head;     /**< Lookup tables of the fonts used so far*/
+    lv_mutex_t lock;                    /**< Locked while adding or removing tables*/
+} lv_font_fmt_txt_accel_list_t;
+#endif
+
+typedef struct {
+    uint32_t hit_cnt;       /**< Number of glyphs found in the cache*/
+    uint32_t miss_cnt;      /**< Number of glyphs not found in the cache*/
+    uint32_t entry_cnt;     /**< Number of cached glyphs*/
+    uint32_t cur_size;      /**< Size of the cached bitmaps in bytes*/
+} lv_font_fmt_txt_cache_info_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -235,6 +268,61 @@ const uint8_t * lv_font_get_bitmap_fmt_txt(const lv_font_t * font, uint32_t unic
 bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter,
                                    uint32_t unicode_letter_next);
 
+#if LV_FONT_FMT_TXT_CACHE_SIZE > 0
+
+void _lv_font_fmt_txt_cache_init(void);
+
+void _lv_font_fmt_txt_cache_deinit(void);
+
+/**
+ * Get the A8 bitmap of a glyph from the glyph cache.
+ * If it's not cached yet, the glyph is expanded into the cache.
+ * The bitmap can't be dropped from the cache until `_lv_font_fmt_txt_cache_release` is called.
+ * @param font              pointer to a font using `lv_font_get_bitmap_fmt_txt`
+ * @param unicode_letter    a unicode letter whose bitmap should be get
+ * @param entry_out         store the cache entry here to release it later. NULL if the glyph was not cached.
+ * @return                  pointer to the A8 bitmap or NULL if the glyph is not found or can't be cached
+ */
+const uint8_t * _lv_font_fmt_txt_cache_acquire(const lv_font_t * font, uint32_t unicode_letter,
+                                               lv_font_fmt_txt_cache_entry_t ** entry_out);
+
+/**
+ * Allow dropping an entry from the glyph cache again
+ * @param entry     the entry from `_lv_font_fmt_txt_cache_acquire`. Can be NULL.
+ */
+void _lv_font_fmt_txt_cache_release(lv_font_fmt_txt_cache_entry_t * entry);
+
+#endif /*LV_FONT_FMT_TXT_CACHE_SIZE > 0*/
+
+#if LV_USE_FONT_FMT_TXT_ACCEL
+
+void _lv_font_fmt_txt_accel_init(void);
+
+void _lv_font_fmt_txt_accel_deinit(void);
+
+#endif /*LV_USE_FONT_FMT_TXT_ACCEL*/
+
+/**
+ * Drop the cached glyphs and the glyph ID and kerning lookup tables of a font.
+ * Needs to be called before freeing a font which might have been used
+ * (see `LV_FONT_FMT_TXT_CACHE_SIZE` and `LV_USE_FONT_FMT_TXT_ACCEL`).
+ * It does nothing if both are disabled.
+ * @param font      pointer to a font or NULL to drop all glyphs
+ */
+void lv_font_fmt_txt_cache_invalidate(const lv_font_t * font);
+
+/**
+ * Get the hit/miss counters and the usage of the glyph cache.
+ * All values are zero if the glyph cache is disabled.
+ * @param info      store the result here
+ */
+void lv_font_fmt_txt_cache_get_info(lv_font_fmt_txt_cache_info_t * info);
+
+/**
+ * Set the hit and miss counters of the glyph cache to zero
+ */
+void lv_font_fmt_txt_cache_reset_counters(void);
+
 /**********************
  *      MACROS
  **********************/
@@ -215,6 +215,10 @@ static lv_result_t try_cache(lv_image_decoder_dsc_t * dsc)
         const char * fn = dsc->src;
 
         lv_cache_entry_t * cache = lv_cache_find_by_src(NULL, fn, LV_CACHE_SRC_TYPE_PATH);
+        /*Skip the other kind of data cached for the same source, e.g. mipmaps*/
+        while(cache && cache->data_type != dsc->decoder->cache_data_type) {
+            cache = lv_cache_find_by_src(cache, fn, LV_CACHE_SRC_TYPE_PATH);
+        }
         if(cache) {
             dsc->decoded = lv_cache_get_data(cache);
             dsc->cache_entry = cache;     /*Save the cache to release it in decoder_close*/
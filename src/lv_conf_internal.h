@@ -26,6 +26,8 @@
 #define LV_DRAW_SW_ASM_NONE         0
 #define LV_DRAW_SW_ASM_NEON         1
 #define LV_DRAW_SW_ASM_MVE          2
+#define LV_DRAW_SW_ASM_SSE2         3
+#define LV_DRAW_SW_ASM_AVX2         4
 #define LV_DRAW_SW_ASM_CUSTOM       255
 
 /* Handle special Kconfig options */
@@ -166,6 +168,26 @@
     #endif
 #endif  /*LV_USE_MALLOC == LV_STDLIB_BUILTIN*/
 
+/*Allocate the small objects which are created and deleted very often (draw tasks, layers, linked list nodes, etc)
+ *from pages of fixed size blocks. It makes the allocation faster and reduces the fragmentation of the heap.*/
+#ifndef LV_USE_MEM_SLAB
+    #ifdef CONFIG_LV_USE_MEM_SLAB
+        #define LV_USE_MEM_SLAB CONFIG_LV_USE_MEM_SLAB
+    #else
+        #define LV_USE_MEM_SLAB 0
+    #endif
+#endif
+#if LV_USE_MEM_SLAB
+    /*Size of a page of blocks allocated with the malloc of LVGL*/
+    #ifndef LV_MEM_SLAB_PAGE_SIZE
+        #ifdef CONFIG_LV_MEM_SLAB_PAGE_SIZE
+            #define LV_MEM_SLAB_PAGE_SIZE CONFIG_LV_MEM_SLAB_PAGE_SIZE
+        #else
+            #define LV_MEM_SLAB_PAGE_SIZE 2048     /*[bytes]*/
+        #endif
+    #endif
+#endif
+
 /*====================
    HAL SETTINGS
  *====================*/
@@ -215,6 +237,27 @@
     #endif
 #endif
 
+/*Give each draw unit an arena for the temporary buffers of the draw tasks (mask lines, image conversion, etc).
+ *The buffers are allocated from the arena and freed in reverse order so the memory is reused without heap calls.
+ *If the arena is full the buffers are allocated with `lv_malloc` instead. See `lv_draw_arena_get_info()`.*/
+#ifndef LV_USE_DRAW_ARENA
+    #ifdef CONFIG_LV_USE_DRAW_ARENA
+        #define LV_USE_DRAW_ARENA CONFIG_LV_USE_DRAW_ARENA
+    #else
+        #define LV_USE_DRAW_ARENA 0
+    #endif
+#endif
+#if LV_USE_DRAW_ARENA
+    /*Size of the arena of each draw unit*/
+    #ifndef LV_DRAW_ARENA_SIZE
+        #ifdef CONFIG_LV_DRAW_ARENA_SIZE
+            #define LV_DRAW_ARENA_SIZE CONFIG_LV_DRAW_ARENA_SIZE
+        #else
+            #define LV_DRAW_ARENA_SIZE    (16 * 1024)    /*[bytes]*/
+        #endif
+    #endif
+#endif
+
 #ifndef LV_USE_DRAW_SW
     #ifdef _LV_KCONFIG_PRESENT
         #ifdef CONFIG_LV_USE_DRAW_SW
@@ -242,6 +285,30 @@
         #endif
     #endif
 
+    /* Split tall fill, image and layer draw tasks into horizontal bands of this many rows
+     * and let all the draw units render the bands of a task in parallel.
+     * Useful only if LV_DRAW_SW_DRAW_UNIT_CNT > 1
+     * 0: don't split the draw tasks */
+    #ifndef LV_DRAW_SW_BAND_HEIGHT
+        #ifdef CONFIG_LV_DRAW_SW_BAND_HEIGHT
+            #define LV_DRAW_SW_BAND_HEIGHT CONFIG_LV_DRAW_SW_BAND_HEIGHT
+        #else
+            #define LV_DRAW_SW_BAND_HEIGHT      0
+        #endif
+    #endif
+
+    /* Number of independent draw tasks a draw unit can take at once.
+     * The draw unit draws them one after the other without waiting for the dispatcher
+     * so with LV_USE_OS the render threads wake up the main thread less frequently.
+     * 1: take only one draw task at once */
+    #ifndef LV_DRAW_SW_TASK_BATCH_CNT
+        #ifdef CONFIG_LV_DRAW_SW_TASK_BATCH_CNT
+            #define LV_DRAW_SW_TASK_BATCH_CNT CONFIG_LV_DRAW_SW_TASK_BATCH_CNT
+        #else
+            #define LV_DRAW_SW_TASK_BATCH_CNT   4
+        #endif
+    #endif
+
     /* If a widget has `style_opa < 255` (not `bg_opa`, `text_opa` etc) or not NORMAL blend mode
      * it is buffered into a "simple" layer before rendering. The widget can be buffered in smaller chunks.
      * "Transformed layers" (if `transform_angle/zoom` are set) use larger buffers
@@ -273,7 +340,7 @@
     #if LV_DRAW_SW_COMPLEX == 1
         /*Allow buffering some shadow calculation.
         *LV_DRAW_SW_SHADOW_CACHE_SIZE is the max. shadow size to buffer, where shadow size is `shadow_width + radius`
-        *Caching has LV_DRAW_SW_SHADOW_CACHE_SIZE^2 RAM cost*/
+        *Caching has up to LV_DRAW_SW_SHADOW_CACHE_CNT * LV_DRAW_SW_SHADOW_CACHE_SIZE^2 RAM cost*/
         #ifndef LV_DRAW_SW_SHADOW_CACHE_SIZE
             #ifdef CONFIG_LV_DRAW_SW_SHADOW_CACHE_SIZE
                 #define LV_DRAW_SW_SHADOW_CACHE_SIZE CONFIG_LV_DRAW_SW_SHADOW_CACHE_SIZE
@@ -282,6 +349,15 @@
             #endif
         #endif
 
+        /*Number of shadow corners to cache. The recently used ones are kept.*/
+        #ifndef LV_DRAW_SW_SHADOW_CACHE_CNT
+            #ifdef CONFIG_LV_DRAW_SW_SHADOW_CACHE_CNT
+                #define LV_DRAW_SW_SHADOW_CACHE_CNT CONFIG_LV_DRAW_SW_SHADOW_CACHE_CNT
+            #else
+                #define LV_DRAW_SW_SHADOW_CACHE_CNT 4
+            #endif
+        #endif
+
         /* Set number of maximally cached circle data.
         * The circumference of 1/4 circle are saved for anti-aliasing
         * radius * 4 bytes are used per circle (the most often used radiuses are saved)
@@ -295,6 +371,34 @@
         #endif
     #endif
 
+    /* Number of gradient color maps to cache. The recently used ones are kept.
+     * A map uses (sizeof(lv_color_t) + 1) bytes per pixel of the gradient's width or height.
+     * 0: to disable caching */
+    #ifndef LV_DRAW_SW_GRADIENT_CACHE_CNT
+        #ifdef CONFIG_LV_DRAW_SW_GRADIENT_CACHE_CNT
+            #define LV_DRAW_SW_GRADIENT_CACHE_CNT CONFIG_LV_DRAW_SW_GRADIENT_CACHE_CNT
+        #else
+            #define LV_DRAW_SW_GRADIENT_CACHE_CNT 0
+        #endif
+    #endif
+
+    /* 1: Sample prefiltered half, quarter, etc. sized copies of the images scaled to 50% or less.
+     * The copies are stored in the image cache and use up to 1/3 more memory than the decoded image. */
+    #ifndef LV_DRAW_SW_IMAGE_MIPMAP
+        #ifdef CONFIG_LV_DRAW_SW_IMAGE_MIPMAP
+            #define LV_DRAW_SW_IMAGE_MIPMAP CONFIG_LV_DRAW_SW_IMAGE_MIPMAP
+        #else
+            #define LV_DRAW_SW_IMAGE_MIPMAP 0
+        #endif
+    #endif
+
+    /*Use SIMD kernels for blending. Possible options:
+     * - LV_DRAW_SW_ASM_NONE
+     * - LV_DRAW_SW_ASM_NEON
+     * - LV_DRAW_SW_ASM_MVE
+     * - LV_DRAW_SW_ASM_SSE2
+     * - LV_DRAW_SW_ASM_AVX2  AVX2 if the CPU supports it (checked at runtime), else SSE2
+     * - LV_DRAW_SW_ASM_CUSTOM*/
     #ifndef LV_USE_DRAW_SW_ASM
         #ifdef CONFIG_LV_USE_DRAW_SW_ASM
             #define LV_USE_DRAW_SW_ASM CONFIG_LV_USE_DRAW_SW_ASM
@@ -748,6 +852,16 @@
     #endif
 #endif
 
+/*1: Use a cache manager which hashes the entries and drops the least recently used ones.
+ *Finding, using and dropping entries is O(1) instead of walking all the cached entries.*/
+#ifndef LV_USE_CACHE_LRU
+    #ifdef CONFIG_LV_USE_CACHE_LRU
+        #define LV_USE_CACHE_LRU CONFIG_LV_USE_CACHE_LRU
+    #else
+        #define LV_USE_CACHE_LRU        0
+    #endif
+#endif
+
 /*Number of stops allowed per gradient. Increase this to allow more stops.
  *This adds (sizeof(lv_color_t) + 1) bytes per additional stop*/
 #ifndef LV_GRADIENT_MAX_STOPS
@@ -777,6 +891,41 @@
     #endif
 #endif
 
+/* Cache the resolved values of the 32 most used style properties per object part and state.
+ * Reading them again is only an array access until any style, state or parent changes.
+ * Needs about 32 x sizeof(lv_style_value_t) bytes per used object part.
+ * See `lv_obj_style_get_resolved_cache_info()` to measure the memory usage.*/
+#ifndef LV_OBJ_STYLE_RESOLVED_CACHE
+    #ifdef CONFIG_LV_OBJ_STYLE_RESOLVED_CACHE
+        #define LV_OBJ_STYLE_RESOLVED_CACHE CONFIG_LV_OBJ_STYLE_RESOLVED_CACHE
+    #else
+        #define LV_OBJ_STYLE_RESOLVED_CACHE 0
+    #endif
+#endif
+
+/* Record the draw tasks of each object and add them again when the object is redrawn but hasn't changed
+ * instead of sending the draw events again. Makes redrawing static content much faster,
+ * but needs RAM for a copy of the draw descriptors of each drawn object.
+ * Objects whose look changes without invalidating them will be redrawn with their old look.*/
+#ifndef LV_OBJ_DRAW_CACHE
+    #ifdef CONFIG_LV_OBJ_DRAW_CACHE
+        #define LV_OBJ_DRAW_CACHE CONFIG_LV_OBJ_DRAW_CACHE
+    #else
+        #define LV_OBJ_DRAW_CACHE       0
+    #endif
+#endif
+
+/* Before redrawing an area find the objects which are fully covered by opaque objects drawn later
+ * (checked with `LV_EVENT_COVER_CHECK`) and don't draw them at all.
+ * With `LV_USE_REFR_STATS` the number of skipped pixels is reported in `px_occluded`.*/
+#ifndef LV_OBJ_OCCLUSION_CULLING
+    #ifdef CONFIG_LV_OBJ_OCCLUSION_CULLING
+        #define LV_OBJ_OCCLUSION_CULLING CONFIG_LV_OBJ_OCCLUSION_CULLING
+    #else
+        #define LV_OBJ_OCCLUSION_CULLING    0
+    #endif
+#endif
+
 /* Add `id` field to `lv_obj_t` */
 #ifndef LV_USE_OBJ_ID
     #ifdef CONFIG_LV_USE_OBJ_ID
@@ -1159,6 +1308,28 @@
     #endif
 #endif
 
+/*Size of a cache in bytes to keep the A8 bitmaps of the glyphs of the built-in (`lv_font_fmt_txt`) fonts.
+ *Drawing text uses the cached bitmaps instead of converting or decompressing the glyphs again.
+ *0: disable the cache*/
+#ifndef LV_FONT_FMT_TXT_CACHE_SIZE
+    #ifdef CONFIG_LV_FONT_FMT_TXT_CACHE_SIZE
+        #define LV_FONT_FMT_TXT_CACHE_SIZE CONFIG_LV_FONT_FMT_TXT_CACHE_SIZE
+    #else
+        #define LV_FONT_FMT_TXT_CACHE_SIZE 0
+    #endif
+#endif
+
+/*Build a small direct mapped table for each built-in (`lv_font_fmt_txt`) font when it's first used
+ *to look up the glyph IDs and kerning pairs without searching the font's tables.
+ *Uses 2 kB RAM for each used font*/
+#ifndef LV_USE_FONT_FMT_TXT_ACCEL
+    #ifdef CONFIG_LV_USE_FONT_FMT_TXT_ACCEL
+        #define LV_USE_FONT_FMT_TXT_ACCEL CONFIG_LV_USE_FONT_FMT_TXT_ACCEL
+    #else
+        #define LV_USE_FONT_FMT_TXT_ACCEL 0
+    #endif
+#endif
+
 /*Enable drawing placeholders when glyph dsc is not found*/
 #ifndef LV_USE_FONT_PLACEHOLDER
     #ifdef _LV_KCONFIG_PRESENT
@@ -2391,6 +2562,26 @@
     #endif
 #endif
 
+/*1: Collect statistics of each rendered frame (invalid areas, pixels, draw tasks, times, cache hits, etc)
+ *They can be read by `lv_refr_stats_get()`*/
+#ifndef LV_USE_REFR_STATS
+    #ifdef CONFIG_LV_USE_REFR_STATS
+        #define LV_USE_REFR_STATS CONFIG_LV_USE_REFR_STATS
+    #else
+        #define LV_USE_REFR_STATS 0
+    #endif
+#endif
+
+/*1: Count how many times each event code was sent and handled to find the hot spots.
+ *They can be read by `lv_event_get_stats()`*/
+#ifndef LV_USE_EVENT_STATS
+    #ifdef CONFIG_LV_USE_EVENT_STATS
+        #define LV_USE_EVENT_STATS CONFIG_LV_USE_EVENT_STATS
+    #else
+        #define LV_USE_EVENT_STATS 0
+    #endif
+#endif
+
 /*1: Enable Monkey test*/
 #ifndef LV_USE_MONKEY
     #ifdef CONFIG_LV_USE_MONKEY
@@ -24,6 +24,7 @@
 #include "draw/lv_draw.h"
 #include "misc/lv_cache.h"
 #include "misc/lv_cache_builtin.h"
+#include "misc/lv_cache_lru.h"
 #include "misc/lv_async.h"
 #include "misc/lv_fs.h"
 #if LV_USE_DRAW_VGLITE
@@ -88,11 +89,6 @@ static inline void lv_global_init(lv_global_t * global)
     global->area_trans_cache.angle_prev = INT32_MIN;
     global->event_last_register_id = _LV_EVENT_LAST;
     lv_rand_set_seed(0x1234ABCD);
-
-#if defined(LV_DRAW_SW_SHADOW_CACHE_SIZE) && LV_DRAW_SW_SHADOW_CACHE_SIZE > 0
-    global->sw_shadow_cache.cache_size = -1;
-    global->sw_shadow_cache.cache_r = -1;
-#endif
 }
 
 static inline void _lv_cleanup_devices(lv_global_t * global)
@@ -134,6 +130,11 @@ void lv_init(void)
     /*Initialize members of static variable lv_global */
     lv_global_init(LV_GLOBAL_DEFAULT());
 
+#if LV_USE_MEM_SLAB
+    /*It doesn't allocate but `lv_mem_init()` might already use it*/
+    _lv_mem_slab_init();
+#endif
+
     lv_mem_init();
 
     _lv_draw_buf_init_handlers();
@@ -194,10 +195,24 @@ void lv_init(void)
 
     _lv_cache_init();
     _lv_cache_builtin_init();
+    _lv_cache_lru_init();
     lv_cache_lock();
+#if LV_USE_CACHE_LRU
+    lv_cache_manager_t lru_manager;
+    lv_cache_lru_manager_init(&lru_manager);
+    lv_cache_set_manager(&lru_manager);
+#endif
     lv_cache_set_max_size(LV_CACHE_DEF_SIZE);
     lv_cache_unlock();
 
+#if LV_FONT_FMT_TXT_CACHE_SIZE > 0
+    _lv_font_fmt_txt_cache_init();
+#endif
+
+#if LV_USE_FONT_FMT_TXT_ACCEL
+    _lv_font_fmt_txt_accel_init();
+#endif
+
     /*Test if the IDE has UTF-8 encoding*/
     const char * txt = "Á";
 
@@ -340,6 +355,15 @@ void lv_deinit(void)
 #endif
 
     _lv_cache_builtin_deinit();
+    _lv_cache_lru_deinit();
+
+#if LV_FONT_FMT_TXT_CACHE_SIZE > 0
+    _lv_font_fmt_txt_cache_deinit();
+#endif
+
+#if LV_USE_FONT_FMT_TXT_ACCEL
+    _lv_font_fmt_txt_accel_deinit();
+#endif
 
     _lv_cache_deinit();
 
@@ -383,6 +407,10 @@ void lv_deinit(void)
 
     lv_mem_deinit();
 
+#if LV_USE_MEM_SLAB
+    _lv_mem_slab_deinit();
+#endif
+
     lv_initialized = false;
 
     LV_LOG_INFO("lv_deinit done");
@@ -23,16 +23,32 @@
 #define LV_ANIM_RES_SHIFT 10
 #define state LV_GLOBAL_DEFAULT()->anim_state
 #define anim_ll_p &(state.anim_ll)
+#define BATCH_INDEX_NONE UINT32_MAX
 
 /**********************
  *      TYPEDEFS
  **********************/
 
+/*The groups of animations whose values are calculated together in `anim_timer`*/
+typedef enum {
+    BATCH_GROUP_LINEAR,
+    BATCH_GROUP_BEZIER3,
+    BATCH_GROUP_CUSTOM,
+    BATCH_GROUP_CNT,
+    BATCH_GROUP_NONE = BATCH_GROUP_CNT, /*Not running or not started yet: handled one by one*/
+} batch_group_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static void anim_timer(lv_timer_t * param);
 static void anim_mark_list_change(void);
+static bool batch_reserve(lv_anim_batch_t * batch, uint32_t cnt);
+static batch_group_t batch_get_group(lv_anim_t * a);
+static void batch_calc_values(lv_anim_batch_t * batch, const uint32_t * group_cnt);
+static bool batch_input_changed(const lv_anim_t * a, const lv_anim_batch_input_t * input);
+static void batch_remove(lv_anim_t * a);
+static void anim_start_now(lv_anim_t * a);
 static void anim_ready_handler(lv_anim_t * a);
 static int32_t lv_anim_path_cubic_bezier(const lv_anim_t * a, int32_t x1,
                                          int32_t y1, int32_t x2, int32_t y2);
@@ -44,6 +60,16 @@ static bool delete_core(void * var, void * cb, bool custom_exec_cb);
 /**********************
  *  STATIC VARIABLES
  **********************/
+static const lv_anim_bezier3_para_t path_ease_in = {
+    LV_BEZIER_VAL_FLOAT(0.42), LV_BEZIER_VAL_FLOAT(0), LV_BEZIER_VAL_FLOAT(1), LV_BEZIER_VAL_FLOAT(1)
+};
+static const lv_anim_bezier3_para_t path_ease_out = {
+    LV_BEZIER_VAL_FLOAT(0), LV_BEZIER_VAL_FLOAT(0), LV_BEZIER_VAL_FLOAT(0.58), LV_BEZIER_VAL_FLOAT(1)
+};
+static const lv_anim_bezier3_para_t path_ease_in_out = {
+    LV_BEZIER_VAL_FLOAT(0.42), LV_BEZIER_VAL_FLOAT(0), LV_BEZIER_VAL_FLOAT(0.58), LV_BEZIER_VAL_FLOAT(1)
+};
+static const lv_anim_bezier3_para_t path_overshoot = {341, 0, 683, 1300};
 
 /**********************
  *      MACROS
@@ -63,13 +89,14 @@ void _lv_anim_core_init(void)
     _lv_ll_init(anim_ll_p, sizeof(lv_anim_t));
     state.timer = lv_timer_create(anim_timer, LV_DEF_REFR_PERIOD, NULL);
     anim_mark_list_change(); /*Turn off the animation timer*/
-    state.anim_list_changed = false;
-    state.anim_run_round = false;
 }
 
 void _lv_anim_core_deinit(void)
 {
     lv_anim_delete_all();
+
+    lv_free(state.batch.anims);
+    lv_memzero(&state.batch, sizeof(state.batch));
 }
 
 void lv_anim_init(lv_anim_t * a)
@@ -95,7 +122,7 @@ lv_anim_t * lv_anim_start(const lv_anim_t * a)
     /*Initialize the animation descriptor*/
     lv_memcpy(new_anim, a, sizeof(lv_anim_t));
     if(a->var == a) new_anim->var = new_anim;
-    new_anim->run_round = state.anim_run_round;
+    new_anim->batch_index = BATCH_INDEX_NONE; /*Not part of the running round, will run in the next one*/
     new_anim->last_timer_run = lv_tick_get();
 
     /*Set the start value*/
@@ -120,8 +147,6 @@ lv_anim_t * lv_anim_start(const lv_anim_t * a)
         }
     }
 
-    /*Creating an animation changed the linked list.
-     *It's important if it happens in a ready callback. (see `anim_timer`)*/
     anim_mark_list_change();
 
     LV_TRACE_ANIM("finished");
@@ -149,6 +174,12 @@ bool lv_anim_delete(void * var, lv_anim_exec_xcb_t exec_cb)
 
 void lv_anim_delete_all(void)
 {
+    /*Don't let the running rounds use the deleted animations*/
+    lv_anim_batch_t * batch;
+    for(batch = state.batch_act; batch; batch = batch->parent) {
+        lv_memzero(batch->anims, batch->cnt * sizeof(lv_anim_t *));
+    }
+
     _lv_ll_clear(anim_ll_p);
     anim_mark_list_change();
 }
@@ -231,25 +262,23 @@ int32_t lv_anim_path_linear(const lv_anim_t * a)
 
 int32_t lv_anim_path_ease_in(const lv_anim_t * a)
 {
-    return lv_anim_path_cubic_bezier(a, LV_BEZIER_VAL_FLOAT(0.42), LV_BEZIER_VAL_FLOAT(0),
-                                     LV_BEZIER_VAL_FLOAT(1), LV_BEZIER_VAL_FLOAT(1));
+    return lv_anim_path_cubic_bezier(a, path_ease_in.x1, path_ease_in.y1, path_ease_in.x2, path_ease_in.y2);
 }
 
 int32_t lv_anim_path_ease_out(const lv_anim_t * a)
 {
-    return lv_anim_path_cubic_bezier(a, LV_BEZIER_VAL_FLOAT(0), LV_BEZIER_VAL_FLOAT(0),
-                                     LV_BEZIER_VAL_FLOAT(0.58), LV_BEZIER_VAL_FLOAT(1));
+    return lv_anim_path_cubic_bezier(a, path_ease_out.x1, path_ease_out.y1, path_ease_out.x2, path_ease_out.y2);
 }
 
 int32_t lv_anim_path_ease_in_out(const lv_anim_t * a)
 {
-    return lv_anim_path_cubic_bezier(a, LV_BEZIER_VAL_FLOAT(0.42), LV_BEZIER_VAL_FLOAT(0),
-                                     LV_BEZIER_VAL_FLOAT(0.58), LV_BEZIER_VAL_FLOAT(1));
+    return lv_anim_path_cubic_bezier(a, path_ease_in_out.x1, path_ease_in_out.y1, path_ease_in_out.x2,
+                                     path_ease_in_out.y2);
 }
 
 int32_t lv_anim_path_overshoot(const lv_anim_t * a)
 {
-    return lv_anim_path_cubic_bezier(a, 341, 0, 683, 1300);
+    return lv_anim_path_cubic_bezier(a, path_overshoot.x1, path_overshoot.y1, path_overshoot.x2, path_overshoot.y2);
 }
 
 int32_t lv_anim_path_bounce(const lv_anim_t * a)
@@ -322,81 +351,139 @@ int32_t lv_anim_path_custom_bezier3(const lv_anim_t * a)
  **********************/
 /**
  * Periodically handle the animations.
+ * The animations are handled in 3 steps:
+ * 1. Take the animations of the list into a batch and step their time
+ * 2. Calculate the new values of the running animations grouped by the type of their path
+ * 3. Apply the values and call the callbacks in the order of the list
+ * The animations deleted meanwhile are skipped and the ones started meanwhile will run in the next round.
+ * If an animation is changed by a callback meanwhile its value is calculated again.
  * @param param unused
  */
 static void anim_timer(lv_timer_t * param)
 {
     LV_UNUSED(param);
 
-    /*Flip the run round*/
-    state.anim_run_round = state.anim_run_round ? false : true;
+    uint32_t anim_cnt = _lv_ll_get_len(anim_ll_p);
+    if(anim_cnt == 0) return;
 
-    lv_anim_t * a = _lv_ll_get_head(anim_ll_p);
+    /*Can be called from a callback of an animation too, e.g. by `lv_refr_now()`.
+     *In this case the arrays of the outer round are still in use so allocate new ones.*/
+    lv_anim_batch_t nested_batch;
+    lv_anim_batch_t * batch = &state.batch;
+    if(state.batch_act) {
+        lv_memzero(&nested_batch, sizeof(nested_batch));
+        batch = &nested_batch;
+    }
 
-    while(a != NULL) {
+    if(!batch_reserve(batch, anim_cnt)) return;
 
-        //        printf("%p, %d\n", a, a->start_value);
+    uint32_t group_cnt[BATCH_GROUP_CNT + 1] = {0};
+    uint32_t tick = lv_tick_get();
+    uint32_t i = 0;
+    lv_anim_t * a;
+    _LV_LL_READ(anim_ll_p, a) {
+        /*The animations run in this round, so the outer rounds should skip them*/
+        batch_remove(a);
+
+        a->act_time += tick - a->last_timer_run;
+        a->last_timer_run = tick;
+        a->batch_index = i;
+
+        batch_group_t group = batch_get_group(a);
+        if(group != BATCH_GROUP_NONE) {
+            if(a->act_time > a->duration) a->act_time = a->duration;
+
+            lv_anim_batch_input_t * input = &batch->input[i];
+            input->path_cb = a->path_cb;
+            input->act_time = a->act_time;
+            input->start_value = a->start_value;
+            input->end_value = a->end_value;
+            input->duration = a->duration;
+            input->bezier3 = a->parameter.bezier3;
+        }
 
-        uint32_t elaps = lv_tick_elaps(a->last_timer_run);
-        a->act_time += elaps;
+        batch->anims[i] = a;
+        batch->group[i] = group;
+        group_cnt[group]++;
+        i++;
+    }
+    batch->cnt = i;
+    batch->cb_called = false;
+    batch->parent = state.batch_act;
+    state.batch_act = batch;
 
-        a->last_timer_run = lv_tick_get();
+    batch_calc_values(batch, group_cnt);
 
-        /*It can be set by `lv_anim_delete()` typically in `end_cb`. If set then an animation delete
-         * happened in `anim_ready_handler` which could make this linked list reading corrupt
-         * because the list is changed meanwhile
-         */
-        state.anim_list_changed = false;
+    for(i = 0; i < batch->cnt; i++) {
+        /*Deleted by an other animation or run by a nested round*/
+        a = batch->anims[i];
+        if(a == NULL) continue;
 
-        if(a->run_round != state.anim_run_round) {
-            a->run_round = state.anim_run_round; /*The list readying might be reset so need to know which anim has run already*/
+        /*A callback of an other animation might have changed this animation since its value was calculated*/
+        bool batched = batch->group[i] != BATCH_GROUP_NONE;
+        if(batched && batch->cb_called && batch_input_changed(a, &batch->input[i])) batched = false;
 
+        int32_t new_value;
+        if(batched) {
+            new_value = batch->values[i];
+        }
+        else {
             /*The animation will run now for the first time. Call `start_cb`*/
             if(!a->start_cb_called && a->act_time >= 0) {
+                batch->cb_called = true;
+                anim_start_now(a);
+                if(batch->anims[i] == NULL) continue;
+            }
 
-                if(a->early_apply == 0 && a->get_value_cb) {
-                    int32_t v_ofs = a->get_value_cb(a);
-                    a->start_value += v_ofs;
-                    a->end_value += v_ofs;
-                }
+            if(a->act_time < 0) continue;
+            if(a->act_time > a->duration) a->act_time = a->duration;
+            new_value = a->path_cb(a);
+        }
 
-                resolve_time(a);
+        if(new_value != a->current_value) {
+            a->current_value = new_value;
+            /*Apply the calculated value*/
+            batch->cb_called = true;
+            if(a->exec_cb) a->exec_cb(a->var, new_value);
 
-                if(a->start_cb) a->start_cb(a);
-                a->start_cb_called = 1;
+            /*Deleted by its own `exec_cb` or run by a nested round*/
+            if(batch->anims[i] == NULL) continue;
 
-                /*Do not let two animations for the same 'var' with the same 'exec_cb'*/
-                remove_concurrent_anims(a);
-            }
+            if(a->custom_exec_cb) a->custom_exec_cb(a, new_value);
+            if(batch->anims[i] == NULL) continue;
+        }
 
-            if(a->act_time >= 0) {
-                if(a->act_time > a->duration) a->act_time = a->duration;
+        /*If the time is elapsed the animation is ready*/
+        if(a->act_time >= a->duration) {
+            batch->cb_called = true;
+            anim_ready_handler(a);
+        }
+    }
 
-                int32_t new_value;
-                new_value = a->path_cb(a);
+    state.batch_act = batch->parent;
+    batch->cnt = 0;
+    if(batch == &nested_batch) lv_free(batch->anims);
+}
 
-                if(new_value != a->current_value) {
-                    a->current_value = new_value;
-                    /*Apply the calculated value*/
-                    if(a->exec_cb) a->exec_cb(a->var, new_value);
-                    if(a->custom_exec_cb) a->custom_exec_cb(a, new_value);
-                }
+/**
+ * Call the start callback of an animation and prepare its values
+ * @param a pointer to an animation descriptor
+ */
+static void anim_start_now(lv_anim_t * a)
+{
+    if(a->early_apply == 0 && a->get_value_cb) {
+        int32_t v_ofs = a->get_value_cb(a);
+        a->start_value += v_ofs;
+        a->end_value += v_ofs;
+    }
 
-                /*If the time is elapsed the animation is ready*/
-                if(a->act_time >= a->duration) {
-                    anim_ready_handler(a);
-                }
-            }
-        }
+    resolve_time(a);
 
-        /*If the linked list changed due to anim. delete then it's not safe to continue
-         *the reading of the list from here -> start from the head*/
-        if(state.anim_list_changed)
-            a = _lv_ll_get_head(anim_ll_p);
-        else
-            a = _lv_ll_get_next(anim_ll_p, a);
-    }
+    if(a->start_cb) a->start_cb(a);
+    a->start_cb_called = 1;
 
+    /*Do not let two animations for the same 'var' with the same 'exec_cb'*/
+    remove_concurrent_anims(a);
 }
 
 /**
@@ -419,7 +506,7 @@ static void anim_ready_handler(lv_anim_t * a)
         /*Delete the animation from the list.
          * This way the `ready_cb` will see the animations like it's animation is ready deleted*/
         _lv_ll_remove(anim_ll_p, a);
-        /*Flag that the list has changed*/
+        batch_remove(a);
         anim_mark_list_change();
 
         /*Call the callback function at the end*/
@@ -451,7 +538,6 @@ static void anim_ready_handler(lv_anim_t * a)
 
 static void anim_mark_list_change(void)
 {
-    state.anim_list_changed = true;
     if(_lv_ll_get_head(anim_ll_p) == NULL)
         lv_timer_pause(state.timer);
     else
@@ -518,9 +604,9 @@ static bool remove_concurrent_anims(lv_anim_t * a_current)
            ((a->exec_cb && a->exec_cb == a_current->exec_cb)
             /*|| (a->custom_exec_cb && a->custom_exec_cb == a_current->custom_exec_cb)*/)) {
             _lv_ll_remove(anim_ll_p, a);
+            batch_remove(a);
             if(a->deleted_cb != NULL) a->deleted_cb(a);
             lv_free(a);
-            /*Read by `anim_timer`. It need to know if a delete occurred in the linked list*/
             anim_mark_list_change();
 
             del_any = true;
@@ -545,10 +631,10 @@ static bool delete_core(void * var, void * cb, bool custom_exec_cb)
         void * a_cb = custom_exec_cb ? (void *)a->custom_exec_cb : (void *)a->exec_cb;
         if((a->var == var || var == NULL) && (a_cb == cb || cb == NULL)) {
             _lv_ll_remove(anim_ll_p, a);
+            batch_remove(a);
             if(a->deleted_cb != NULL) a->deleted_cb(a);
             lv_free(a);
-            anim_mark_list_change(); /*Read by `anim_timer`. It need to know if a delete occurred in
-                                       the linked list*/
+            anim_mark_list_change();
             del_any = true;
             del = true;
         }
@@ -560,3 +646,166 @@ static bool delete_core(void * var, void * cb, bool custom_exec_cb)
 
     return del_any;
 }
+
+/**
+ * Make sure the batch has place for `cnt` animations.
+ * All arrays are allocated in one block.
+ * @return false if the memory couldn't be allocated
+ */
+static bool batch_reserve(lv_anim_batch_t * batch, uint32_t cnt)
+{
+    if(cnt <= batch->size) return true;
+
+    uint32_t size = LV_MAX(batch->size * 2, cnt);
+    size = LV_MAX(size, 16);
+
+    /*Order the arrays by alignment*/
+    size_t elem_size = sizeof(lv_anim_t *) + sizeof(lv_anim_batch_input_t) + sizeof(lv_anim_bezier3_para_t) +
+                       4 * sizeof(int32_t) + sizeof(uint32_t) + sizeof(uint8_t);
+    uint8_t * buf = lv_malloc(size * elem_size);
+    LV_ASSERT_MALLOC(buf);
+    if(buf == NULL) return false;
+
+    lv_free(batch->anims);
+    batch->anims = (lv_anim_t **)buf;
+    buf += size * sizeof(lv_anim_t *);
+    batch->input = (lv_anim_batch_input_t *)buf;
+    buf += size * sizeof(lv_anim_batch_input_t);
+    batch->bezier3 = (lv_anim_bezier3_para_t *)buf;
+    buf += size * sizeof(lv_anim_bezier3_para_t);
+    batch->values = (int32_t *)buf;
+    buf += size * sizeof(int32_t);
+    batch->t = (int32_t *)buf;
+    buf += size * sizeof(int32_t);
+    batch->start_value = (int32_t *)buf;
+    buf += size * sizeof(int32_t);
+    batch->diff = (int32_t *)buf;
+    buf += size * sizeof(int32_t);
+    batch->index = (uint32_t *)buf;
+    buf += size * sizeof(uint32_t);
+    batch->group = buf;
+    batch->size = size;
+
+    return true;
+}
+
+static batch_group_t batch_get_group(lv_anim_t * a)
+{
+    /*The start callback needs to be called first which might change the parameters*/
+    if(!a->start_cb_called || a->act_time < 0) return BATCH_GROUP_NONE;
+
+    if(a->path_cb == lv_anim_path_linear) return BATCH_GROUP_LINEAR;
+    if(a->path_cb == lv_anim_path_ease_in ||
+       a->path_cb == lv_anim_path_ease_out ||
+       a->path_cb == lv_anim_path_ease_in_out ||
+       a->path_cb == lv_anim_path_overshoot ||
+       a->path_cb == lv_anim_path_custom_bezier3) {
+        return BATCH_GROUP_BEZIER3;
+    }
+
+    return BATCH_GROUP_CUSTOM;
+}
+
+/**
+ * Calculate the values of the grouped animations of a batch
+ * @param batch         pointer to a batch
+ * @param group_cnt     number of animations in each group
+ */
+static void batch_calc_values(lv_anim_batch_t * batch, const uint32_t * group_cnt)
+{
+    /*Sort the running animations by groups into the struct of arrays*/
+    uint32_t group_start[BATCH_GROUP_CNT];
+    uint32_t next[BATCH_GROUP_CNT];
+    uint32_t g;
+    uint32_t k = 0;
+    for(g = 0; g < BATCH_GROUP_CNT; g++) {
+        group_start[g] = k;
+        next[g] = k;
+        k += group_cnt[g];
+    }
+
+    uint32_t i;
+    for(i = 0; i < batch->cnt; i++) {
+        g = batch->group[i];
+        if(g == BATCH_GROUP_NONE) continue;
+
+        lv_anim_t * a = batch->anims[i];
+        k = next[g]++;
+        batch->index[k] = i;
+        if(g == BATCH_GROUP_CUSTOM) continue;
+
+        batch->t[k] = lv_map(a->act_time, 0, a->duration, 0, LV_BEZIER_VAL_MAX);
+        batch->start_value[k] = a->start_value;
+        batch->diff[k] = a->end_value - a->start_value;
+
+        if(g == BATCH_GROUP_BEZIER3) {
+            if(a->path_cb == lv_anim_path_ease_in) batch->bezier3[k] = path_ease_in;
+            else if(a->path_cb == lv_anim_path_ease_out) batch->bezier3[k] = path_ease_out;
+            else if(a->path_cb == lv_anim_path_ease_in_out) batch->bezier3[k] = path_ease_in_out;
+            else if(a->path_cb == lv_anim_path_overshoot) batch->bezier3[k] = path_overshoot;
+            else batch->bezier3[k] = a->parameter.bezier3;
+        }
+    }
+
+    /*Map the time to the progress on the Bezier curves. The time of the linear animations is already the progress.*/
+    uint32_t bezier_end = group_start[BATCH_GROUP_BEZIER3] + group_cnt[BATCH_GROUP_BEZIER3];
+    for(k = group_start[BATCH_GROUP_BEZIER3]; k < bezier_end; k++) {
+        const lv_anim_bezier3_para_t * p = &batch->bezier3[k];
+        batch->t[k] = lv_cubic_bezier(batch->t[k], p->x1, p->y1, p->x2, p->y2);
+    }
+
+    /*Interpolate between the start and end values. It has no dependencies so it can be vectorized.*/
+    int32_t * t = batch->t;
+    const int32_t * start_value = batch->start_value;
+    const int32_t * diff = batch->diff;
+    for(k = 0; k < bezier_end; k++) {
+        t[k] = start_value[k] + ((t[k] * diff[k]) >> LV_BEZIER_VAL_SHIFT);
+    }
+
+    for(k = 0; k < bezier_end; k++) {
+        batch->values[batch->index[k]] = t[k];
+    }
+
+    uint32_t custom_end = bezier_end + group_cnt[BATCH_GROUP_CUSTOM];
+    for(k = bezier_end; k < custom_end; k++) {
+        lv_anim_t * a = batch->anims[batch->index[k]];
+        batch->values[batch->index[k]] = a->path_cb(a);
+    }
+}
+
+/**
+ * Check if an animation was changed since its value was calculated in a batch
+ * @param a         pointer to an animation
+ * @param input     the parameters used to calculate the value of the animation
+ * @return          true: the value needs to be calculated again
+ */
+static bool batch_input_changed(const lv_anim_t * a, const lv_anim_batch_input_t * input)
+{
+    if(a->path_cb != input->path_cb) return true;
+    if(a->act_time != input->act_time) return true;
+    if(a->start_value != input->start_value) return true;
+    if(a->end_value != input->end_value) return true;
+    if(a->duration != input->duration) return true;
+    if(a->path_cb == lv_anim_path_custom_bezier3) {
+        const lv_anim_bezier3_para_t * p = &a->parameter.bezier3;
+        if(p->x1 != input->bezier3.x1 || p->y1 != input->bezier3.y1 ||
+           p->x2 != input->bezier3.x2 || p->y2 != input->bezier3.y2) return true;
+    }
+
+    return false;
+}
+
+/**
+ * Don't let the running rounds use an animation, e.g. because it's being deleted
+ * @param a pointer to an animation
+ */
+static void batch_remove(lv_anim_t * a)
+{
+    /*The index is valid only in one of the rounds, the others won't find the animation there*/
+    lv_anim_batch_t * batch;
+    for(batch = state.batch_act; batch; batch = batch->parent) {
+        if(a->batch_index < batch->cnt && batch->anims[a->batch_index] == a) {
+            batch->anims[a->batch_index] = NULL;
+        }
+    }
+}
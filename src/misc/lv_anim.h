@@ -91,13 +91,6 @@ typedef enum {
 struct _lv_anim_t;
 struct _lv_timer_t;
 
-typedef struct {
-    bool anim_list_changed;
-    bool anim_run_round;
-    struct _lv_timer_t * timer;
-    lv_ll_t anim_ll;
-} lv_anim_state_t;
-
 /** Get the current value during an animation*/
 typedef int32_t (*lv_anim_path_cb_t)(const struct _lv_anim_t *);
 
@@ -132,6 +125,42 @@ typedef struct _lv_anim_bezier3_para_t {
     int16_t y2;
 } lv_anim_bezier3_para_t; /**< Parameter used when path is custom_bezier*/
 
+/** The parameters of an animation which were used to calculate its value in a batch*/
+typedef struct {
+    lv_anim_path_cb_t path_cb;
+    int32_t act_time;
+    int32_t start_value;
+    int32_t end_value;
+    int32_t duration;
+    lv_anim_bezier3_para_t bezier3;
+} lv_anim_batch_input_t;
+
+/** The animations handled in one round of the animation timer.
+ * The parameters of the animations are stored as struct of arrays grouped by the type of their path
+ * so that the values can be calculated in tight loops.*/
+typedef struct _lv_anim_batch_t {
+    struct _lv_anim_t ** anims;     /**< The animations in the order of the list (NULL if deleted in this round)*/
+    int32_t * values;               /**< The new value of the animations if `group` is not `NONE`*/
+    lv_anim_batch_input_t * input;  /**< The parameters used to calculate `values`*/
+    uint8_t * group;                /**< The path group of the animations*/
+    uint32_t * index;               /**< Index of the grouped elements in `anims`*/
+    int32_t * t;                    /**< Time of the grouped elements in [0..LV_BEZIER_VAL_MAX] range*/
+    int32_t * start_value;          /**< Start value of the grouped elements*/
+    int32_t * diff;                 /**< Difference of the end and start value of the grouped elements*/
+    struct _lv_anim_bezier3_para_t * bezier3; /**< Bezier parameters of the grouped elements*/
+    struct _lv_anim_batch_t * parent;   /**< The round during which this round was started or NULL*/
+    uint32_t cnt;
+    uint32_t size;
+    bool cb_called;                 /**< A callback was called since `values` were calculated*/
+} lv_anim_batch_t;
+
+typedef struct {
+    struct _lv_timer_t * timer;
+    lv_ll_t anim_ll;
+    lv_anim_batch_t batch;          /**< Reused by the rounds of the animation timer*/
+    lv_anim_batch_t * batch_act;    /**< The innermost running round or NULL*/
+} lv_anim_state_t;
+
 /** Describes an animation*/
 typedef struct _lv_anim_t {
     void * var;                                 /**<Variable to animate*/
@@ -161,8 +190,8 @@ typedef struct _lv_anim_t {
 
     /*Animation system use these - user shouldn't set*/
     uint32_t last_timer_run;
+    uint32_t batch_index;     /**< Index in the batch of the running round*/
     uint8_t playback_now : 1; /**< Play back is in progress*/
-    uint8_t run_round : 1;    /**< Indicates the animation has run in this round*/
     uint8_t start_cb_called : 1;    /**< Indicates that the `start_cb` was already called*/
 } lv_anim_t;
 
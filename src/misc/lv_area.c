@@ -26,6 +26,7 @@
  **********************/
 
 static bool lv_point_within_circle(const lv_area_t * area, const lv_point_t * p);
+static int32_t skew_get_tan(int32_t skew);
 
 /**********************
  *  STATIC VARIABLES
@@ -498,6 +499,29 @@ void lv_point_transform(lv_point_t * p, int32_t angle, int32_t scale_x, int32_t
     }
 }
 
+void lv_point_skew(lv_point_t * p, int32_t skew_x, int32_t skew_y, const lv_point_t * pivot, bool inv)
+{
+    if(skew_x == 0 && skew_y == 0) return;
+
+    const int64_t one = 1 << _LV_TRANSFORM_TRIGO_SHIFT;
+    int64_t tan_x = skew_get_tan(skew_x);
+    int64_t tan_y = skew_get_tan(skew_y);
+    int64_t x = p->x - pivot->x;
+    int64_t y = p->y - pivot->y;
+
+    if(inv) {
+        /*The skew matrix is singular if tan_x * tan_y == 1, nothing to invert then*/
+        int64_t det = one * one - tan_x * tan_y;
+        if(det == 0) return;
+        p->x = (int32_t)((x * one - tan_x * y) * one / det) + pivot->x;
+        p->y = (int32_t)((y * one - tan_y * x) * one / det) + pivot->y;
+    }
+    else {
+        p->x = (int32_t)((x * one + tan_x * y) >> _LV_TRANSFORM_TRIGO_SHIFT) + pivot->x;
+        p->y = (int32_t)((y * one + tan_y * x) >> _LV_TRANSFORM_TRIGO_SHIFT) + pivot->y;
+    }
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -522,3 +546,22 @@ static bool lv_point_within_circle(const lv_area_t * area, const lv_point_t * p)
     else
         return false;
 }
+
+/**
+ * Get the tangent of a skew angle
+ * @param skew      the angle in 0.1 degree units. Limited to -89..89 degrees.
+ * @return          the tangent upscaled by 2^_LV_TRANSFORM_TRIGO_SHIFT
+ */
+static int32_t skew_get_tan(int32_t skew)
+{
+    skew = LV_CLAMP(-890, skew, 890);
+
+    int32_t angle_low = skew / 10;
+    int32_t angle_high = skew < 0 ? angle_low - 1 : angle_low + 1;
+    int32_t angle_rem = LV_ABS(skew - (angle_low * 10));
+
+    int32_t s = (lv_trigo_sin(angle_low) * (10 - angle_rem) + lv_trigo_sin(angle_high) * angle_rem) / 10;
+    int32_t c = (lv_trigo_cos(angle_low) * (10 - angle_rem) + lv_trigo_cos(angle_high) * angle_rem) / 10;
+
+    return s * (1 << _LV_TRANSFORM_TRIGO_SHIFT) / c;
+}
@@ -265,6 +265,17 @@ void lv_area_align(const lv_area_t * base, lv_area_t * to_align, lv_align_t alig
 void lv_point_transform(lv_point_t * p, int32_t angle, int32_t scale_x, int32_t scale_y, const lv_point_t * pivot,
                         bool zoom_first);
 
+/**
+ * Skew a point around a pivot. Applied before `lv_point_transform()` when a point is transformed
+ * with skew, rotation and scale, and after the inverse `lv_point_transform()` when transformed back.
+ * @param p         pointer to the point to skew
+ * @param skew_x    horizontal skew in 0.1 degree units
+ * @param skew_y    vertical skew in 0.1 degree units
+ * @param pivot     the pivot of the skew
+ * @param inv       true: apply the inverse skew
+ */
+void lv_point_skew(lv_point_t * p, int32_t skew_x, int32_t skew_y, const lv_point_t * pivot, bool inv);
+
 static inline lv_point_t lv_point_from_precise(const lv_point_precise_t * p)
 {
     lv_point_t point = {
@@ -44,6 +44,9 @@ void _lv_cache_init(void)
 
 void _lv_cache_deinit(void)
 {
+    lv_free(_cache_manager.data_hash_cbs);
+    _cache_manager.data_hash_cbs = NULL;
+    _cache_manager.data_hash_cb_cnt = 0;
     lv_mutex_delete(&_cache_manager.mutex);
 }
 
@@ -57,6 +60,7 @@ void lv_cache_set_manager(lv_cache_manager_t * manager)
 
     _cache_manager.add_cb = manager->add_cb;
     _cache_manager.find_by_data_cb = manager->find_by_data_cb;
+    _cache_manager.find_by_src_cb = manager->find_by_src_cb;
     _cache_manager.invalidate_cb = manager->invalidate_cb;
     _cache_manager.get_data_cb = manager->get_data_cb;
     _cache_manager.release_cb = manager->release_cb;
@@ -79,7 +83,11 @@ lv_cache_entry_t * lv_cache_find_by_data(const void * data, size_t data_size, ui
     LV_ASSERT(_cache_manager.locked);
     if(_cache_manager.find_by_data_cb == NULL) return NULL;
 
-    return _cache_manager.find_by_data_cb(data, data_size, data_type);
+    lv_cache_entry_t * entry = _cache_manager.find_by_data_cb(data, data_size, data_type);
+    if(entry) _cache_manager.hit_cnt++;
+    else _cache_manager.miss_cnt++;
+
+    return entry;
 }
 
 lv_cache_entry_t * lv_cache_find_by_src(lv_cache_entry_t * entry, const void * src, lv_cache_src_type_t src_type)
@@ -87,7 +95,13 @@ lv_cache_entry_t * lv_cache_find_by_src(lv_cache_entry_t * entry, const void * s
     LV_ASSERT(_cache_manager.locked);
     if(_cache_manager.find_by_src_cb == NULL) return NULL;
 
-    return _cache_manager.find_by_src_cb(entry, src, src_type);
+    lv_cache_entry_t * found = _cache_manager.find_by_src_cb(entry, src, src_type);
+    if(entry == NULL) {
+        if(found) _cache_manager.hit_cnt++;
+        else _cache_manager.miss_cnt++;
+    }
+
+    return found;
 }
 
 void lv_cache_invalidate(lv_cache_entry_t * entry)
@@ -102,9 +116,12 @@ void lv_cache_invalidate_by_src(const void * src, lv_cache_src_type_t src_type)
 {
     lv_cache_entry_t * next;
     LV_ASSERT(_cache_manager.locked);
-    lv_cache_entry_t * entry = lv_cache_find_by_src(NULL, src, src_type);
+    if(_cache_manager.find_by_src_cb == NULL) return;
+
+    /*Call the manager directly to not count the searches as cache hits and misses*/
+    lv_cache_entry_t * entry = _cache_manager.find_by_src_cb(NULL, src, src_type);
     while(entry) {
-        next = lv_cache_find_by_src(entry, src, src_type);
+        next = _cache_manager.find_by_src_cb(entry, src, src_type);
         lv_cache_invalidate(entry);
         entry = next;
     }
@@ -159,6 +176,42 @@ uint32_t lv_cache_register_data_type(void)
     return _cache_manager.last_data_type;
 }
 
+void lv_cache_set_data_hash_cb(uint32_t data_type, lv_cache_data_hash_cb_t hash_cb)
+{
+    if(data_type >= _cache_manager.data_hash_cb_cnt) {
+        if(hash_cb == NULL) return;
+
+        uint32_t new_cnt = data_type + 1;
+        lv_cache_data_hash_cb_t * new_cbs = lv_realloc(_cache_manager.data_hash_cbs,
+                                                       new_cnt * sizeof(lv_cache_data_hash_cb_t));
+        LV_ASSERT_MALLOC(new_cbs);
+        if(new_cbs == NULL) return;
+
+        uint32_t i;
+        for(i = _cache_manager.data_hash_cb_cnt; i < new_cnt; i++) new_cbs[i] = NULL;
+        _cache_manager.data_hash_cbs = new_cbs;
+        _cache_manager.data_hash_cb_cnt = new_cnt;
+    }
+
+    _cache_manager.data_hash_cbs[data_type] = hash_cb;
+}
+
+lv_cache_data_hash_cb_t lv_cache_get_data_hash_cb(uint32_t data_type)
+{
+    if(data_type >= _cache_manager.data_hash_cb_cnt) return NULL;
+    return _cache_manager.data_hash_cbs[data_type];
+}
+
+uint32_t lv_cache_get_hit_cnt(void)
+{
+    return _cache_manager.hit_cnt;
+}
+
+uint32_t lv_cache_get_miss_cnt(void)
+{
+    return _cache_manager.miss_cnt;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -127,6 +127,16 @@ typedef lv_cache_entry_t * (*lv_cache_add_cb)(const void * data, size_t data_siz
  */
 typedef lv_cache_entry_t * (*lv_cache_find_by_data_cb)(const void * data, size_t data_size, uint32_t data_type);
 
+/**
+ * Hash the data of a data type.
+ * Data which is the same according to the `compare_cb` of the entries needs to have the same hash,
+ * so typically the same fields need to be hashed which are compared.
+ * @param data      the data to hash
+ * @param data_size size of data
+ * @return          the hash of the data
+ */
+typedef uint32_t (*lv_cache_data_hash_cb_t)(const void * data, size_t data_size);
+
 /**
  * Get the next entry which has the given source and parameters
  * @param prev_entry    pointer to the previous entry from which the nest should be found. NULL means to start from the beginning.
@@ -184,6 +194,10 @@ typedef struct {
     size_t max_size;
     uint32_t locked     : 1;    /**< Show the mutex state, used to log unlocked cache access*/
     uint32_t last_data_type;
+    lv_cache_data_hash_cb_t * data_hash_cbs;    /**< The hash functions indexed by data type*/
+    uint32_t data_hash_cb_cnt;
+    uint32_t hit_cnt;           /**< Number of searches which found an entry*/
+    uint32_t miss_cnt;          /**< Number of searches which didn't find an entry*/
 } lv_cache_manager_t;
 
 /**********************
@@ -295,6 +309,36 @@ void lv_cache_unlock(void);
  */
 uint32_t lv_cache_register_data_type(void);
 
+/**
+ * Set a function to hash the data of a data type.
+ * The cache manager can use it to find the entries by data without comparing them with all the entries
+ * having the same data type. Set it before adding entries with this data type,
+ * and the data of the entries shouldn't change while they are in the cache.
+ * @param data_type     a data type returned by `lv_cache_register_data_type()`
+ * @param hash_cb       the hash function or NULL to not hash the data
+ */
+void lv_cache_set_data_hash_cb(uint32_t data_type, lv_cache_data_hash_cb_t hash_cb);
+
+/**
+ * Get the hash function of a data type.
+ * @param data_type     a data type
+ * @return              the hash function set by `lv_cache_set_data_hash_cb()` or NULL if not set
+ */
+lv_cache_data_hash_cb_t lv_cache_get_data_hash_cb(uint32_t data_type);
+
+/**
+ * Get the number of `lv_cache_find_by_data()` and `lv_cache_find_by_src()` calls which found an entry.
+ * Only the first search of `lv_cache_find_by_src()` is counted (when `entry` is `NULL`).
+ * @return      the number of hits
+ */
+uint32_t lv_cache_get_hit_cnt(void);
+
+/**
+ * Get the number of `lv_cache_find_by_data()` and `lv_cache_find_by_src()` calls which didn't find an entry.
+ * @return      the number of misses
+ */
+uint32_t lv_cache_get_miss_cnt(void);
+
 /**********************
  *      MACROS
  **********************/
@@ -158,7 +158,8 @@ static void invalidate_cb(lv_cache_entry_t * entry)
 {
     if(entry == NULL) return;
 
-    dsc.cur_size -= entry->memory_usage;
+    /*Temporary entries were not counted in `cur_size`*/
+    if(!entry->temporary) dsc.cur_size -= entry->memory_usage;
     LV_TRACE_CACHE("Drop cache: %u bytes", (uint32_t)entry->memory_usage);
 
     if(entry->invalidate_cb) entry->invalidate_cb(entry);
@@ -184,15 +185,17 @@ static void release_cb(lv_cache_entry_t * entry)
 {
     if(entry == NULL) return;
 
-    if(entry->temporary) {
-        invalidate_cb(entry);
+    if(entry->usage_count == 0) {
+        if(entry->temporary) invalidate_cb(entry);
+        else LV_LOG_ERROR("More lv_cache_release than lv_cache_get_data");
+        return;
     }
-    else {
-        if(entry->usage_count == 0) {
-            LV_LOG_ERROR("More lv_cache_release than lv_cache_get_data");
-            return;
-        }
-        entry->usage_count--;
+
+    entry->usage_count--;
+
+    /*Temporary entries can be found and used by other draw units too, so free them only when no one uses them*/
+    if(entry->temporary && entry->usage_count == 0) {
+        invalidate_cb(entry);
     }
 }
 
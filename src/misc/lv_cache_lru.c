@@ -0,0 +1,453 @@
+/**
+ * @file lv_cache_lru.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_cache_lru.h"
+#include "../stdlib/lv_string.h"
+#include "../stdlib/lv_mem.h"
+#include "../core/lv_global.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define _cache_manager LV_GLOBAL_DEFAULT()->cache_manager
+#define dsc LV_GLOBAL_DEFAULT()->cache_lru_dsc
+
+/*Number of buckets allocated when the first entry is added*/
+#define BUCKET_CNT_MIN  16
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef enum {
+    SRC_STATE_PENDING,  /*In `dsc.pending`, `src` might be not set yet*/
+    SRC_STATE_INDEXED,  /*In `dsc.src_buckets`*/
+    SRC_STATE_NONE,     /*`src` was NULL so it can't be found by source*/
+} src_state_t;
+
+struct _lv_cache_lru_node_t {
+    lv_cache_entry_t entry;     /*Must be the first to convert entries to nodes*/
+    lv_cache_lru_node_t * lru_prev;
+    lv_cache_lru_node_t * lru_next;
+    lv_cache_lru_node_t * src_next;     /*Next node in the same source bucket or in the pending list*/
+    lv_cache_lru_node_t * data_next;    /*Next node in the same data bucket*/
+    uint32_t src_hash;
+    uint32_t data_hash;
+    src_state_t src_state;
+};
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static lv_cache_entry_t * add_cb(const void * data, size_t data_size, uint32_t data_type, size_t memory_usage);
+static lv_cache_entry_t * find_by_data_cb(const void * data, size_t data_size, uint32_t data_type);
+static lv_cache_entry_t * find_by_src_cb(lv_cache_entry_t * entry, const void * src, lv_cache_src_type_t src_type);
+static void invalidate_cb(lv_cache_entry_t * entry);
+static const void * get_data_cb(lv_cache_entry_t * entry);
+static void release_cb(lv_cache_entry_t * entry);
+static void set_max_size_cb(size_t new_size);
+static void empty_cb(void);
+static bool drop_lru(void);
+static void index_pending(void);
+static bool resize_buckets(void);
+static void lru_remove(lv_cache_lru_node_t * node);
+static void lru_ins_head(lv_cache_lru_node_t * node);
+static uint32_t hash_src(const void * src, lv_cache_src_type_t src_type);
+static uint32_t hash_data(const void * data, size_t data_size, uint32_t data_type);
+static bool src_match(const lv_cache_entry_t * entry, const void * src, lv_cache_src_type_t src_type);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+#if LV_USE_LOG && LV_LOG_TRACE_CACHE
+    #define LV_TRACE_CACHE(...) LV_LOG_TRACE(__VA_ARGS__)
+#else
+    #define LV_TRACE_CACHE(...)
+#endif
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void _lv_cache_lru_init(void)
+{
+    lv_memzero(&dsc, sizeof(lv_cache_lru_dsc_t));
+}
+
+void _lv_cache_lru_deinit(void)
+{
+    empty_cb();
+
+    lv_free(dsc.src_buckets);
+    lv_free(dsc.data_buckets);
+    lv_memzero(&dsc, sizeof(lv_cache_lru_dsc_t));
+}
+
+void lv_cache_lru_manager_init(lv_cache_manager_t * manager)
+{
+    lv_memzero(manager, sizeof(lv_cache_manager_t));
+    manager->add_cb = add_cb;
+    manager->find_by_data_cb = find_by_data_cb;
+    manager->find_by_src_cb = find_by_src_cb;
+    manager->invalidate_cb = invalidate_cb;
+    manager->get_data_cb = get_data_cb;
+    manager->release_cb = release_cb;
+    manager->set_max_size_cb = set_max_size_cb;
+    manager->empty_cb = empty_cb;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static lv_cache_entry_t * add_cb(const void * data, size_t data_size, uint32_t data_type, size_t memory_usage)
+{
+    size_t max_size = lv_cache_get_max_size();
+    /*Can't cache data larger than max size*/
+
+    bool temporary = memory_usage > max_size ? true : false;
+    if(!temporary) {
+        /*Keep dropping items until there is enough space*/
+        while(dsc.cur_size + memory_usage > max_size) {
+            bool ret = drop_lru();
+
+            /*No item could be dropped.
+             *It can happen because the usage_count of the remaining items are not zero.*/
+            if(ret == false) {
+                temporary = true;
+                break;
+            }
+        }
+    }
+
+    /*Keep the number of entries per bucket around 1.
+     *If the tables can't be enlarged the buckets will be just longer*/
+    if(dsc.entry_cnt >= dsc.bucket_cnt) {
+        if(!resize_buckets() && dsc.bucket_cnt == 0) return NULL;
+    }
+
+    lv_cache_lru_node_t * node = lv_malloc_zeroed(sizeof(lv_cache_lru_node_t));
+    LV_ASSERT_MALLOC(node);
+    if(node == NULL) return NULL;
+
+    lv_cache_entry_t * entry = &node->entry;
+    entry->memory_usage = memory_usage;
+    entry->weight = 1;
+    entry->temporary = temporary;
+    entry->data = data;
+    entry->data_size = data_size;
+    entry->data_type = data_type;
+
+    /*The data descriptor is known only now, so it can be hashed immediately*/
+    node->data_hash = hash_data(data, data_size, data_type);
+    uint32_t i = node->data_hash & (dsc.bucket_cnt - 1);
+    node->data_next = dsc.data_buckets[i];
+    dsc.data_buckets[i] = node;
+
+    /*`src` is set by the caller after adding the entry so hash it on the next search*/
+    node->src_state = SRC_STATE_PENDING;
+    node->src_next = dsc.pending;
+    dsc.pending = node;
+
+    lru_ins_head(node);
+    dsc.entry_cnt++;
+
+    if(temporary) {
+        LV_TRACE_CACHE("Add temporary cache: %lu bytes", (unsigned long)memory_usage);
+    }
+    else {
+        LV_TRACE_CACHE("Add cache: %lu bytes", (unsigned long)memory_usage);
+        dsc.cur_size += memory_usage;
+    }
+
+    return entry;
+}
+
+static lv_cache_entry_t * find_by_data_cb(const void * data, size_t data_size, uint32_t data_type)
+{
+    if(dsc.bucket_cnt == 0) return NULL;
+
+    uint32_t hash = hash_data(data, data_size, data_type);
+    lv_cache_lru_node_t * node = dsc.data_buckets[hash & (dsc.bucket_cnt - 1)];
+    while(node) {
+        lv_cache_entry_t * entry = &node->entry;
+        if(node->data_hash == hash && entry->data_type == data_type && entry->data_size == data_size) {
+            if(entry->compare_cb(entry->data, data, data_size)) {
+                return entry;
+            }
+        }
+
+        node = node->data_next;
+    }
+
+    return NULL;
+}
+
+static lv_cache_entry_t * find_by_src_cb(lv_cache_entry_t * entry, const void * src, lv_cache_src_type_t src_type)
+{
+    index_pending();
+
+    if(dsc.bucket_cnt == 0) return NULL;
+    if(src_type == LV_CACHE_SRC_TYPE_PATH && src == NULL) return NULL;
+
+    uint32_t hash = hash_src(src, src_type);
+    lv_cache_lru_node_t * node;
+    if(entry == NULL) {
+        node = dsc.src_buckets[hash & (dsc.bucket_cnt - 1)];
+    }
+    else {
+        /*The entries with the same source are in the same bucket so continue from there*/
+        lv_cache_lru_node_t * prev = (lv_cache_lru_node_t *)entry;
+        if(prev->src_state != SRC_STATE_INDEXED) return NULL;
+        node = prev->src_next;
+    }
+
+    while(node) {
+        if(node->src_hash == hash && src_match(&node->entry, src, src_type)) return &node->entry;
+        node = node->src_next;
+    }
+
+    return NULL;
+}
+
+static void invalidate_cb(lv_cache_entry_t * entry)
+{
+    if(entry == NULL) return;
+
+    lv_cache_lru_node_t * node = (lv_cache_lru_node_t *)entry;
+
+    /*Unlink before calling the entry's invalidate_cb as it might clear the hashed fields*/
+    lv_cache_lru_node_t ** next_p = &dsc.data_buckets[node->data_hash & (dsc.bucket_cnt - 1)];
+    while(*next_p != node) next_p = &(*next_p)->data_next;
+    *next_p = node->data_next;
+
+    if(node->src_state != SRC_STATE_NONE) {
+        if(node->src_state == SRC_STATE_INDEXED) next_p = &dsc.src_buckets[node->src_hash & (dsc.bucket_cnt - 1)];
+        else next_p = &dsc.pending;
+        while(*next_p != node) next_p = &(*next_p)->src_next;
+        *next_p = node->src_next;
+    }
+
+    lru_remove(node);
+    dsc.entry_cnt--;
+
+    /*Temporary entries were not counted in `cur_size`*/
+    if(!entry->temporary) dsc.cur_size -= entry->memory_usage;
+    LV_TRACE_CACHE("Drop cache: %u bytes", (uint32_t)entry->memory_usage);
+
+    if(entry->invalidate_cb) entry->invalidate_cb(entry);
+
+    lv_free(node);
+}
+
+static const void * get_data_cb(lv_cache_entry_t * entry)
+{
+    lv_cache_lru_node_t * node = (lv_cache_lru_node_t *)entry;
+    if(dsc.lru_head != node) {
+        lru_remove(node);
+        lru_ins_head(node);
+    }
+
+    entry->usage_count++;
+
+    return entry->data;
+}
+
+static void release_cb(lv_cache_entry_t * entry)
+{
+    if(entry == NULL) return;
+
+    if(entry->usage_count == 0) {
+        if(entry->temporary) invalidate_cb(entry);
+        else LV_LOG_ERROR("More lv_cache_release than lv_cache_get_data");
+        return;
+    }
+
+    entry->usage_count--;
+
+    /*Temporary entries can be found and used by other draw units too, so free them only when no one uses them*/
+    if(entry->temporary && entry->usage_count == 0) {
+        invalidate_cb(entry);
+    }
+}
+
+static void set_max_size_cb(size_t new_size)
+{
+    while(dsc.cur_size > new_size) {
+        bool ret = drop_lru();
+
+        /*No item could be dropped.
+         *It can happen because the usage_count of the remaining items are not zero.*/
+        if(ret == false) return;
+    }
+}
+
+static void empty_cb(void)
+{
+    while(dsc.lru_head) {
+        invalidate_cb(&dsc.lru_head->entry);
+    }
+}
+
+static bool drop_lru(void)
+{
+    /*Temporary entries don't use the cache's space and are freed on release anyway*/
+    lv_cache_lru_node_t * node = dsc.lru_tail;
+    while(node && (node->entry.usage_count != 0 || node->entry.temporary)) {
+        node = node->lru_prev;
+    }
+
+    if(node == NULL) return false;
+
+    invalidate_cb(&node->entry);
+    return true;
+}
+
+static void index_pending(void)
+{
+    /*Reverse the list to add the oldest first and have the newest entries at the head of the buckets*/
+    lv_cache_lru_node_t * reversed = NULL;
+    while(dsc.pending) {
+        lv_cache_lru_node_t * node = dsc.pending;
+        dsc.pending = node->src_next;
+        node->src_next = reversed;
+        reversed = node;
+    }
+
+    while(reversed) {
+        lv_cache_lru_node_t * node = reversed;
+        reversed = node->src_next;
+
+        if(node->entry.src == NULL) {
+            node->src_state = SRC_STATE_NONE;
+            node->src_next = NULL;
+            continue;
+        }
+
+        node->src_hash = hash_src(node->entry.src, node->entry.src_type);
+        uint32_t i = node->src_hash & (dsc.bucket_cnt - 1);
+        node->src_next = dsc.src_buckets[i];
+        dsc.src_buckets[i] = node;
+        node->src_state = SRC_STATE_INDEXED;
+    }
+}
+
+static bool resize_buckets(void)
+{
+    uint32_t new_cnt = dsc.bucket_cnt ? dsc.bucket_cnt * 2 : BUCKET_CNT_MIN;
+    lv_cache_lru_node_t ** src_buckets = lv_malloc_zeroed(new_cnt * sizeof(lv_cache_lru_node_t *));
+    lv_cache_lru_node_t ** data_buckets = lv_malloc_zeroed(new_cnt * sizeof(lv_cache_lru_node_t *));
+    if(src_buckets == NULL || data_buckets == NULL) {
+        lv_free(src_buckets);
+        lv_free(data_buckets);
+        return false;
+    }
+
+    /*Go from the least recently used so that the recently used entries will be at the head of the buckets*/
+    lv_cache_lru_node_t * node = dsc.lru_tail;
+    while(node) {
+        uint32_t i = node->data_hash & (new_cnt - 1);
+        node->data_next = data_buckets[i];
+        data_buckets[i] = node;
+
+        if(node->src_state == SRC_STATE_INDEXED) {
+            i = node->src_hash & (new_cnt - 1);
+            node->src_next = src_buckets[i];
+            src_buckets[i] = node;
+        }
+
+        node = node->lru_prev;
+    }
+
+    lv_free(dsc.src_buckets);
+    lv_free(dsc.data_buckets);
+    dsc.src_buckets = src_buckets;
+    dsc.data_buckets = data_buckets;
+    dsc.bucket_cnt = new_cnt;
+
+    return true;
+}
+
+static void lru_remove(lv_cache_lru_node_t * node)
+{
+    if(node->lru_prev) node->lru_prev->lru_next = node->lru_next;
+    else dsc.lru_head = node->lru_next;
+
+    if(node->lru_next) node->lru_next->lru_prev = node->lru_prev;
+    else dsc.lru_tail = node->lru_prev;
+
+    node->lru_prev = NULL;
+    node->lru_next = NULL;
+}
+
+static void lru_ins_head(lv_cache_lru_node_t * node)
+{
+    node->lru_prev = NULL;
+    node->lru_next = dsc.lru_head;
+    if(dsc.lru_head) dsc.lru_head->lru_prev = node;
+    else dsc.lru_tail = node;
+    dsc.lru_head = node;
+}
+
+/**
+ * Mix the bits of a value to use its low bits as bucket index
+ */
+static uint32_t hash_mix(uint32_t h)
+{
+    h ^= h >> 16;
+    h *= 0x85ebca6b;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35;
+    h ^= h >> 16;
+    return h;
+}
+
+static uint32_t hash_src(const void * src, lv_cache_src_type_t src_type)
+{
+    if(src_type == LV_CACHE_SRC_TYPE_PATH) {
+        /*FNV-1a*/
+        const uint8_t * s = src;
+        uint32_t h = 2166136261u;
+        while(*s) {
+            h ^= *s;
+            h *= 16777619u;
+            s++;
+        }
+        return hash_mix(h);
+    }
+    else {
+        uint64_t v = (uint64_t)(uintptr_t)src;
+        return hash_mix((uint32_t)v ^ (uint32_t)(v >> 32));
+    }
+}
+
+/**
+ * Hash the data with the hash function of its data type.
+ * Without a hash function only the data type and size are hashed,
+ * so all the entries of the data type will be in the same bucket.
+ */
+static uint32_t hash_data(const void * data, size_t data_size, uint32_t data_type)
+{
+    uint32_t h = data_type * 31 + (uint32_t)data_size;
+
+    lv_cache_data_hash_cb_t hash_cb = lv_cache_get_data_hash_cb(data_type);
+    if(hash_cb && data) h = h * 31 + hash_cb(data, data_size);
+
+    return hash_mix(h);
+}
+
+static bool src_match(const lv_cache_entry_t * entry, const void * src, lv_cache_src_type_t src_type)
+{
+    if(entry->src_type != src_type) return false;
+    if(src_type == LV_CACHE_SRC_TYPE_POINTER) return entry->src == src;
+    return lv_strcmp(entry->src, src) == 0;
+}
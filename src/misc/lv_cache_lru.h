@@ -0,0 +1,67 @@
+/**
+ * @file lv_cache_lru.h
+ *
+ */
+
+#ifndef LV_CACHE_LRU_H
+#define LV_CACHE_LRU_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_cache.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct _lv_cache_lru_node_t lv_cache_lru_node_t;
+
+typedef struct {
+    uint32_t cur_size;
+    uint32_t entry_cnt;
+    uint32_t bucket_cnt;                /**< Number of buckets of both hash tables (power of 2)*/
+    lv_cache_lru_node_t ** src_buckets; /**< Entries hashed by `src` and `src_type`*/
+    lv_cache_lru_node_t ** data_buckets;/**< Entries hashed by `data_type`, `data_size` and data*/
+    lv_cache_lru_node_t * lru_head;     /**< The most recently used entry*/
+    lv_cache_lru_node_t * lru_tail;     /**< The least recently used entry*/
+    lv_cache_lru_node_t * pending;      /**< New entries whose `src` is not hashed yet*/
+} lv_cache_lru_dsc_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+void _lv_cache_lru_init(void);
+
+void _lv_cache_lru_deinit(void);
+
+/**
+ * Fill a cache manager with the callbacks of the LRU cache.
+ * The entries are hashed by their source and data so finding, using and dropping them
+ * doesn't depend on the number of cached entries. To find the entries by data this way
+ * set a hash function for their data type with `lv_cache_set_data_hash_cb()`.
+ * If space is needed the least recently used entries are dropped first; `weight` and `life`
+ * of the entries are not used.
+ * Use it as `lv_cache_set_manager(&manager)` after calling this function.
+ * @param manager   pointer to a cache manager to initialize
+ */
+void lv_cache_lru_manager_init(lv_cache_manager_t * manager);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_CACHE_LRU_H*/
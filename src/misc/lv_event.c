@@ -9,6 +9,7 @@
 #include "lv_event.h"
 #include "../core/lv_global.h"
 #include "../stdlib/lv_mem.h"
+#include "../stdlib/lv_string.h"
 #include "lv_assert.h"
 #include <stddef.h>
 
@@ -18,6 +19,9 @@
 
 #define event_head LV_GLOBAL_DEFAULT()->event_header
 #define event_last_id LV_GLOBAL_DEFAULT()->event_last_register_id
+#define event_stats LV_GLOBAL_DEFAULT()->event_stats
+
+#define CODE_BIT(code) ((uint64_t)1 << ((code) & 63))
 
 /**********************
  *      TYPEDEFS
@@ -26,6 +30,8 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static uint64_t filter_to_mask(uint32_t filter);
+static void update_code_mask(lv_event_list_t * list);
 
 /**********************
  *  STATIC VARIABLES
@@ -62,8 +68,19 @@ void _lv_event_pop(lv_event_t * e)
 
 lv_result_t lv_event_send(lv_event_list_t * list, lv_event_t * e, bool preprocess)
 {
+#if LV_USE_EVENT_STATS
+    /*The event is sent twice to each target: first to the preprocess callbacks*/
+    if(!preprocess) {
+        if(e->code < _LV_EVENT_LAST) event_stats.sent_cnt[e->code]++;
+        else event_stats.custom_sent_cnt++;
+    }
+#endif
+
     if(list == NULL) return LV_RESULT_OK;
 
+    /*Quickly skip the events which have no callback*/
+    if((list->code_mask[preprocess ? 1 : 0] & CODE_BIT(e->code)) == 0) return LV_RESULT_OK;
+
     uint32_t i = 0;
     for(i = 0; i < list->cnt; i++) {
         if(list->dsc[i].cb == NULL) continue;
@@ -71,6 +88,10 @@ lv_result_t lv_event_send(lv_event_list_t * list, lv_event_t * e, bool preproces
         if(is_preprocessed != preprocess) continue;
         lv_event_code_t filter = list->dsc[i].filter & ~LV_EVENT_PREPROCESS;
         if(filter == LV_EVENT_ALL || filter == e->code) {
+#if LV_USE_EVENT_STATS
+            if(e->code < _LV_EVENT_LAST) event_stats.handled_cnt[e->code]++;
+            else event_stats.custom_handled_cnt++;
+#endif
             e->user_data = list->dsc[i].user_data;
             list->dsc[i].cb(e);
             if(e->stop_processing) return LV_RESULT_OK;
@@ -86,14 +107,22 @@ lv_result_t lv_event_send(lv_event_list_t * list, lv_event_t * e, bool preproces
 void lv_event_add(lv_event_list_t * list, lv_event_cb_t cb, lv_event_code_t filter,
                   void * user_data)
 {
+    /*Grow the array exponentially to avoid reallocating it on every new callback*/
+    if(list->cnt == list->cap) {
+        uint32_t new_cap = list->cap ? list->cap * 2 : 1;
+        lv_event_dsc_t * new_dsc = lv_realloc(list->dsc, new_cap * sizeof(lv_event_dsc_t));
+        LV_ASSERT_MALLOC(new_dsc);
+        if(new_dsc == NULL) return;
+        list->dsc = new_dsc;
+        list->cap = new_cap;
+    }
+
+    list->dsc[list->cnt].cb = cb;
+    list->dsc[list->cnt].filter = filter;
+    list->dsc[list->cnt].user_data = user_data;
     list->cnt++;
-    list->dsc = lv_realloc(list->dsc, list->cnt * sizeof(lv_event_dsc_t));
-    LV_ASSERT_MALLOC(list->dsc);
-    if(list->dsc == NULL) return;
 
-    list->dsc[list->cnt - 1].cb = cb;
-    list->dsc[list->cnt - 1].filter = filter;
-    list->dsc[list->cnt - 1].user_data = user_data;
+    if(cb) list->code_mask[(filter & LV_EVENT_PREPROCESS) ? 1 : 0] |= filter_to_mask(filter);
 }
 
 uint32_t lv_event_get_count(lv_event_list_t * list)
@@ -133,8 +162,14 @@ bool lv_event_remove(lv_event_list_t * list, uint32_t index)
         list->dsc[i] = list->dsc[i + 1];
     }
     list->cnt--;
-    list->dsc = lv_realloc(list->dsc, list->cnt * sizeof(lv_event_dsc_t));
-    LV_ASSERT_MALLOC(list->dsc);
+
+    /*Keep the allocated space for new callbacks, unless the list became empty*/
+    if(list->cnt == 0) {
+        lv_event_remove_all(list);
+        return true;
+    }
+
+    update_code_mask(list);
     return true;
 }
 
@@ -145,9 +180,26 @@ void lv_event_remove_all(lv_event_list_t * list)
         lv_free(list->dsc);
         list->dsc = NULL;
         list->cnt = 0;
+        list->cap = 0;
+        list->code_mask[0] = 0;
+        list->code_mask[1] = 0;
     }
 }
 
+#if LV_USE_EVENT_STATS
+
+const lv_event_stats_t * lv_event_get_stats(void)
+{
+    return &event_stats;
+}
+
+void lv_event_reset_stats(void)
+{
+    lv_memzero(&event_stats, sizeof(lv_event_stats_t));
+}
+
+#endif /*LV_USE_EVENT_STATS*/
+
 void * lv_event_get_current_target(lv_event_t * e)
 {
     return e->current_target;
@@ -202,3 +254,22 @@ void _lv_event_mark_deleted(void * target)
 /**********************
  *   STATIC FUNCTIONS
  **********************/
+
+static uint64_t filter_to_mask(uint32_t filter)
+{
+    filter &= ~LV_EVENT_PREPROCESS;
+    if(filter == LV_EVENT_ALL) return UINT64_MAX;
+    else return CODE_BIT(filter);
+}
+
+static void update_code_mask(lv_event_list_t * list)
+{
+    list->code_mask[0] = 0;
+    list->code_mask[1] = 0;
+
+    uint32_t i;
+    for(i = 0; i < list->cnt; i++) {
+        uint32_t filter = list->dsc[i].filter;
+        if(list->dsc[i].cb) list->code_mask[(filter & LV_EVENT_PREPROCESS) ? 1 : 0] |= filter_to_mask(filter);
+    }
+}
@@ -116,8 +116,23 @@ typedef enum {
 typedef struct {
     lv_event_dsc_t * dsc;
     uint32_t cnt;
+    uint32_t cap;               /**< Number of allocated descriptors*/
+    uint64_t code_mask[2];      /**< Bit `code % 64` is set if an event callback might handle `code`.
+                                 *   [0]: normal, [1]: preprocess callbacks*/
 } lv_event_list_t;
 
+#if LV_USE_EVENT_STATS
+/**
+ * Number of sent and handled events per event code
+ */
+typedef struct {
+    uint32_t sent_cnt[_LV_EVENT_LAST];      /**< Number of times an event was sent to a target*/
+    uint32_t handled_cnt[_LV_EVENT_LAST];   /**< Number of event callbacks called*/
+    uint32_t custom_sent_cnt;               /**< Same as `sent_cnt` for all the registered event codes*/
+    uint32_t custom_handled_cnt;            /**< Same as `handled_cnt` for all the registered event codes*/
+} lv_event_stats_t;
+#endif
+
 typedef struct _lv_event_t {
     void * current_target;
     void * original_target;
@@ -160,6 +175,22 @@ bool lv_event_remove(lv_event_list_t * list, uint32_t index);
 
 void lv_event_remove_all(lv_event_list_t * list);
 
+#if LV_USE_EVENT_STATS
+
+/**
+ * Get how many times the events were sent and handled since the start or the last reset.
+ * Useful to find which events are sent the most often.
+ * @return      pointer to the statistics
+ */
+const lv_event_stats_t * lv_event_get_stats(void);
+
+/**
+ * Reset the counters of the sent and handled events
+ */
+void lv_event_reset_stats(void);
+
+#endif /*LV_USE_EVENT_STATS*/
+
 /**
  * Get the object originally targeted by the event. It's the same even if the event is bubbled.
  * @param e     pointer to the event descriptor
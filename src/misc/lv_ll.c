@@ -58,7 +58,7 @@ void * _lv_ll_ins_head(lv_ll_t * ll_p)
 {
     lv_ll_node_t * n_new;
 
-    n_new = lv_malloc(ll_p->n_size + LL_NODE_META_SIZE);
+    n_new = lv_malloc_slab(ll_p->n_size + LL_NODE_META_SIZE);
 
     if(n_new != NULL) {
         node_set_prev(ll_p, n_new, NULL);       /*No prev. before the new head*/
@@ -88,7 +88,7 @@ void * _lv_ll_ins_prev(lv_ll_t * ll_p, void * n_act)
         if(n_new == NULL) return NULL;
     }
     else {
-        n_new = lv_malloc(ll_p->n_size + LL_NODE_META_SIZE);
+        n_new = lv_malloc_slab(ll_p->n_size + LL_NODE_META_SIZE);
         if(n_new == NULL) return NULL;
 
         lv_ll_node_t * n_prev;
@@ -106,7 +106,7 @@ void * _lv_ll_ins_tail(lv_ll_t * ll_p)
 {
     lv_ll_node_t * n_new;
 
-    n_new = lv_malloc(ll_p->n_size + LL_NODE_META_SIZE);
+    n_new = lv_malloc_slab(ll_p->n_size + LL_NODE_META_SIZE);
 
     if(n_new != NULL) {
         node_set_next(ll_p, n_new, NULL);       /*No next after the new tail*/
@@ -27,6 +27,7 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static uint32_t find_prop_index(const lv_style_prop_t * props, uint32_t cnt, lv_style_prop_t prop);
 
 /**********************
  *  GLOBAL VARIABLES
@@ -290,43 +291,100 @@ void lv_style_set_prop(lv_style_t * style, lv_style_prop_t prop, lv_style_value_
     LV_ASSERT(prop != LV_STYLE_PROP_INV);
 
     lv_style_prop_t * props;
-    int32_t i;
+    uint32_t cnt = style->prop_cnt;
+    uint32_t idx = 0;
 
     if(style->values_and_props) {
-        props = (lv_style_prop_t *)style->values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
-        for(i = style->prop_cnt - 1; i >= 0; i--) {
-            if(props[i] == prop) {
-                lv_style_value_t * values = (lv_style_value_t *)style->values_and_props;
-                values[i] = value;
-                return;
-            }
+        props = (lv_style_prop_t *)style->values_and_props + cnt * sizeof(lv_style_value_t);
+        idx = find_prop_index(props, cnt, prop);
+        if(idx < cnt && props[idx] == prop) {
+            lv_style_value_t * values = (lv_style_value_t *)style->values_and_props;
+            values[idx] = value;
+            return;
         }
     }
 
-    size_t size = (style->prop_cnt + 1) * (sizeof(lv_style_value_t) + sizeof(lv_style_prop_t));
+    LV_ASSERT(cnt < 254);
+
+    size_t size = (cnt + 1) * (sizeof(lv_style_value_t) + sizeof(lv_style_prop_t));
     uint8_t * values_and_props = lv_realloc(style->values_and_props, size);
     if(values_and_props == NULL) return;
     style->values_and_props = values_and_props;
 
-    props = values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
-    /*Shift all props to make place for the value before them*/
-    for(i = style->prop_cnt - 1; i >= 0; i--) {
-        props[i + sizeof(lv_style_value_t) / sizeof(lv_style_prop_t)] = props[i];
-    }
-    style->prop_cnt++;
+    /*Make place for the new value before the props and for the new prop at `idx`.
+     *Move the props first as the values grow into their place.*/
+    lv_style_prop_t * old_props = values_and_props + cnt * sizeof(lv_style_value_t);
+    props = values_and_props + (cnt + 1) * sizeof(lv_style_value_t);
+    lv_memmove(&props[idx + 1], &old_props[idx], (cnt - idx) * sizeof(lv_style_prop_t));
+    lv_memmove(props, old_props, idx * sizeof(lv_style_prop_t));
 
-    /*Go to the new position with the props*/
-    props = values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
     lv_style_value_t * values = (lv_style_value_t *)values_and_props;
+    lv_memmove(&values[idx + 1], &values[idx], (cnt - idx) * sizeof(lv_style_value_t));
 
-    /*Set the new property and value*/
-    props[style->prop_cnt - 1] = prop;
-    values[style->prop_cnt - 1] = value;
+    props[idx] = prop;
+    values[idx] = value;
+    style->prop_cnt++;
 
     uint32_t group = _lv_style_get_prop_group(prop);
     style->has_group |= (uint32_t)1 << group;
 }
 
+void lv_style_set_props(lv_style_t * style, const lv_style_prop_t props[], const lv_style_value_t values[],
+                        uint32_t cnt)
+{
+    LV_ASSERT_STYLE(style);
+
+    if(lv_style_is_const(style)) {
+        LV_LOG_ERROR("Cannot set property of constant style");
+        return;
+    }
+
+    if(cnt == 0) return;
+
+    uint32_t old_cnt = style->prop_cnt;
+    uint32_t cap = LV_MIN(old_cnt + cnt, 254);
+
+    /*Build the new property list in a buffer large enough for all the properties,
+     *having the props at the end of the buffer while building*/
+    uint8_t * buf = lv_malloc(cap * (sizeof(lv_style_value_t) + sizeof(lv_style_prop_t)));
+    LV_ASSERT_MALLOC(buf);
+    if(buf == NULL) return;
+
+    lv_style_value_t * new_values = (lv_style_value_t *)buf;
+    lv_style_prop_t * new_props = buf + cap * sizeof(lv_style_value_t);
+    if(old_cnt) {
+        lv_memcpy(new_values, style->values_and_props, old_cnt * sizeof(lv_style_value_t));
+        lv_memcpy(new_props, (lv_style_prop_t *)style->values_and_props + old_cnt * sizeof(lv_style_value_t),
+                  old_cnt * sizeof(lv_style_prop_t));
+    }
+
+    uint32_t new_cnt = old_cnt;
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        LV_ASSERT(props[i] != LV_STYLE_PROP_INV);
+
+        uint32_t idx = find_prop_index(new_props, new_cnt, props[i]);
+        if(idx >= new_cnt || new_props[idx] != props[i]) {
+            if(new_cnt == cap) break;
+            lv_memmove(&new_props[idx + 1], &new_props[idx], (new_cnt - idx) * sizeof(lv_style_prop_t));
+            lv_memmove(&new_values[idx + 1], &new_values[idx], (new_cnt - idx) * sizeof(lv_style_value_t));
+            new_props[idx] = props[i];
+            new_cnt++;
+            style->has_group |= (uint32_t)1 << _lv_style_get_prop_group(props[i]);
+        }
+        new_values[idx] = values[i];
+    }
+
+    /*Move the props right after the values*/
+    if(new_cnt < cap) {
+        lv_memmove(buf + new_cnt * sizeof(lv_style_value_t), new_props, new_cnt * sizeof(lv_style_prop_t));
+    }
+
+    lv_free(style->values_and_props);
+    style->values_and_props = buf;
+    style->prop_cnt = new_cnt;
+}
+
 lv_style_res_t lv_style_get_prop(const lv_style_t * style, lv_style_prop_t prop, lv_style_value_t * value)
 {
     return lv_style_get_prop_inlined(style, prop, value);
@@ -430,3 +488,22 @@ uint8_t _lv_style_prop_lookup_flags(lv_style_prop_t prop)
 /**********************
  *   STATIC FUNCTIONS
  **********************/
+
+/**
+ * Find a property in the sorted property list of a style
+ * @param props     the sorted properties
+ * @param cnt       number of properties
+ * @param prop      the property to find
+ * @return          index of `prop` if found, else the index where it should be inserted
+ */
+static uint32_t find_prop_index(const lv_style_prop_t * props, uint32_t cnt, lv_style_prop_t prop)
+{
+    uint32_t lo = 0;
+    uint32_t hi = cnt;
+    while(lo < hi) {
+        uint32_t mid = (lo + hi) >> 1;
+        if(props[mid] < prop) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
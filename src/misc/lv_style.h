@@ -372,7 +372,8 @@ typedef struct {
     uint32_t sentinel;
 #endif
 
-    void * values_and_props;
+    void * values_and_props;    /**< The values followed by the props sorted by their ID.
+                                 *   For constant styles an `lv_style_const_prop_t` array.*/
 
     uint32_t has_group;
     uint8_t prop_cnt;   /**< 255 means it's a constant style*/
@@ -446,6 +447,21 @@ bool lv_style_remove_prop(lv_style_t * style, lv_style_prop_t prop);
  */
 void lv_style_set_prop(lv_style_t * style, lv_style_prop_t prop, lv_style_value_t value);
 
+/**
+ * Set the values of more properties in a style at once.
+ * It allocates memory only once so it's faster than calling `lv_style_set_prop()` for each property.
+ * @param style     pointer to style
+ * @param props     array of property IDs (e.g. `LV_STYLE_BG_COLOR`). If a property is repeated the last value is used.
+ * @param values    array of values with the same length as `props`
+ * @param cnt       number of elements in `props` and `values`
+ * @example
+ * static const lv_style_prop_t props[] = {LV_STYLE_RADIUS, LV_STYLE_PAD_TOP, LV_STYLE_BG_OPA};
+ * lv_style_value_t values[] = {{.num = 10}, {.num = 5}, {.num = LV_OPA_COVER}};
+ * lv_style_set_props(&style, props, values, 3);
+ */
+void lv_style_set_props(lv_style_t * style, const lv_style_prop_t props[], const lv_style_value_t values[],
+                        uint32_t cnt);
+
 /**
  * Get the value of a property
  * @param style pointer to a style
@@ -504,14 +520,19 @@ static inline lv_style_res_t lv_style_get_prop_inlined(const lv_style_t * style,
         }
     }
     else {
+        /*The properties are sorted so use binary search*/
         lv_style_prop_t * props = (lv_style_prop_t *)style->values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
-        uint32_t i;
-        for(i = 0; i < style->prop_cnt; i++) {
-            if(props[i] == prop) {
+        uint32_t lo = 0;
+        uint32_t hi = style->prop_cnt;
+        while(lo < hi) {
+            uint32_t mid = (lo + hi) >> 1;
+            if(props[mid] == prop) {
                 lv_style_value_t * values = (lv_style_value_t *)style->values_and_props;
-                *value = values[i];
+                *value = values[mid];
                 return LV_STYLE_RES_FOUND;
             }
+            if(props[mid] < prop) lo = mid + 1;
+            else hi = mid;
         }
     }
     return LV_STYLE_RES_NOT_FOUND;
@@ -24,6 +24,10 @@
 #define state LV_GLOBAL_DEFAULT()->timer_state
 #define timer_ll_p &(state.timer_ll)
 
+/*Values of `heap_index` for the timers which are not in the heap*/
+#define HEAP_INDEX_NONE     UINT32_MAX
+#define HEAP_INDEX_READY    0x80000000  /*OR-ed with the index in `state.ready`*/
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -31,9 +35,16 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
-static bool lv_timer_exec(lv_timer_t * timer);
+static void lv_timer_exec(uint32_t ready_index);
 static uint32_t lv_timer_time_remaining(lv_timer_t * timer);
 static void lv_timer_handler_resume(void);
+static bool timer_is_earlier(lv_timer_t * t1, lv_timer_t * t2);
+static void heap_insert(lv_timer_t * timer);
+static void heap_remove(lv_timer_t * timer);
+static void heap_update(lv_timer_t * timer);
+static void heap_sift_up(uint32_t i);
+static void heap_sift_down(uint32_t i);
+static bool grow_array(lv_timer_t *** array, uint32_t * size, uint32_t cnt);
 
 /**********************
  *  STATIC VARIABLES
@@ -88,43 +99,37 @@ LV_ATTRIBUTE_TIMER_HANDLER uint32_t lv_timer_handler(void)
         }
     }
 
-    /*Run all timer from the list*/
-    lv_timer_t * next;
-    lv_timer_t * timer_active;
-    lv_ll_t * timer_head = timer_ll_p;
-    do {
-        state_p->timer_deleted             = false;
-        state_p->timer_created             = false;
-
-        timer_active = _lv_ll_get_head(timer_head);
-        while(timer_active) {
-            /*The timer might be deleted if it runs only once ('repeat_count = 1')
-             *So get next element until the current is surely valid*/
-            next = _lv_ll_get_next(timer_head, timer_active);
-
-            if(lv_timer_exec(timer_active)) {
-                /*If a timer was created or deleted then this or the next item might be corrupted*/
-                if(state_p->timer_created || state_p->timer_deleted) {
-                    LV_TRACE_TIMER("Start from the first timer again because a timer was created or deleted");
-                    break;
-                }
-            }
-
-            timer_active = next; /*Load the next timer*/
-        }
-    } while(timer_active);
+    /*Take the ready timers from the top of the heap in the order of their scheduled time.
+     *Only these timers and the already due timers created by their callbacks run in this call.*/
+    state_p->ready_cnt = 0;
+    while(state_p->heap_cnt && lv_timer_time_remaining(state_p->heap[0]) == 0) {
+        if(!grow_array(&state_p->ready, &state_p->ready_size, state_p->ready_cnt + 1)) break;
+
+        lv_timer_t * timer = state_p->heap[0];
+        heap_remove(timer);
+        timer->heap_index = HEAP_INDEX_READY | state_p->ready_cnt;
+        state_p->ready[state_p->ready_cnt] = timer;
+        state_p->ready_cnt++;
+    }
 
-    uint32_t time_until_next = LV_NO_TIMER_READY;
-    next = _lv_ll_get_head(timer_head);
-    while(next) {
-        if(!next->paused) {
-            uint32_t delay = lv_timer_time_remaining(next);
-            if(delay < time_until_next)
-                time_until_next = delay;
-        }
+    uint32_t i;
+    for(i = 0; i < state_p->ready_cnt; i++) {
+        /*The timer was deleted by an other timer*/
+        if(state_p->ready[i] == NULL) continue;
+
+        lv_timer_exec(i);
 
-        next = _lv_ll_get_next(timer_head, next); /*Find the next timer*/
+        /*Put the timer back to the heap with its new schedule if it wasn't deleted or paused*/
+        lv_timer_t * timer = state_p->ready[i];
+        if(timer) {
+            timer->heap_index = HEAP_INDEX_NONE;
+            if(!timer->paused) heap_insert(timer);
+        }
     }
+    state_p->ready_cnt = 0;
+
+    uint32_t time_until_next = LV_NO_TIMER_READY;
+    if(state_p->heap_cnt) time_until_next = lv_timer_time_remaining(state_p->heap[0]);
 
     state_p->busy_time += lv_tick_elaps(handler_start);
     uint32_t idle_period_time = lv_tick_elaps(state_p->idle_period_start);
@@ -173,8 +178,20 @@ lv_timer_t * lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void * us
     new_timer->last_run = lv_tick_get();
     new_timer->user_data = user_data;
     new_timer->auto_delete = true;
-
-    state.timer_created = true;
+    new_timer->heap_index = HEAP_INDEX_NONE;
+    new_timer->create_id = state.create_id_next;
+    state.create_id_next++;
+
+    /*If created by a timer callback and already due, run it in this `lv_timer_handler()` call too*/
+    if(state.already_running && lv_timer_time_remaining(new_timer) == 0 &&
+       grow_array(&state.ready, &state.ready_size, state.ready_cnt + 1)) {
+        new_timer->heap_index = HEAP_INDEX_READY | state.ready_cnt;
+        state.ready[state.ready_cnt] = new_timer;
+        state.ready_cnt++;
+    }
+    else {
+        heap_insert(new_timer);
+    }
 
     lv_timer_handler_resume();
 
@@ -189,8 +206,15 @@ void lv_timer_set_cb(lv_timer_t * timer, lv_timer_cb_t timer_cb)
 
 void lv_timer_delete(lv_timer_t * timer)
 {
+    if(timer->heap_index & HEAP_INDEX_READY) {
+        /*It's either waiting to run in `lv_timer_handler()` or is running now*/
+        if(timer->heap_index != HEAP_INDEX_NONE) state.ready[timer->heap_index & ~HEAP_INDEX_READY] = NULL;
+    }
+    else {
+        heap_remove(timer);
+    }
+
     _lv_ll_remove(timer_ll_p, timer);
-    state.timer_deleted = true;
 
     lv_free(timer);
 }
@@ -199,12 +223,14 @@ void lv_timer_pause(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->paused = true;
+    if((timer->heap_index & HEAP_INDEX_READY) == 0) heap_remove(timer);
 }
 
 void lv_timer_resume(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->paused = false;
+    if(timer->heap_index == HEAP_INDEX_NONE) heap_insert(timer);
     lv_timer_handler_resume();
 }
 
@@ -212,18 +238,23 @@ void lv_timer_set_period(lv_timer_t * timer, uint32_t period)
 {
     LV_ASSERT_NULL(timer);
     timer->period = period;
+    heap_update(timer);
 }
 
 void lv_timer_ready(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->last_run = lv_tick_get() - timer->period - 1;
+    heap_update(timer);
 }
 
 void lv_timer_set_repeat_count(lv_timer_t * timer, int32_t repeat_count)
 {
     LV_ASSERT_NULL(timer);
     timer->repeat_count = repeat_count;
+
+    /*Let `lv_timer_handler()` delete or pause it on the next call (the callback won't be called)*/
+    if(repeat_count == 0) lv_timer_ready(timer);
 }
 
 void lv_timer_set_auto_delete(lv_timer_t * timer, bool auto_delete)
@@ -242,6 +273,7 @@ void lv_timer_reset(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->last_run = lv_tick_get();
+    heap_update(timer);
     lv_timer_handler_resume();
 }
 
@@ -256,6 +288,15 @@ void _lv_timer_core_deinit(void)
     lv_timer_enable(false);
 
     _lv_ll_clear(timer_ll_p);
+
+    lv_free(state.heap);
+    state.heap = NULL;
+    state.heap_cnt = 0;
+    state.heap_size = 0;
+    lv_free(state.ready);
+    state.ready = NULL;
+    state.ready_cnt = 0;
+    state.ready_size = 0;
 }
 
 uint8_t lv_timer_get_idle(void)
@@ -279,51 +320,47 @@ lv_timer_t * lv_timer_get_next(lv_timer_t * timer)
  **********************/
 
 /**
- * Execute timer if its remaining time is zero
- * @param timer pointer to lv_timer
- * @return true: execute, false: not executed
+ * Execute a timer taken from the heap if it's still ready
+ * @param ready_index   index of the timer in `state.ready`
  */
-static bool lv_timer_exec(lv_timer_t * timer)
+static void lv_timer_exec(uint32_t ready_index)
 {
-    if(timer->paused) return false;
-
-    bool exec = false;
-    if(lv_timer_time_remaining(timer) == 0) {
-        /* Decrement the repeat count before executing the timer_cb.
-         * If any timer is deleted `if(timer->repeat_count == 0)` is not executed below
-         * but at least the repeat count is zero and the timer can be deleted in the next round*/
-        int32_t original_repeat_count = timer->repeat_count;
-        if(timer->repeat_count > 0) timer->repeat_count--;
-        timer->last_run = lv_tick_get();
-        LV_TRACE_TIMER("calling timer callback: %p", *((void **)&timer->timer_cb));
-
-        if(timer->timer_cb && original_repeat_count != 0) timer->timer_cb(timer);
-
-        if(!state.timer_deleted) {
-            LV_TRACE_TIMER("timer callback %p finished", *((void **)&timer->timer_cb));
-        }
-        else {
-            LV_TRACE_TIMER("timer callback finished");
-        }
+    lv_timer_t * timer = state.ready[ready_index];
+
+    /*An other timer might have paused or reset this timer*/
+    if(timer->paused) return;
+    if(lv_timer_time_remaining(timer) != 0) return;
+
+    /* Decrement the repeat count before executing the timer_cb.
+     * If the timer is deleted by its callback `if(timer->repeat_count == 0)` is not executed below
+     * but at least the repeat count is zero and the timer can be deleted in the next round*/
+    int32_t original_repeat_count = timer->repeat_count;
+    if(timer->repeat_count > 0) timer->repeat_count--;
+    timer->last_run = lv_tick_get();
+    LV_TRACE_TIMER("calling timer callback: %p", *((void **)&timer->timer_cb));
 
-        LV_ASSERT_MEM_INTEGRITY();
-        exec = true;
+    if(timer->timer_cb && original_repeat_count != 0) timer->timer_cb(timer);
+
+    LV_ASSERT_MEM_INTEGRITY();
+
+    /*The timer might be deleted by itself*/
+    if(state.ready[ready_index] == NULL) {
+        LV_TRACE_TIMER("timer callback finished");
+        return;
     }
 
-    if(state.timer_deleted == false) { /*The timer might be deleted by itself as well*/
-        if(timer->repeat_count == 0) { /*The repeat count is over, delete the timer*/
-            if(timer->auto_delete) {
-                LV_TRACE_TIMER("deleting timer with %p callback because the repeat count is over", *((void **)&timer->timer_cb));
-                lv_timer_delete(timer);
-            }
-            else {
-                LV_TRACE_TIMER("pausing timer with %p callback because the repeat count is over", *((void **)&timer->timer_cb));
-                lv_timer_pause(timer);
-            }
+    LV_TRACE_TIMER("timer callback %p finished", *((void **)&timer->timer_cb));
+
+    if(timer->repeat_count == 0) { /*The repeat count is over, delete the timer*/
+        if(timer->auto_delete) {
+            LV_TRACE_TIMER("deleting timer with %p callback because the repeat count is over", *((void **)&timer->timer_cb));
+            lv_timer_delete(timer);
+        }
+        else {
+            LV_TRACE_TIMER("pausing timer with %p callback because the repeat count is over", *((void **)&timer->timer_cb));
+            lv_timer_pause(timer);
         }
     }
-
-    return exec;
 }
 
 /**
@@ -357,3 +394,107 @@ void lv_timer_handler_set_resume_cb(lv_timer_handler_resume_cb_t cb, void * data
     state.resume_cb = cb;
     state.resume_data = data;
 }
+
+/**
+ * Tell if a timer should run before an other.
+ * Compare the times remaining from the current tick on 64 bit to handle the overflow of the tick,
+ * long periods and timers which are overdue for long.
+ * If they are due at the same time the newer timer runs first, like in the order of the timer list.
+ */
+static bool timer_is_earlier(lv_timer_t * t1, lv_timer_t * t2)
+{
+    uint32_t now = lv_tick_get();
+    int64_t remaining1 = (int64_t)t1->period - (uint32_t)(now - t1->last_run);
+    int64_t remaining2 = (int64_t)t2->period - (uint32_t)(now - t2->last_run);
+    if(remaining1 != remaining2) return remaining1 < remaining2;
+    return (int32_t)(t1->create_id - t2->create_id) > 0;
+}
+
+static void heap_insert(lv_timer_t * timer)
+{
+    if(!grow_array(&state.heap, &state.heap_size, state.heap_cnt + 1)) return;
+
+    state.heap[state.heap_cnt] = timer;
+    timer->heap_index = state.heap_cnt;
+    state.heap_cnt++;
+    heap_sift_up(timer->heap_index);
+}
+
+static void heap_remove(lv_timer_t * timer)
+{
+    uint32_t i = timer->heap_index;
+    if(i >= state.heap_cnt) return;
+
+    timer->heap_index = HEAP_INDEX_NONE;
+    state.heap_cnt--;
+    if(i == state.heap_cnt) return;
+
+    /*Move the last timer into the hole and restore the order*/
+    state.heap[i] = state.heap[state.heap_cnt];
+    state.heap[i]->heap_index = i;
+    heap_sift_up(i);
+    heap_sift_down(state.heap[i]->heap_index);
+}
+
+/**
+ * Restore the order of the heap after the scheduled time of a timer has changed
+ */
+static void heap_update(lv_timer_t * timer)
+{
+    uint32_t i = timer->heap_index;
+    if(i >= state.heap_cnt) return;
+
+    heap_sift_up(i);
+    heap_sift_down(timer->heap_index);
+}
+
+static void heap_sift_up(uint32_t i)
+{
+    lv_timer_t ** heap = state.heap;
+    lv_timer_t * timer = heap[i];
+    while(i > 0) {
+        uint32_t parent = (i - 1) / 2;
+        if(!timer_is_earlier(timer, heap[parent])) break;
+        heap[i] = heap[parent];
+        heap[i]->heap_index = i;
+        i = parent;
+    }
+    heap[i] = timer;
+    timer->heap_index = i;
+}
+
+static void heap_sift_down(uint32_t i)
+{
+    lv_timer_t ** heap = state.heap;
+    uint32_t cnt = state.heap_cnt;
+    lv_timer_t * timer = heap[i];
+    while(1) {
+        uint32_t child = 2 * i + 1;
+        if(child >= cnt) break;
+        if(child + 1 < cnt && timer_is_earlier(heap[child + 1], heap[child])) child++;
+        if(!timer_is_earlier(heap[child], timer)) break;
+        heap[i] = heap[child];
+        heap[i]->heap_index = i;
+        i = child;
+    }
+    heap[i] = timer;
+    timer->heap_index = i;
+}
+
+/**
+ * Make sure an array of timers has place for `cnt` elements. Double its size if not.
+ * @return false if the memory couldn't be allocated
+ */
+static bool grow_array(lv_timer_t *** array, uint32_t * size, uint32_t cnt)
+{
+    if(cnt <= *size) return true;
+
+    uint32_t new_size = *size ? *size * 2 : 8;
+    lv_timer_t ** new_array = lv_realloc(*array, new_size * sizeof(lv_timer_t *));
+    LV_ASSERT_MALLOC(new_array);
+    if(new_array == NULL) return false;
+
+    *array = new_array;
+    *size = new_size;
+    return true;
+}
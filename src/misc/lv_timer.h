@@ -53,6 +53,8 @@ typedef struct _lv_timer_t {
     lv_timer_cb_t timer_cb; /**< Timer function*/
     void * user_data; /**< Custom user data*/
     int32_t repeat_count; /**< 1: One time;  -1 : infinity;  n>0: residual times*/
+    uint32_t heap_index; /**< Position in the heap of the waiting timers (internal)*/
+    uint32_t create_id; /**< Creation order. Newer timers run first if they are due at the same time (internal)*/
     uint32_t paused : 1;
     uint32_t auto_delete : 1;
 } lv_timer_t;
@@ -60,10 +62,19 @@ typedef struct _lv_timer_t {
 typedef struct {
     lv_ll_t timer_ll; /*Linked list to store the lv_timers*/
 
+    /*Min-heap of the not paused timers ordered by the time of their next run*/
+    lv_timer_t ** heap;
+    uint32_t heap_cnt;
+    uint32_t heap_size;
+    uint32_t create_id_next;
+
+    /*The timers to run in the current `lv_timer_handler()` call*/
+    lv_timer_t ** ready;
+    uint32_t ready_cnt;
+    uint32_t ready_size;
+
     bool lv_timer_run;
     uint8_t idle_last;
-    bool timer_deleted;
-    bool timer_created;
     uint32_t timer_time_until_next;
 
     bool already_running;
@@ -6,6 +6,7 @@
  *      INCLUDES
  *********************/
 #include "lv_mem.h"
+#include "lv_mem_slab.h"
 #include "lv_string.h"
 #include "../misc/lv_assert.h"
 #include "../misc/lv_log.h"
@@ -116,12 +117,47 @@ void * lv_malloc_zeroed(size_t size)
     return alloc;
 }
 
+void * lv_malloc_slab(size_t size)
+{
+#if LV_USE_MEM_SLAB
+    void * alloc = _lv_mem_slab_alloc(size);
+    if(alloc) {
+#if LV_MEM_ADD_JUNK
+        lv_memset(alloc, 0xaa, size);
+#endif
+        LV_TRACE_MEM("allocated %lu bytes from slab at %p", (unsigned long)size, alloc);
+        return alloc;
+    }
+#endif
+
+    /*Too large or slab is disabled*/
+    return lv_malloc(size);
+}
+
+void * lv_malloc_slab_zeroed(size_t size)
+{
+#if LV_USE_MEM_SLAB
+    void * alloc = _lv_mem_slab_alloc(size);
+    if(alloc) {
+        lv_memzero(alloc, size);
+        LV_TRACE_MEM("allocated %lu bytes from slab at %p", (unsigned long)size, alloc);
+        return alloc;
+    }
+#endif
+
+    return lv_malloc_zeroed(size);
+}
+
 void lv_free(void * data)
 {
     LV_TRACE_MEM("freeing %p", data);
     if(data == &zero_mem) return;
     if(data == NULL) return;
 
+#if LV_USE_MEM_SLAB
+    if(_lv_mem_slab_free(data)) return;
+#endif
+
     lv_free_core(data);
 }
 
@@ -136,6 +172,20 @@ void * lv_realloc(void * data_p, size_t new_size)
 
     if(data_p == &zero_mem) return lv_malloc(new_size);
 
+#if LV_USE_MEM_SLAB
+    /*Keep the block if it's large enough, else move the data to the heap*/
+    size_t slab_size = _lv_mem_slab_get_size(data_p);
+    if(slab_size) {
+        if(new_size <= slab_size) return data_p;
+
+        void * new_slab_p = lv_malloc(new_size);
+        if(new_slab_p == NULL) return NULL;
+        lv_memcpy(new_slab_p, data_p, slab_size);
+        lv_free(data_p);
+        return new_slab_p;
+    }
+#endif
+
     void * new_p = lv_realloc_core(data_p, new_size);
 
     if(new_p == NULL) {
@@ -161,6 +211,9 @@ void lv_mem_monitor(lv_mem_monitor_t * mon_p)
 {
     lv_memzero(mon_p, sizeof(lv_mem_monitor_t));
     lv_mem_monitor_core(mon_p);
+#if LV_USE_MEM_SLAB
+    _lv_mem_slab_monitor(mon_p);
+#endif
 }
 
 /**********************
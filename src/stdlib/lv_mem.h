@@ -25,12 +25,26 @@ extern "C" {
  *      DEFINES
  *********************/
 
+/** Number of size classes of the slab allocator. The largest block is 256 bytes.*/
+#define LV_MEM_SLAB_CLASS_CNT 8
+
 /**********************
  *      TYPEDEFS
  **********************/
 
 typedef void * lv_mem_pool_t;
 
+/**
+ * Statistics of a size class of the slab allocator
+ */
+typedef struct {
+    uint32_t block_size;    /**< Size of the blocks of the class*/
+    uint32_t page_cnt;      /**< Number of pages allocated for the class*/
+    uint32_t used_cnt;      /**< Number of blocks in use*/
+    uint32_t free_cnt;      /**< Number of free blocks in the allocated pages*/
+    uint32_t alloc_cnt;     /**< Number of blocks allocated since `lv_init()`*/
+} lv_mem_slab_monitor_t;
+
 /**
  * Heap information structure.
  */
@@ -43,6 +57,9 @@ typedef struct {
     uint32_t max_used; /**< Max size of Heap memory used*/
     uint8_t used_pct; /**< Percentage used*/
     uint8_t frag_pct; /**< Amount of fragmentation*/
+#if LV_USE_MEM_SLAB
+    lv_mem_slab_monitor_t slab[LV_MEM_SLAB_CLASS_CNT]; /**< Statistics of the size classes of the slab allocator*/
+#endif
 } lv_mem_monitor_t;
 
 /**********************
@@ -77,6 +94,23 @@ void * lv_malloc(size_t size);
  */
 void * lv_malloc_zeroed(size_t size);
 
+/**
+ * Allocate memory for a small object which is allocated and freed frequently (e.g. draw tasks, linked list nodes).
+ * If `LV_USE_MEM_SLAB` is enabled it's served from the pages of the size classes,
+ * else (or if `size` is too large) it's the same as `lv_malloc()`.
+ * @param size requested size in bytes
+ * @return pointer to allocated uninitialized memory, or NULL on failure. Free it with `lv_free()`.
+ */
+void * lv_malloc_slab(size_t size);
+
+/**
+ * Allocate zeroed memory for a small object which is allocated and freed frequently.
+ * @param size requested size in bytes
+ * @return pointer to allocated zeroed memory, or NULL on failure. Free it with `lv_free()`.
+ * @see lv_malloc_slab
+ */
+void * lv_malloc_slab_zeroed(size_t size);
+
 /**
  * Free an allocated data
  * @param data pointer to an allocated memory
@@ -0,0 +1,322 @@
+/**
+ * @file lv_mem_slab.c
+ * Size class allocator for the small objects which are allocated and freed frequently.
+ * Each class has pages of `LV_MEM_SLAB_PAGE_SIZE` bytes split into equal blocks.
+ * A page is allocated when the class has no free block. When all of its blocks are freed the page is freed too,
+ * but one empty page is kept per class to not allocate and free the same page in every frame.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_mem_slab.h"
+#if LV_USE_MEM_SLAB
+
+#include "lv_string.h"
+#include "../misc/lv_assert.h"
+#include "../misc/lv_log.h"
+#include "../core/lv_global.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define state LV_GLOBAL_DEFAULT()->mem_slab_state
+
+/*Keep the blocks aligned to 16 bytes in the page*/
+#define PAGE_HEADER_SIZE    ((sizeof(lv_mem_slab_page_t) + 15) & ~(size_t)15)
+
+#if LV_MEM_SLAB_PAGE_SIZE < 512
+    #error "LV_MEM_SLAB_PAGE_SIZE should be at least 512"
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct _lv_mem_slab_page_t {
+    struct _lv_mem_slab_page_t * prev;  /*In the list of the partial pages of the class*/
+    struct _lv_mem_slab_page_t * next;
+    void * free_head;                   /*The free blocks are linked through their first word*/
+    uint16_t class_idx;
+    uint16_t used_cnt;
+    uint16_t block_cnt;
+} lv_mem_slab_page_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static int32_t get_class_index(size_t size);
+static lv_mem_slab_page_t * page_create(uint32_t class_idx);
+static void page_delete(lv_mem_slab_page_t * page);
+static lv_mem_slab_page_t * page_find(const void * p);
+static uint32_t page_array_find(const void * p);
+static void partial_add(lv_mem_slab_class_t * cls, lv_mem_slab_page_t * page);
+static void partial_remove(lv_mem_slab_class_t * cls, lv_mem_slab_page_t * page);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static const uint16_t class_block_sizes[LV_MEM_SLAB_CLASS_CNT] = {16, 32, 48, 64, 96, 128, 192, 256};
+
+/**********************
+ *      MACROS
+ **********************/
+#if LV_USE_OS
+    #define slab_lock()     lv_mutex_lock(&state.mutex)
+    #define slab_unlock()   lv_mutex_unlock(&state.mutex)
+#else
+    #define slab_lock()     do {} while(0)
+    #define slab_unlock()   do {} while(0)
+#endif
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void _lv_mem_slab_init(void)
+{
+    lv_memzero(&state, sizeof(state));
+#if LV_USE_OS
+    lv_mutex_init(&state.mutex);
+#endif
+}
+
+void _lv_mem_slab_deinit(void)
+{
+    /*The built-in heap was already dropped as a whole by `lv_mem_deinit()`*/
+#if LV_USE_STDLIB_MALLOC != LV_STDLIB_BUILTIN
+    uint32_t i;
+    for(i = 0; i < state.page_cnt; i++) {
+        lv_free_core(state.pages[i]);
+    }
+    lv_free_core(state.pages);
+#endif
+
+#if LV_USE_OS
+    lv_mutex_delete(&state.mutex);
+#endif
+
+    lv_memzero(&state, sizeof(state));
+}
+
+void * _lv_mem_slab_alloc(size_t size)
+{
+    int32_t class_idx = get_class_index(size);
+    if(class_idx < 0) return NULL;
+
+    slab_lock();
+
+    lv_mem_slab_class_t * cls = &state.classes[class_idx];
+    lv_mem_slab_page_t * page = cls->partial;
+    if(page == NULL) {
+        page = page_create(class_idx);
+        if(page == NULL) {
+            slab_unlock();
+            return NULL;
+        }
+        partial_add(cls, page);
+    }
+
+    if(page == cls->empty) cls->empty = NULL;
+
+    void * p = page->free_head;
+    page->free_head = *(void **)p;
+    page->used_cnt++;
+    if(page->used_cnt == page->block_cnt) partial_remove(cls, page);
+
+    cls->used_cnt++;
+    cls->alloc_cnt++;
+
+    slab_unlock();
+    return p;
+}
+
+bool _lv_mem_slab_free(void * p)
+{
+    slab_lock();
+
+    lv_mem_slab_page_t * page = page_find(p);
+    if(page == NULL) {
+        slab_unlock();
+        return false;
+    }
+
+    lv_mem_slab_class_t * cls = &state.classes[page->class_idx];
+    LV_ASSERT(((uint8_t *)p - ((uint8_t *)page + PAGE_HEADER_SIZE)) % class_block_sizes[page->class_idx] == 0);
+
+    /*The page was full so now it has a free block again*/
+    if(page->used_cnt == page->block_cnt) partial_add(cls, page);
+
+    *(void **)p = page->free_head;
+    page->free_head = p;
+    page->used_cnt--;
+    cls->used_cnt--;
+
+    /*Keep one empty page for the next allocations and give back the others
+     *to the heap to not keep memory for the peaks*/
+    if(page->used_cnt == 0) {
+        if(cls->empty == NULL) {
+            cls->empty = page;
+        }
+        else {
+            partial_remove(cls, page);
+            page_delete(page);
+        }
+    }
+
+    slab_unlock();
+    return true;
+}
+
+size_t _lv_mem_slab_get_size(const void * p)
+{
+    slab_lock();
+    lv_mem_slab_page_t * page = page_find(p);
+    size_t size = page ? class_block_sizes[page->class_idx] : 0;
+    slab_unlock();
+
+    return size;
+}
+
+void _lv_mem_slab_monitor(lv_mem_monitor_t * mon_p)
+{
+    slab_lock();
+    uint32_t i;
+    for(i = 0; i < LV_MEM_SLAB_CLASS_CNT; i++) {
+        lv_mem_slab_class_t * cls = &state.classes[i];
+        uint32_t block_size = class_block_sizes[i];
+        lv_mem_slab_monitor_t * slab_mon = &mon_p->slab[i];
+        slab_mon->block_size = block_size;
+        slab_mon->page_cnt = cls->page_cnt;
+        slab_mon->used_cnt = cls->used_cnt;
+        slab_mon->free_cnt = cls->page_cnt * ((LV_MEM_SLAB_PAGE_SIZE - PAGE_HEADER_SIZE) / block_size) - cls->used_cnt;
+        slab_mon->alloc_cnt = cls->alloc_cnt;
+    }
+    slab_unlock();
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static int32_t get_class_index(size_t size)
+{
+    if(size == 0) return -1;
+
+    int32_t i;
+    for(i = 0; i < LV_MEM_SLAB_CLASS_CNT; i++) {
+        if(size <= class_block_sizes[i]) return i;
+    }
+
+    return -1;
+}
+
+static lv_mem_slab_page_t * page_create(uint32_t class_idx)
+{
+    /*Make place for the page in the sorted page array first*/
+    if(state.page_cnt == state.page_array_size) {
+        uint32_t new_size = state.page_array_size ? state.page_array_size * 2 : 16;
+        lv_mem_slab_page_t ** new_pages = lv_realloc_core(state.pages, new_size * sizeof(lv_mem_slab_page_t *));
+        if(new_pages == NULL) return NULL;
+        state.pages = new_pages;
+        state.page_array_size = new_size;
+    }
+
+    lv_mem_slab_page_t * page = lv_malloc_core(LV_MEM_SLAB_PAGE_SIZE);
+    if(page == NULL) return NULL;
+
+    uint32_t block_size = class_block_sizes[class_idx];
+    page->prev = NULL;
+    page->next = NULL;
+    page->class_idx = class_idx;
+    page->used_cnt = 0;
+    page->block_cnt = (LV_MEM_SLAB_PAGE_SIZE - PAGE_HEADER_SIZE) / block_size;
+
+    /*Link all blocks into the free list in address order*/
+    uint8_t * block = (uint8_t *)page + PAGE_HEADER_SIZE;
+    page->free_head = block;
+    uint32_t i;
+    for(i = 0; i < page->block_cnt - 1u; i++) {
+        *(void **)block = block + block_size;
+        block += block_size;
+    }
+    *(void **)block = NULL;
+
+    uint32_t idx = page_array_find(page);
+    lv_memmove(&state.pages[idx + 1], &state.pages[idx], (state.page_cnt - idx) * sizeof(lv_mem_slab_page_t *));
+    state.pages[idx] = page;
+    state.page_cnt++;
+    state.classes[class_idx].page_cnt++;
+
+    return page;
+}
+
+static void page_delete(lv_mem_slab_page_t * page)
+{
+    /*`page_array_find` gives the index after the page*/
+    uint32_t idx = page_array_find(page) - 1;
+    LV_ASSERT(state.pages[idx] == page);
+
+    state.page_cnt--;
+    lv_memmove(&state.pages[idx], &state.pages[idx + 1], (state.page_cnt - idx) * sizeof(lv_mem_slab_page_t *));
+    state.classes[page->class_idx].page_cnt--;
+
+    lv_free_core(page);
+}
+
+/**
+ * Find the page which contains a block
+ * @param p     pointer to a memory
+ * @return      the page of `p` or NULL if `p` is not in a page
+ */
+static lv_mem_slab_page_t * page_find(const void * p)
+{
+    if(state.page_cnt == 0) return NULL;
+
+    /*`page_array_find` gives the index of the first page after `p`*/
+    uint32_t idx = page_array_find(p);
+    if(idx == 0) return NULL;
+
+    lv_mem_slab_page_t * page = state.pages[idx - 1];
+    const uint8_t * first_block = (const uint8_t *)page + PAGE_HEADER_SIZE;
+    if((const uint8_t *)p < first_block || (const uint8_t *)p >= (const uint8_t *)page + LV_MEM_SLAB_PAGE_SIZE) return NULL;
+
+    return page;
+}
+
+/**
+ * Binary search in the sorted page array
+ * @param p     pointer to a memory
+ * @return      index of the first page whose address is larger than `p`
+ */
+static uint32_t page_array_find(const void * p)
+{
+    uint32_t lo = 0;
+    uint32_t hi = state.page_cnt;
+    while(lo < hi) {
+        uint32_t mid = (lo + hi) / 2;
+        if((lv_uintptr_t)state.pages[mid] <= (lv_uintptr_t)p) lo = mid + 1;
+        else hi = mid;
+    }
+
+    return lo;
+}
+
+static void partial_add(lv_mem_slab_class_t * cls, lv_mem_slab_page_t * page)
+{
+    page->prev = NULL;
+    page->next = cls->partial;
+    if(cls->partial) cls->partial->prev = page;
+    cls->partial = page;
+}
+
+static void partial_remove(lv_mem_slab_class_t * cls, lv_mem_slab_page_t * page)
+{
+    if(page->prev) page->prev->next = page->next;
+    else cls->partial = page->next;
+    if(page->next) page->next->prev = page->prev;
+    page->prev = NULL;
+    page->next = NULL;
+}
+
+#endif /*LV_USE_MEM_SLAB*/
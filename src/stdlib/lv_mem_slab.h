@@ -0,0 +1,103 @@
+/**
+ * @file lv_mem_slab.h
+ *
+ */
+
+#ifndef LV_MEM_SLAB_H
+#define LV_MEM_SLAB_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_mem.h"
+
+#include <stdbool.h>
+
+#if LV_USE_MEM_SLAB
+
+#include "../osal/lv_os.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+struct _lv_mem_slab_page_t;
+
+typedef struct {
+    struct _lv_mem_slab_page_t * partial;   /**< Pages of the class which have free blocks*/
+    struct _lv_mem_slab_page_t * empty;     /**< An empty page kept for the next allocation or NULL*/
+    uint32_t page_cnt;
+    uint32_t used_cnt;
+    uint32_t alloc_cnt;
+} lv_mem_slab_class_t;
+
+typedef struct {
+#if LV_USE_OS
+    lv_mutex_t mutex;
+#endif
+    lv_mem_slab_class_t classes[LV_MEM_SLAB_CLASS_CNT];
+    struct _lv_mem_slab_page_t ** pages;    /**< All pages sorted by address to find the page of a block*/
+    uint32_t page_cnt;
+    uint32_t page_array_size;
+} lv_mem_slab_state_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Initialize the slab allocator
+ */
+void _lv_mem_slab_init(void);
+
+/**
+ * Free all pages of the slab allocator. Called after `lv_mem_deinit()`.
+ */
+void _lv_mem_slab_deinit(void);
+
+/**
+ * Allocate a block from the smallest size class which can hold `size` bytes
+ * @param size  size in bytes
+ * @return      pointer to the allocated block or NULL if `size` is too large or a page couldn't be allocated
+ */
+void * _lv_mem_slab_alloc(size_t size);
+
+/**
+ * Free a block if it was allocated by the slab allocator
+ * @param p     pointer to a memory
+ * @return      true: `p` was a block of the slab allocator and it's freed; false: `p` is not a block
+ */
+bool _lv_mem_slab_free(void * p);
+
+/**
+ * Get the size of a block
+ * @param p     pointer to a memory
+ * @return      the block size of the size class of `p` or 0 if `p` is not a block of the slab allocator
+ */
+size_t _lv_mem_slab_get_size(const void * p);
+
+/**
+ * Fill the slab statistics of a memory monitor
+ * @param mon_p     pointer to a memory monitor
+ */
+void _lv_mem_slab_monitor(lv_mem_monitor_t * mon_p);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_MEM_SLAB*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_MEM_SLAB_H*/
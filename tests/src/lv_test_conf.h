@@ -21,7 +21,26 @@ extern "C" {
 #define LV_USE_STDLIB_STRING        LV_STDLIB_CLIB
 #define LV_USE_STDLIB_SPRINTF       LV_STDLIB_CLIB
 #define LV_USE_OS                   LV_OS_PTHREAD
+/*Draw the large tasks in bands on more threads*/
+#define LV_DRAW_SW_DRAW_UNIT_CNT    2
 #define LV_OBJ_STYLE_CACHE          0
+#define LV_USE_CACHE_LRU            1
+#define LV_FONT_FMT_TXT_CACHE_SIZE  (32 * 1024)
+#define LV_USE_FONT_FMT_TXT_ACCEL   1
+#define LV_OBJ_DRAW_CACHE           1
+#define LV_OBJ_STYLE_RESOLVED_CACHE 1
+#define LV_USE_REFR_STATS           1
+#define LV_USE_EVENT_STATS          1
+#define LV_USE_DRAW_ARENA           1
+#define LV_OBJ_OCCLUSION_CULLING    1
+#define LV_DRAW_SW_GRADIENT_CACHE_CNT 8
+#define LV_DRAW_SW_SHADOW_CACHE_SIZE    64
+#define LV_DRAW_SW_SHADOW_CACHE_CNT     32
+#define LV_DRAW_SW_IMAGE_MIPMAP         1
+#if defined(__SSE2__)
+/*Render the reference images with the x86 kernels too*/
+#define LV_USE_DRAW_SW_ASM          LV_DRAW_SW_ASM_AVX2
+#endif
 #endif
 
 #ifdef LVGL_CI_USING_DEF_HEAP
@@ -29,6 +48,7 @@ extern "C" {
 #define LV_USE_STDLIB_STRING    LV_STDLIB_BUILTIN
 #define LV_USE_STDLIB_SPRINTF   LV_STDLIB_BUILTIN
 #define LV_OBJ_STYLE_CACHE      1
+#define LV_USE_MEM_SLAB         1
 #endif
 
 #ifdef MICROPYTHON
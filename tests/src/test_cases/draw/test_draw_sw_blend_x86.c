@@ -0,0 +1,308 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_SSE2 || LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_AVX2
+    #define TEST_X86_KERNELS 1
+#else
+    #define TEST_X86_KERNELS 0
+#endif
+
+#if TEST_X86_KERNELS
+
+#include "../../src/draw/sw/blend/lv_draw_sw_blend_to_rgb565.h"
+#include "../../src/draw/sw/blend/lv_draw_sw_blend_to_rgb888.h"
+#include "../../src/draw/sw/blend/lv_draw_sw_blend_to_argb8888.h"
+
+/* The generic C implementation is the reference for the x86 kernels.
+ * Its sources are compiled here once more without the x86 hooks. The public functions and
+ * the static functions having the same name in more files are renamed to not conflict.*/
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_AVX2
+    #define TEST_X86_AVX2 1
+#else
+    #define TEST_X86_AVX2 0
+#endif
+#undef LV_USE_DRAW_SW_ASM
+#define LV_USE_DRAW_SW_ASM LV_DRAW_SW_ASM_NONE
+
+void ref_blend_color_to_rgb565(_lv_draw_sw_blend_fill_dsc_t * dsc);
+void ref_blend_image_to_rgb565(_lv_draw_sw_blend_image_dsc_t * dsc);
+void ref_blend_color_to_rgb888(_lv_draw_sw_blend_fill_dsc_t * dsc, uint32_t dest_px_size);
+void ref_blend_image_to_rgb888(_lv_draw_sw_blend_image_dsc_t * dsc, uint32_t dest_px_size);
+void ref_blend_color_to_argb8888(_lv_draw_sw_blend_fill_dsc_t * dsc);
+void ref_blend_image_to_argb8888(_lv_draw_sw_blend_image_dsc_t * dsc);
+
+#define lv_draw_sw_blend_color_to_rgb565    ref_blend_color_to_rgb565
+#define lv_draw_sw_blend_image_to_rgb565    ref_blend_image_to_rgb565
+#define rgb565_image_blend                  rgb565_image_blend_to_rgb565
+#define rgb888_image_blend                  rgb888_image_blend_to_rgb565
+#define argb8888_image_blend                argb8888_image_blend_to_rgb565
+#define drawbuf_next_row                    drawbuf_next_row_rgb565
+#include "../../src/draw/sw/blend/lv_draw_sw_blend_to_rgb565.c"
+#undef rgb565_image_blend
+#undef rgb888_image_blend
+#undef argb8888_image_blend
+#undef drawbuf_next_row
+
+#define lv_draw_sw_blend_color_to_rgb888    ref_blend_color_to_rgb888
+#define lv_draw_sw_blend_image_to_rgb888    ref_blend_image_to_rgb888
+#define rgb565_image_blend                  rgb565_image_blend_to_rgb888
+#define rgb888_image_blend                  rgb888_image_blend_to_rgb888
+#define argb8888_image_blend                argb8888_image_blend_to_rgb888
+#define drawbuf_next_row                    drawbuf_next_row_rgb888
+#define blend_non_normal_pixel              blend_non_normal_pixel_rgb888
+#include "../../src/draw/sw/blend/lv_draw_sw_blend_to_rgb888.c"
+#undef rgb565_image_blend
+#undef rgb888_image_blend
+#undef argb8888_image_blend
+#undef drawbuf_next_row
+#undef blend_non_normal_pixel
+
+#define lv_draw_sw_blend_color_to_argb8888  ref_blend_color_to_argb8888
+#define lv_draw_sw_blend_image_to_argb8888  ref_blend_image_to_argb8888
+#define rgb565_image_blend                  rgb565_image_blend_to_argb8888
+#define rgb888_image_blend                  rgb888_image_blend_to_argb8888
+#define argb8888_image_blend                argb8888_image_blend_to_argb8888
+#define drawbuf_next_row                    drawbuf_next_row_argb8888
+#define blend_non_normal_pixel              blend_non_normal_pixel_argb8888
+#include "../../src/draw/sw/blend/lv_draw_sw_blend_to_argb8888.c"
+#undef rgb565_image_blend
+#undef rgb888_image_blend
+#undef argb8888_image_blend
+#undef drawbuf_next_row
+#undef blend_non_normal_pixel
+
+#undef lv_draw_sw_blend_color_to_rgb565
+#undef lv_draw_sw_blend_image_to_rgb565
+#undef lv_draw_sw_blend_color_to_rgb888
+#undef lv_draw_sw_blend_image_to_rgb888
+#undef lv_draw_sw_blend_color_to_argb8888
+#undef lv_draw_sw_blend_image_to_argb8888
+
+#undef LV_USE_DRAW_SW_ASM
+#if TEST_X86_AVX2
+    #define LV_USE_DRAW_SW_ASM LV_DRAW_SW_ASM_AVX2
+#else
+    #define LV_USE_DRAW_SW_ASM LV_DRAW_SW_ASM_SSE2
+#endif
+#include "../../src/draw/sw/blend/x86/lv_blend_x86.h"
+
+#endif /*TEST_X86_KERNELS*/
+
+static uint32_t rnd_state;
+
+void setUp(void)
+{
+    rnd_state = 12345;
+}
+
+void tearDown(void)
+{
+#if TEST_X86_KERNELS
+    lv_draw_sw_blend_x86_enable_avx2(true);
+#endif
+}
+
+#if TEST_X86_KERNELS
+
+/* The vectorized kernels process 4, 8 or 16 pixels at once and the rest of the line
+ * with scalar code, so use odd widths and strides to cover both.*/
+
+#define BUF_W       37
+#define BUF_H       5
+#define MAX_PX_SIZE 4
+#define STRIDE      ((BUF_W + 3) * MAX_PX_SIZE)
+
+static uint8_t dest_act[BUF_H * STRIDE];
+static uint8_t dest_ref[BUF_H * STRIDE];
+static uint8_t src_buf[BUF_H * STRIDE];
+static lv_opa_t mask_buf[BUF_H * BUF_W];
+
+static const lv_opa_t special_opa[] = {0, 1, 2, 3, 4, 127, 128, 251, 252, 253, 254, 255};
+
+static uint32_t rnd(void)
+{
+    rnd_state = rnd_state * 1103515245 + 12345;
+    return rnd_state >> 8;
+}
+
+/*Random value with many values around the special thresholds*/
+static lv_opa_t rnd_opa(void)
+{
+    if(rnd() % 2) return special_opa[rnd() % sizeof(special_opa)];
+    return rnd() & 0xFF;
+}
+
+static void fill_random(bool opaque_dest)
+{
+    uint32_t i;
+    for(i = 0; i < sizeof(dest_act); i++) {
+        dest_act[i] = rnd() & 0xFF;
+        src_buf[i] = (i % 4 == 3) ? rnd_opa() : rnd() & 0xFF;
+    }
+
+    /*Make some ARGB8888 destination lines opaque to use the vectorized path*/
+    if(opaque_dest) {
+        for(i = 3; i < sizeof(dest_act); i += 4) {
+            if((i / STRIDE) % 2 == 0) dest_act[i] = 0xFF;
+        }
+    }
+
+    for(i = 0; i < sizeof(mask_buf); i++) mask_buf[i] = rnd_opa();
+    lv_memcpy(dest_ref, dest_act, sizeof(dest_act));
+}
+
+typedef void (*fill_cb_t)(_lv_draw_sw_blend_fill_dsc_t * dsc, uint32_t px_size);
+typedef void (*image_cb_t)(_lv_draw_sw_blend_image_dsc_t * dsc, uint32_t px_size);
+
+static void fill_x86_cb(_lv_draw_sw_blend_fill_dsc_t * dsc, uint32_t px_size)
+{
+    if(px_size == 2) lv_draw_sw_blend_color_to_rgb565(dsc);
+    else if(px_size == 3) lv_draw_sw_blend_color_to_rgb888(dsc, 3);
+    else lv_draw_sw_blend_color_to_argb8888(dsc);
+}
+
+static void fill_ref_cb(_lv_draw_sw_blend_fill_dsc_t * dsc, uint32_t px_size)
+{
+    if(px_size == 2) ref_blend_color_to_rgb565(dsc);
+    else if(px_size == 3) ref_blend_color_to_rgb888(dsc, 3);
+    else ref_blend_color_to_argb8888(dsc);
+}
+
+static void fill_xrgb8888_x86_cb(_lv_draw_sw_blend_fill_dsc_t * dsc, uint32_t px_size)
+{
+    LV_UNUSED(px_size);
+    lv_draw_sw_blend_color_to_rgb888(dsc, 4);
+}
+
+static void fill_xrgb8888_ref_cb(_lv_draw_sw_blend_fill_dsc_t * dsc, uint32_t px_size)
+{
+    LV_UNUSED(px_size);
+    ref_blend_color_to_rgb888(dsc, 4);
+}
+
+static void image_x86_cb(_lv_draw_sw_blend_image_dsc_t * dsc, uint32_t px_size)
+{
+    if(px_size == 2) lv_draw_sw_blend_image_to_rgb565(dsc);
+    else if(px_size == 3) lv_draw_sw_blend_image_to_rgb888(dsc, 3);
+    else lv_draw_sw_blend_image_to_argb8888(dsc);
+}
+
+static void image_ref_cb(_lv_draw_sw_blend_image_dsc_t * dsc, uint32_t px_size)
+{
+    if(px_size == 2) ref_blend_image_to_rgb565(dsc);
+    else if(px_size == 3) ref_blend_image_to_rgb888(dsc, 3);
+    else ref_blend_image_to_argb8888(dsc);
+}
+
+static void image_xrgb8888_x86_cb(_lv_draw_sw_blend_image_dsc_t * dsc, uint32_t px_size)
+{
+    LV_UNUSED(px_size);
+    lv_draw_sw_blend_image_to_rgb888(dsc, 4);
+}
+
+static void image_xrgb8888_ref_cb(_lv_draw_sw_blend_image_dsc_t * dsc, uint32_t px_size)
+{
+    LV_UNUSED(px_size);
+    ref_blend_image_to_rgb888(dsc, 4);
+}
+
+static void check_fill(fill_cb_t x86_cb, fill_cb_t ref_cb, uint32_t px_size, bool with_mask)
+{
+    uint32_t round;
+    for(round = 0; round < 40; round++) {
+        fill_random(px_size == 4);
+
+        _lv_draw_sw_blend_fill_dsc_t dsc;
+        lv_memzero(&dsc, sizeof(dsc));
+        dsc.dest_w = 1 + rnd() % BUF_W;
+        dsc.dest_h = 1 + rnd() % BUF_H;
+        dsc.color = lv_color_hex(rnd());
+        dsc.opa = rnd_opa();
+        dsc.dest_stride = STRIDE;
+        dsc.mask_buf = with_mask ? mask_buf : NULL;
+        dsc.mask_stride = BUF_W;
+
+        dsc.dest_buf = dest_ref;
+        ref_cb(&dsc, px_size);
+
+        dsc.dest_buf = dest_act;
+        x86_cb(&dsc, px_size);
+
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(dest_ref, dest_act, sizeof(dest_act));
+    }
+}
+
+static void check_image(image_cb_t x86_cb, image_cb_t ref_cb, uint32_t px_size, lv_color_format_t src_cf,
+                        bool with_mask)
+{
+    uint32_t round;
+    for(round = 0; round < 40; round++) {
+        fill_random(px_size == 4);
+
+        _lv_draw_sw_blend_image_dsc_t dsc;
+        lv_memzero(&dsc, sizeof(dsc));
+        dsc.dest_w = 1 + rnd() % BUF_W;
+        dsc.dest_h = 1 + rnd() % BUF_H;
+        dsc.opa = rnd_opa();
+        dsc.dest_stride = STRIDE;
+        dsc.src_buf = src_buf;
+        dsc.src_stride = STRIDE;
+        dsc.src_color_format = src_cf;
+        dsc.mask_buf = with_mask ? mask_buf : NULL;
+        dsc.mask_stride = BUF_W;
+        dsc.blend_mode = LV_BLEND_MODE_NORMAL;
+
+        dsc.dest_buf = dest_ref;
+        ref_cb(&dsc, px_size);
+
+        dsc.dest_buf = dest_act;
+        x86_cb(&dsc, px_size);
+
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(dest_ref, dest_act, sizeof(dest_act));
+    }
+}
+
+static void check_all_kernels(void)
+{
+    bool with_mask;
+    for(with_mask = false; ; with_mask = true) {
+        check_fill(fill_x86_cb, fill_ref_cb, 2, with_mask);
+        check_fill(fill_x86_cb, fill_ref_cb, 3, with_mask);
+        check_fill(fill_xrgb8888_x86_cb, fill_xrgb8888_ref_cb, 4, with_mask);
+        check_fill(fill_x86_cb, fill_ref_cb, 4, with_mask);
+
+        check_image(image_x86_cb, image_ref_cb, 2, LV_COLOR_FORMAT_RGB565, with_mask);
+        check_image(image_x86_cb, image_ref_cb, 2, LV_COLOR_FORMAT_ARGB8888, with_mask);
+        check_image(image_x86_cb, image_ref_cb, 3, LV_COLOR_FORMAT_ARGB8888, with_mask);
+        check_image(image_xrgb8888_x86_cb, image_xrgb8888_ref_cb, 4, LV_COLOR_FORMAT_ARGB8888, with_mask);
+        check_image(image_x86_cb, image_ref_cb, 4, LV_COLOR_FORMAT_ARGB8888, with_mask);
+
+        if(with_mask) break;
+    }
+}
+
+#endif /*TEST_X86_KERNELS*/
+
+void test_blend_x86_sse2_matches_c(void)
+{
+#if TEST_X86_KERNELS
+    lv_draw_sw_blend_x86_enable_avx2(false);
+    TEST_ASSERT_FALSE(lv_draw_sw_blend_x86_has_avx2());
+    check_all_kernels();
+#endif
+}
+
+void test_blend_x86_avx2_matches_c(void)
+{
+#if TEST_X86_KERNELS
+    lv_draw_sw_blend_x86_enable_avx2(true);
+    if(!lv_draw_sw_blend_x86_has_avx2()) {
+        TEST_IGNORE_MESSAGE("The AVX2 kernels are not enabled or not supported by the CPU");
+    }
+    check_all_kernels();
+#endif
+}
+
+#endif
@@ -0,0 +1,66 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+/*Cards with a few different shadow widths, radii, spreads and sizes*/
+static void create_scene(void)
+{
+    static const int32_t widths[] = {4, 15, 30, 50};
+    static const int32_t radii[] = {0, 6, 20};
+
+    lv_obj_t * scr = lv_screen_active();
+    lv_obj_set_style_bg_color(scr, lv_color_white(), 0);
+    uint32_t i;
+    for(i = 0; i < 24; i++) {
+        lv_obj_t * obj = lv_obj_create(scr);
+        lv_obj_remove_style_all(obj);
+        lv_obj_set_size(obj, i % 5 == 4 ? 20 : 100, 50);
+        lv_obj_set_pos(obj, (i % 6) * 130 + 20, (i / 6) * 115 + 30);
+        lv_obj_set_style_bg_opa(obj, i % 7 == 3 ? LV_OPA_TRANSP : LV_OPA_COVER, 0);
+        lv_obj_set_style_bg_color(obj, lv_palette_lighten(LV_PALETTE_GREY, 4), 0);
+        lv_obj_set_style_radius(obj, radii[i % 3], 0);
+        lv_obj_set_style_shadow_width(obj, widths[i % 4], 0);
+        lv_obj_set_style_shadow_spread(obj, i % 6 == 5 ? 5 : 0, 0);
+        lv_obj_set_style_shadow_offset_y(obj, i % 2 ? 5 : 0, 0);
+        lv_obj_set_style_shadow_color(obj, lv_palette_main(i % 4), 0);
+    }
+}
+
+void test_draw_sw_box_shadow_cards(void)
+{
+    create_scene();
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/sw_box_shadow_cards.png");
+}
+
+void test_draw_sw_box_shadow_cache(void)
+{
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+    create_scene();
+    lv_refr_now(NULL);
+
+    /*All the corners are cached now*/
+    uint32_t hit_start, miss_start, hit, miss;
+    lv_draw_sw_shadow_cache_get_counters(&hit_start, &miss_start);
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    lv_draw_sw_shadow_cache_get_counters(&hit, &miss);
+    TEST_ASSERT_GREATER_THAN(hit_start, hit);
+    TEST_ASSERT_EQUAL(miss_start, miss);
+
+    /*And the result is the same*/
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/sw_box_shadow_cards.png");
+#endif
+}
+
+#endif
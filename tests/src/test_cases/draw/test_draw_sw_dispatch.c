@@ -0,0 +1,97 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#define MAX_UNIT_CNT    16
+
+static lv_draw_unit_t * saved_units[MAX_UNIT_CNT];
+static lv_draw_unit_t * saved_next[MAX_UNIT_CNT];
+static uint32_t saved_unit_cnt;
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /*Restore the draw units*/
+    uint32_t i;
+    for(i = 0; i < saved_unit_cnt; i++) {
+        saved_units[i]->next = saved_next[i];
+    }
+    saved_unit_cnt = 0;
+
+    lv_obj_clean(lv_screen_active());
+}
+
+/*Many small widgets which don't overlap, covered partly by a few large ones*/
+static void create_scene(void)
+{
+    lv_obj_t * scr = lv_screen_active();
+    uint32_t i;
+    for(i = 0; i < 480; i++) {
+        lv_obj_t * obj = lv_obj_create(scr);
+        lv_obj_remove_style_all(obj);
+        lv_obj_set_size(obj, 18, 18);
+        lv_obj_set_pos(obj, (i % 40) * 20, (i / 40) * 20);
+        lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, 0);
+        lv_obj_set_style_bg_color(obj, lv_palette_main(i % _LV_PALETTE_LAST), 0);
+        lv_obj_set_style_radius(obj, 4, 0);
+        lv_obj_set_style_border_width(obj, 1, 0);
+    }
+
+    for(i = 0; i < 4; i++) {
+        lv_obj_t * obj = lv_obj_create(scr);
+        lv_obj_set_size(obj, 150, 150);
+        lv_obj_set_pos(obj, 40 + i * 180, 50 + i * 40);
+        lv_obj_set_style_bg_opa(obj, LV_OPA_50, 0);
+        lv_obj_set_style_shadow_width(obj, 20, 0);
+
+        lv_obj_t * label = lv_label_create(obj);
+        lv_label_set_text_fmt(label, "Top %" LV_PRIu32, i);
+    }
+}
+
+void test_draw_sw_dispatch_keeps_order(void)
+{
+    create_scene();
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/sw_dispatch_many_tasks.png");
+}
+
+/*Unlink the draw units which are the same kind as the unit before them, e.g. keep only one SW draw unit.
+ *The original links are saved to restore them in `tearDown()`.*/
+static void keep_one_unit_per_kind(void)
+{
+    lv_draw_unit_t * u;
+    for(u = LV_GLOBAL_DEFAULT()->draw_info.unit_head; u; u = u->next) {
+        TEST_ASSERT_LESS_THAN(MAX_UNIT_CNT, saved_unit_cnt);
+        saved_units[saved_unit_cnt] = u;
+        saved_next[saved_unit_cnt] = u->next;
+        saved_unit_cnt++;
+    }
+
+    for(u = LV_GLOBAL_DEFAULT()->draw_info.unit_head; u; u = u->next) {
+        while(u->next && u->next->dispatch_cb == u->dispatch_cb) u->next = u->next->next;
+    }
+}
+
+/*Render the same scene with all draw units and with one SW draw unit*/
+void test_draw_sw_dispatch_same_with_one_draw_unit(void)
+{
+    create_scene();
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/sw_dispatch_many_tasks.png");
+
+    keep_one_unit_per_kind();
+#if LV_DRAW_SW_DRAW_UNIT_CNT > 1
+    uint32_t unit_cnt = 0;
+    lv_draw_unit_t * u;
+    for(u = LV_GLOBAL_DEFAULT()->draw_info.unit_head; u; u = u->next) unit_cnt++;
+    TEST_ASSERT_EQUAL(saved_unit_cnt - (LV_DRAW_SW_DRAW_UNIT_CNT - 1), unit_cnt);
+#endif
+    lv_obj_invalidate(lv_screen_active());
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/sw_dispatch_many_tasks.png");
+}
+
+#endif
@@ -0,0 +1,127 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+static void init_grad(lv_grad_dsc_t * g, lv_grad_dir_t dir, uint8_t frac1, uint8_t frac2)
+{
+    lv_memzero(g, sizeof(lv_grad_dsc_t));
+    g->dir = dir;
+    g->stops_count = 2;
+    g->stops[0].color = lv_color_hex(0x102030);
+    g->stops[0].opa = LV_OPA_30;
+    g->stops[0].frac = frac1;
+    g->stops[1].color = lv_color_hex(0xf0c080);
+    g->stops[1].opa = LV_OPA_COVER;
+    g->stops[1].frac = frac2;
+}
+
+void test_draw_sw_gradient_map_matches_calculate(void)
+{
+    static const uint8_t fracs[][2] = {{0, 255}, {0, 0}, {255, 255}, {60, 200}, {128, 129}, {100, 100}, {200, 60}};
+    static const int32_t sizes[] = {1, 2, 7, 100, 255, 256, 479};
+
+    uint32_t f;
+    for(f = 0; f < sizeof(fracs) / sizeof(fracs[0]); f++) {
+        uint32_t s;
+        for(s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+            lv_grad_dsc_t g;
+            init_grad(&g, LV_GRAD_DIR_VER, fracs[f][0], fracs[f][1]);
+
+            lv_grad_t * grad = lv_gradient_get(&g, 10, sizes[s]);
+            TEST_ASSERT_NOT_NULL(grad);
+            TEST_ASSERT_EQUAL(sizes[s], grad->size);
+
+            int32_t i;
+            for(i = 0; i < sizes[s]; i++) {
+                lv_color_t c;
+                lv_opa_t opa;
+                lv_gradient_color_calculate(&g, sizes[s], i, &c, &opa);
+                TEST_ASSERT_EQUAL_HEX32(lv_color_to_u32(c), lv_color_to_u32(grad->color_map[i]));
+                TEST_ASSERT_EQUAL(opa, grad->opa_map[i]);
+            }
+            lv_gradient_cleanup(grad);
+        }
+    }
+}
+
+void test_draw_sw_gradient_cache(void)
+{
+#if LV_DRAW_SW_GRADIENT_CACHE_CNT > 0
+    lv_grad_dsc_t g;
+    init_grad(&g, LV_GRAD_DIR_HOR, 0, 255);
+
+    uint32_t hit_start, miss_start, hit, miss;
+    lv_gradient_cache_get_counters(&hit_start, &miss_start);
+
+    /*The same gradient and width is found, the height doesn't matter*/
+    lv_grad_t * grad1 = lv_gradient_get(&g, 100, 20);
+    lv_grad_t * grad2 = lv_gradient_get(&g, 100, 40);
+    TEST_ASSERT_EQUAL_PTR(grad1, grad2);
+    lv_gradient_cache_get_counters(&hit, &miss);
+    TEST_ASSERT_EQUAL(hit_start + 1, hit);
+    TEST_ASSERT_EQUAL(miss_start + 1, miss);
+    lv_gradient_cleanup(grad2);
+
+    /*Different color*/
+    g.stops[1].color = lv_color_hex(0x00ff00);
+    lv_grad_t * grad3 = lv_gradient_get(&g, 100, 20);
+    TEST_ASSERT_NOT_EQUAL(grad1, grad3);
+    TEST_ASSERT_EQUAL_HEX32(0x00ff00, lv_color_to_u32(grad3->color_map[99]) & 0xffffff);
+    lv_gradient_cleanup(grad3);
+
+    /*Push out `grad1` from the cache while it's used. It should be still valid.*/
+    int32_t i;
+    for(i = 0; i < LV_DRAW_SW_GRADIENT_CACHE_CNT + 2; i++) {
+        lv_gradient_cleanup(lv_gradient_get(&g, 200 + i, 20));
+    }
+    lv_memset(grad1->color_map, 0, grad1->size * sizeof(lv_color_t));
+    lv_gradient_cleanup(grad1);
+
+    /*It was dropped so it's calculated again*/
+    g.stops[1].color = lv_color_hex(0xf0c080);
+    lv_gradient_cache_get_counters(&hit_start, &miss_start);
+    lv_gradient_cleanup(lv_gradient_get(&g, 100, 20));
+    lv_gradient_cache_get_counters(&hit, &miss);
+    TEST_ASSERT_EQUAL(hit_start, hit);
+    TEST_ASSERT_EQUAL(miss_start + 1, miss);
+#endif
+}
+
+/*Cards with a few different gradients*/
+static void create_scene(void)
+{
+    lv_obj_t * scr = lv_screen_active();
+    uint32_t i;
+    for(i = 0; i < 48; i++) {
+        lv_obj_t * obj = lv_obj_create(scr);
+        lv_obj_remove_style_all(obj);
+        lv_obj_set_size(obj, 90, 54);
+        lv_obj_set_pos(obj, (i % 8) * 100 + 5, (i / 8) * 80 + 5);
+        lv_obj_set_style_radius(obj, 8, 0);
+        lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, 0);
+        lv_obj_set_style_bg_color(obj, lv_palette_main(i % 4), 0);
+        lv_obj_set_style_bg_grad_color(obj, lv_palette_darken(i % 4, 3), 0);
+        lv_obj_set_style_bg_grad_dir(obj, i % 2 ? LV_GRAD_DIR_HOR : LV_GRAD_DIR_VER, 0);
+        lv_obj_set_style_bg_main_stop(obj, 40, 0);
+        lv_obj_set_style_bg_grad_stop(obj, 220, 0);
+    }
+}
+
+void test_draw_sw_gradient_cards(void)
+{
+    create_scene();
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/sw_gradient_cards.png");
+}
+
+#endif
@@ -0,0 +1,138 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+LV_IMAGE_DECLARE(test_image_cogwheel_argb8888);
+LV_IMAGE_DECLARE(test_image_cogwheel_xrgb8888);
+LV_IMAGE_DECLARE(test_image_cogwheel_rgb565);
+LV_IMAGE_DECLARE(test_image_cogwheel_rgb565a8);
+LV_IMAGE_DECLARE(test_image_cogwheel_a8);
+
+/*16x16 ARGB8888 checkerboard with 1 px cells*/
+static uint32_t checker_map[16 * 16];
+static lv_image_dsc_t checker_img;
+
+void setUp(void)
+{
+    uint32_t i;
+    for(i = 0; i < 16 * 16; i++) {
+        checker_map[i] = ((i + i / 16) & 1) ? 0xffffffff : 0xff000000;
+    }
+
+    lv_memzero(&checker_img, sizeof(checker_img));
+    checker_img.header.cf = LV_COLOR_FORMAT_ARGB8888;
+    checker_img.header.w = 16;
+    checker_img.header.h = 16;
+    checker_img.header.stride = 16 * 4;
+    checker_img.data = (const uint8_t *)checker_map;
+    checker_img.data_size = sizeof(checker_map);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_draw_sw_image_mipmap_level(void)
+{
+#if LV_DRAW_SW_IMAGE_MIPMAP
+    lv_image_header_t header = {0};
+    header.w = 100;
+    header.h = 40;
+
+    TEST_ASSERT_EQUAL(0, lv_draw_sw_mipmap_get_level(&header, 256, 256));
+    TEST_ASSERT_EQUAL(0, lv_draw_sw_mipmap_get_level(&header, 129, 129));
+    TEST_ASSERT_EQUAL(1, lv_draw_sw_mipmap_get_level(&header, 128, 128));
+    TEST_ASSERT_EQUAL(1, lv_draw_sw_mipmap_get_level(&header, 100, 100));
+    TEST_ASSERT_EQUAL(2, lv_draw_sw_mipmap_get_level(&header, 64, 64));
+
+    /*The larger scale decides to not blur the image in the other direction*/
+    TEST_ASSERT_EQUAL(0, lv_draw_sw_mipmap_get_level(&header, 32, 256));
+    TEST_ASSERT_EQUAL(1, lv_draw_sw_mipmap_get_level(&header, 32, 128));
+
+    /*Not smaller than 1 px*/
+    TEST_ASSERT_EQUAL(5, lv_draw_sw_mipmap_get_level(&header, 1, 1));
+#endif
+}
+
+void test_draw_sw_image_mipmap_prefiltered(void)
+{
+#if LV_DRAW_SW_IMAGE_MIPMAP
+    size_t cache_size_ori = lv_cache_get_max_size();
+    lv_cache_lock();
+    lv_cache_set_max_size(64 * 1024);
+    lv_cache_unlock();
+
+    lv_image_decoder_dsc_t decoder_dsc;
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_open(&decoder_dsc, &checker_img, NULL));
+    TEST_ASSERT_NOT_NULL(decoder_dsc.cache_entry);
+
+    /*A 1 px checkerboard becomes evenly gray instead of aliasing to black or white*/
+    lv_cache_entry_t * mip_entry = NULL;
+    const lv_draw_buf_t * mip = lv_draw_sw_mipmap_get(&decoder_dsc, 2, &mip_entry);
+    TEST_ASSERT_NOT_NULL(mip);
+    TEST_ASSERT_EQUAL(4, mip->header.w);
+    TEST_ASSERT_EQUAL(4, mip->header.h);
+    uint32_t y;
+    for(y = 0; y < 4; y++) {
+        const uint32_t * row = (const uint32_t *)((const uint8_t *)mip->data + y * mip->header.stride);
+        uint32_t x;
+        for(x = 0; x < 4; x++) {
+            TEST_ASSERT_EQUAL_HEX32(0xff808080, row[x]);
+        }
+    }
+
+    /*It's kept in the image cache*/
+    lv_cache_entry_t * mip_entry2 = NULL;
+    const lv_draw_buf_t * mip2 = lv_draw_sw_mipmap_get(&decoder_dsc, 2, &mip_entry2);
+    TEST_ASSERT_EQUAL_PTR(mip, mip2);
+
+    lv_cache_lock();
+    lv_cache_release(mip_entry);
+    lv_cache_release(mip_entry2);
+    lv_cache_unlock();
+    lv_image_decoder_close(&decoder_dsc);
+
+    /*And dropped together with the image*/
+    lv_cache_lock();
+    lv_cache_invalidate_by_src(&checker_img, LV_CACHE_SRC_TYPE_POINTER);
+    TEST_ASSERT_NULL(lv_cache_find_by_src(NULL, &checker_img, LV_CACHE_SRC_TYPE_POINTER));
+    lv_cache_set_max_size(cache_size_ori);
+    lv_cache_unlock();
+#endif
+}
+
+#if LV_DRAW_SW_IMAGE_MIPMAP
+/*Thumbnails of all the supported color formats with a few scales and rotations*/
+static void create_scene(void)
+{
+    static const lv_image_dsc_t * srcs[] = {
+        &test_image_cogwheel_argb8888, &test_image_cogwheel_xrgb8888, &test_image_cogwheel_rgb565,
+        &test_image_cogwheel_rgb565a8, &test_image_cogwheel_a8
+    };
+    static const int32_t scales[] = {128, 90, 64, 40, 20};
+
+    uint32_t i;
+    for(i = 0; i < 25; i++) {
+        lv_obj_t * img = lv_image_create(lv_screen_active());
+        lv_image_set_src(img, srcs[i / 5]);
+        lv_image_set_scale(img, scales[i % 5]);
+        lv_image_set_rotation(img, (i % 5) == 3 ? 300 : 0);
+        lv_obj_set_pos(img, (i % 5) * 150 - 20, (i / 5) * 95 - 5);
+        if(srcs[i / 5] == &test_image_cogwheel_a8) {
+            lv_obj_set_style_image_recolor(img, lv_color_hex(0x3040c0), 0);
+        }
+    }
+}
+#endif
+
+void test_draw_sw_image_mipmap_thumbnails(void)
+{
+#if LV_DRAW_SW_IMAGE_MIPMAP
+    create_scene();
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/sw_image_mipmap_thumbnails.png");
+#endif
+}
+
+#endif
@@ -0,0 +1,128 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+LV_IMAGE_DECLARE(test_image_cogwheel_argb8888);
+LV_IMAGE_DECLARE(test_image_cogwheel_xrgb8888);
+LV_IMAGE_DECLARE(test_image_cogwheel_rgb565);
+LV_IMAGE_DECLARE(test_image_cogwheel_rgb565a8);
+LV_IMAGE_DECLARE(test_image_cogwheel_a8);
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+/*Draw all the supported color formats (rows) with a few scale-only transformations (columns).
+ *The scales are kept above 128 to render the same with and without mipmaps.*/
+static void scaled_images_draw_cb(lv_event_t * e)
+{
+    static const lv_image_dsc_t * srcs[] = {
+        &test_image_cogwheel_argb8888, &test_image_cogwheel_xrgb8888, &test_image_cogwheel_rgb565,
+        &test_image_cogwheel_rgb565a8, &test_image_cogwheel_a8
+    };
+
+    static const struct {
+        int32_t scale_x;
+        int32_t scale_y;
+    } transforms[] = {
+        {160, 160},
+        {200, 230},
+        {230, 170},
+        {300, 200},
+        {512, 200},     /*Clipped by the right side of the screen*/
+    };
+
+    lv_layer_t * layer = lv_event_get_layer(e);
+
+    uint32_t i;
+    for(i = 0; i < 25; i++) {
+        const lv_image_dsc_t * src = srcs[i / 5];
+        lv_draw_image_dsc_t dsc;
+        lv_draw_image_dsc_init(&dsc);
+        dsc.src = src;
+        dsc.header = src->header;
+        dsc.recolor = lv_color_hex(0x3040c0);
+        dsc.pivot.x = src->header.w / 2;
+        dsc.pivot.y = src->header.h / 2;
+        dsc.scale_x = transforms[i % 5].scale_x;
+        dsc.scale_y = transforms[i % 5].scale_y;
+
+        lv_area_t coords;
+        coords.x1 = (i % 5) * 160 + 30;
+        coords.y1 = (i / 5) * 96 - 2;
+        coords.x2 = coords.x1 + src->header.w - 1;
+        coords.y2 = coords.y1 + src->header.h - 1;
+        lv_draw_image(layer, &dsc, &coords);
+    }
+}
+
+void test_draw_sw_image_scale(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_size(obj, LV_PCT(100), LV_PCT(100));
+    lv_obj_add_event_cb(obj, scaled_images_draw_cb, LV_EVENT_DRAW_MAIN, NULL);
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/sw_image_scale.png");
+}
+
+/*Draw the RGB565 and RGB565A8 images (rows) without anti-aliasing.
+ *The first two columns are only scaled, the others are rotated too to use the generic transformation.*/
+static void no_antialias_draw_cb(lv_event_t * e)
+{
+    static const lv_image_dsc_t * srcs[] = {&test_image_cogwheel_rgb565, &test_image_cogwheel_rgb565a8};
+
+    static const struct {
+        int32_t scale_x;
+        int32_t scale_y;
+        int32_t rotation;
+    } transforms[] = {
+        {300, 200, 0},
+        {180, 320, 0},
+        {256, 256, 300},
+        {300, 200, 1200},
+    };
+
+    lv_layer_t * layer = lv_event_get_layer(e);
+
+    uint32_t i;
+    for(i = 0; i < 8; i++) {
+        const lv_image_dsc_t * src = srcs[i / 4];
+        lv_draw_image_dsc_t dsc;
+        lv_draw_image_dsc_init(&dsc);
+        dsc.src = src;
+        dsc.header = src->header;
+        dsc.pivot.x = src->header.w / 2;
+        dsc.pivot.y = src->header.h / 2;
+        dsc.scale_x = transforms[i % 4].scale_x;
+        dsc.scale_y = transforms[i % 4].scale_y;
+        dsc.rotation = transforms[i % 4].rotation;
+        dsc.antialias = 0;
+
+        lv_area_t coords;
+        coords.x1 = (i % 4) * 190 + 50;
+        coords.y1 = (i / 4) * 220 + 50;
+        coords.x2 = coords.x1 + src->header.w - 1;
+        coords.y2 = coords.y1 + src->header.h - 1;
+        lv_draw_image(layer, &dsc, &coords);
+    }
+}
+
+void test_draw_sw_image_scale_no_antialias(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_size(obj, LV_PCT(100), LV_PCT(100));
+    lv_obj_add_event_cb(obj, no_antialias_draw_cb, LV_EVENT_DRAW_MAIN, NULL);
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/sw_image_scale_no_antialias.png");
+}
+
+#endif
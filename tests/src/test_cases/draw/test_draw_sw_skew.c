@@ -0,0 +1,128 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+LV_IMAGE_DECLARE(test_image_cogwheel_argb8888);
+LV_IMAGE_DECLARE(test_image_cogwheel_xrgb8888);
+LV_IMAGE_DECLARE(test_image_cogwheel_rgb565);
+LV_IMAGE_DECLARE(test_image_cogwheel_rgb565a8);
+LV_IMAGE_DECLARE(test_image_cogwheel_a8);
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+/*Draw all the supported color formats (rows) with a few skew, rotation and scale combinations (columns)*/
+static void skewed_images_draw_cb(lv_event_t * e)
+{
+    static const lv_image_dsc_t * srcs[] = {
+        &test_image_cogwheel_argb8888, &test_image_cogwheel_xrgb8888, &test_image_cogwheel_rgb565,
+        &test_image_cogwheel_rgb565a8, &test_image_cogwheel_a8
+    };
+
+    static const struct {
+        int32_t skew_x;
+        int32_t skew_y;
+        int32_t rotation;
+        int32_t scale_x;
+    } transforms[] = {
+        {300, 0, 0, 160},
+        {-300, 0, 0, 160},
+        {0, 200, 0, 160},
+        {200, 100, 300, 160},
+        {450, 0, 0, 200},
+    };
+
+    lv_layer_t * layer = lv_event_get_layer(e);
+
+    uint32_t i;
+    for(i = 0; i < 25; i++) {
+        const lv_image_dsc_t * src = srcs[i / 5];
+        lv_draw_image_dsc_t dsc;
+        lv_draw_image_dsc_init(&dsc);
+        dsc.src = src;
+        dsc.header = src->header;
+        dsc.recolor = lv_color_hex(0x3040c0);
+        dsc.pivot.x = src->header.w / 2;
+        dsc.pivot.y = src->header.h / 2;
+        dsc.skew_x = transforms[i % 5].skew_x;
+        dsc.skew_y = transforms[i % 5].skew_y;
+        dsc.rotation = transforms[i % 5].rotation;
+        dsc.scale_x = transforms[i % 5].scale_x;
+        dsc.scale_y = 160;
+
+        lv_area_t coords;
+        coords.x1 = (i % 5) * 160 + 30;
+        coords.y1 = (i / 5) * 96 - 2;
+        coords.x2 = coords.x1 + src->header.w - 1;
+        coords.y2 = coords.y1 + src->header.h - 1;
+        lv_draw_image(layer, &dsc, &coords);
+    }
+}
+
+void test_draw_sw_skew_images(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_size(obj, LV_PCT(100), LV_PCT(100));
+    lv_obj_add_event_cb(obj, skewed_images_draw_cb, LV_EVENT_DRAW_MAIN, NULL);
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/sw_skew_images.png");
+}
+
+void test_draw_sw_skew_widgets(void)
+{
+    static const int32_t skews[][2] = {{200, 0}, {-200, 0}, {0, 150}, {150, -150}};
+
+    uint32_t i;
+    for(i = 0; i < 4; i++) {
+        lv_obj_t * btn = lv_button_create(lv_screen_active());
+        lv_obj_set_size(btn, 140, 80);
+        lv_obj_set_pos(btn, 40 + (i % 2) * 400, 60 + (i / 2) * 200);
+        lv_obj_set_style_transform_pivot_x(btn, 70, 0);
+        lv_obj_set_style_transform_pivot_y(btn, 40, 0);
+        lv_obj_set_style_transform_skew_x(btn, skews[i][0], 0);
+        lv_obj_set_style_transform_skew_y(btn, skews[i][1], 0);
+
+        lv_obj_t * label = lv_label_create(btn);
+        lv_label_set_text(label, "Skewed");
+        lv_obj_center(label);
+    }
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("draw/sw_skew_widgets.png");
+}
+
+void test_draw_sw_skew_transform_point(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_set_pos(obj, 100, 100);
+    lv_obj_set_size(obj, 200, 100);
+    lv_obj_set_style_transform_skew_x(obj, 450, 0);
+    lv_obj_update_layout(obj);
+
+    /*The pivot is the top left corner so the bottom edge is shifted by the height*/
+    lv_point_t p = {200, 200};
+    lv_obj_transform_point(obj, &p, false, false);
+    TEST_ASSERT_INT_WITHIN(1, 300, p.x);
+    TEST_ASSERT_EQUAL(200, p.y);
+
+    /*And back*/
+    lv_obj_transform_point(obj, &p, false, true);
+    TEST_ASSERT_INT_WITHIN(1, 200, p.x);
+    TEST_ASSERT_INT_WITHIN(1, 200, p.y);
+
+    /*The area to refresh covers the skewed widget*/
+    lv_area_t a = obj->coords;
+    lv_obj_get_transformed_area(obj, &a, false, false);
+    TEST_ASSERT_INT_WITHIN(1, 100, a.x1);
+    TEST_ASSERT_INT_WITHIN(1, 299 + 99, a.x2);
+}
+
+#endif
@@ -4,6 +4,8 @@
 #include "unity/unity.h"
 #include "lv_test_helpers.h"
 
+#define STRESS_ANIM_CNT 4000
+
 void setUp(void)
 {
     /* Function run before every test */
@@ -90,4 +92,257 @@ void test_anim_delete_custom(void)
     TEST_ASSERT_EQUAL(39, var);
 }
 
+/*Compare the value calculated by the batch with the value returned by the path directly*/
+static void check_path_exec_cb(lv_anim_t * a, int32_t v)
+{
+    int32_t * mismatch_cnt = a->var;
+    /*The start value is applied in the delay too*/
+    if(a->act_time < 0) return;
+
+    if(v != a->path_cb(a)) (*mismatch_cnt)++;
+}
+
+void test_anim_batch_values_match_path(void)
+{
+    static const lv_anim_path_cb_t paths[] = {
+        lv_anim_path_linear, lv_anim_path_ease_in, lv_anim_path_ease_out, lv_anim_path_ease_in_out,
+        lv_anim_path_overshoot, lv_anim_path_bounce, lv_anim_path_step, lv_anim_path_custom_bezier3
+    };
+
+    int32_t mismatch_cnt = 0;
+    uint32_t i;
+    for(i = 0; i < sizeof(paths) / sizeof(paths[0]); i++) {
+        lv_anim_t a;
+        lv_anim_init(&a);
+        lv_anim_set_var(&a, &mismatch_cnt);
+        lv_anim_set_values(&a, -300 + (int32_t)i * 10, 1000);
+        lv_anim_set_custom_exec_cb(&a, check_path_exec_cb);
+        lv_anim_set_path_cb(&a, paths[i]);
+        lv_anim_set_duration(&a, 230 + i * 20);
+        lv_anim_set_delay(&a, i * 5);
+        LV_ANIM_SET_EASE_OUT_BACK(&a);
+        lv_anim_start(&a);
+    }
+
+    for(i = 0; i < 60; i++) {
+        lv_test_wait(7);
+    }
+
+    TEST_ASSERT_EQUAL(0, mismatch_cnt);
+    TEST_ASSERT_EQUAL(0, lv_anim_count_running());
+}
+
+static int32_t * var_to_delete;
+
+static void delete_other_exec_cb(void * var, int32_t v)
+{
+    exec_cb(var, v);
+    lv_anim_delete(var_to_delete, NULL);
+}
+
+void test_anim_delete_other_in_exec_cb(void)
+{
+    int32_t var1 = 0;
+    int32_t var2 = 0;
+    var_to_delete = &var1;
+
+    /*Animations are added to the head of the list, so the second one runs first*/
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, &var1);
+    lv_anim_set_values(&a, 0, 100);
+    lv_anim_set_custom_exec_cb(&a, custom_exec_cb);
+    lv_anim_set_duration(&a, 100);
+    lv_anim_set_early_apply(&a, false);
+    lv_anim_start(&a);
+
+    lv_anim_set_var(&a, &var2);
+    lv_anim_set_custom_exec_cb(&a, NULL);
+    lv_anim_set_exec_cb(&a, delete_other_exec_cb);
+    lv_anim_start(&a);
+
+    lv_test_wait(20);
+    TEST_ASSERT_EQUAL(0, var1);
+    TEST_ASSERT_EQUAL(19, var2);
+    TEST_ASSERT_EQUAL(1, lv_anim_count_running());
+
+    lv_anim_delete(&var2, NULL);
+}
+
+static void start_new_ready_cb(lv_anim_t * a)
+{
+    /*The new animation shouldn't run in the same round*/
+    lv_anim_t a_new;
+    lv_anim_init(&a_new);
+    lv_anim_set_var(&a_new, a->var);
+    lv_anim_set_values(&a_new, 500, 600);
+    lv_anim_set_exec_cb(&a_new, exec_cb);
+    lv_anim_set_duration(&a_new, 100);
+    lv_anim_set_early_apply(&a_new, false);
+    lv_anim_start(&a_new);
+}
+
+void test_anim_start_in_ready_cb(void)
+{
+    int32_t var = 0;
+
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, &var);
+    lv_anim_set_values(&a, 0, 100);
+    lv_anim_set_exec_cb(&a, exec_cb);
+    lv_anim_set_duration(&a, 100);
+    lv_anim_set_ready_cb(&a, start_new_ready_cb);
+    lv_anim_start(&a);
+
+    lv_tick_inc(100);
+    lv_anim_refr_now();
+    TEST_ASSERT_EQUAL(100, var);
+    TEST_ASSERT_EQUAL(1, lv_anim_count_running());
+
+    lv_tick_inc(50);
+    lv_anim_refr_now();
+    TEST_ASSERT_EQUAL(550, var);
+
+    lv_anim_delete(&var, NULL);
+}
+
+static void change_other_exec_cb(void * var, int32_t v)
+{
+    exec_cb(var, v);
+    lv_anim_t * a_other = lv_anim_get(var_to_delete, exec_cb);
+    if(a_other) lv_anim_set_values(a_other, 1000, 1100);
+}
+
+void test_anim_change_other_in_exec_cb(void)
+{
+    int32_t var1 = 0;
+    int32_t var2 = 0;
+    var_to_delete = &var1;
+
+    /*Animations are added to the head of the list, so the second one runs first*/
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, &var1);
+    lv_anim_set_values(&a, 0, 100);
+    lv_anim_set_exec_cb(&a, exec_cb);
+    lv_anim_set_duration(&a, 100);
+    lv_anim_start(&a);
+
+    lv_anim_set_var(&a, &var2);
+    lv_anim_set_exec_cb(&a, change_other_exec_cb);
+    lv_anim_start(&a);
+
+    /*The value of the first animation was calculated before it was changed, but the new values should be used*/
+    lv_tick_inc(20);
+    lv_anim_refr_now();
+    TEST_ASSERT_EQUAL(19, var2);
+    TEST_ASSERT_EQUAL(1019, var1);
+
+    lv_anim_delete(NULL, NULL);
+}
+
+static void refr_now_exec_cb(void * var, int32_t v)
+{
+    static bool in_refr = false;
+
+    exec_cb(var, v);
+    if(in_refr) return;
+
+    /*E.g. `lv_refr_now()` in a callback refreshes the animations too*/
+    in_refr = true;
+    lv_tick_inc(10);
+    lv_anim_refr_now();
+    in_refr = false;
+}
+
+void test_anim_refr_now_in_exec_cb(void)
+{
+    int32_t var1 = 0;
+    int32_t var2 = 0;
+
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, &var1);
+    lv_anim_set_values(&a, 0, 100);
+    lv_anim_set_exec_cb(&a, exec_cb);
+    lv_anim_set_duration(&a, 100);
+    lv_anim_start(&a);
+
+    lv_anim_set_var(&a, &var2);
+    lv_anim_set_exec_cb(&a, refr_now_exec_cb);
+    lv_anim_set_early_apply(&a, false);
+    lv_anim_start(&a);
+
+    /*The nested refresh should step all animations and the outer one shouldn't apply its older values*/
+    lv_tick_inc(20);
+    lv_anim_refr_now();
+    TEST_ASSERT_EQUAL(29, var2);
+    TEST_ASSERT_EQUAL(29, var1);
+    TEST_ASSERT_EQUAL(2, lv_anim_count_running());
+
+    /*Finish the animations in a nested refresh*/
+    lv_tick_inc(60);
+    lv_anim_refr_now();
+    TEST_ASSERT_EQUAL(100, var2);
+    TEST_ASSERT_EQUAL(100, var1);
+    TEST_ASSERT_EQUAL(0, lv_anim_count_running());
+}
+
+/*Run many animations through the batches and check that all of them are stepped and finished*/
+void test_anim_stress(void)
+{
+    static int32_t vars[STRESS_ANIM_CNT];
+    static const lv_anim_path_cb_t paths[] = {
+        lv_anim_path_linear, lv_anim_path_ease_in_out, lv_anim_path_overshoot, lv_anim_path_bounce,
+        lv_anim_path_step, lv_anim_path_custom_bezier3
+    };
+
+    uint32_t i;
+    for(i = 0; i < STRESS_ANIM_CNT; i++) {
+        vars[i] = -1;
+        lv_anim_t a;
+        lv_anim_init(&a);
+        lv_anim_set_var(&a, &vars[i]);
+        lv_anim_set_values(&a, 0, 1000 + (int32_t)i);
+        lv_anim_set_exec_cb(&a, exec_cb);
+        lv_anim_set_path_cb(&a, paths[i % 6]);
+        LV_ANIM_SET_EASE_OUT_BACK(&a);
+        lv_anim_set_duration(&a, 1000 + i % 100);
+        lv_anim_set_early_apply(&a, false);
+        lv_anim_start(&a);
+    }
+    TEST_ASSERT_EQUAL(STRESS_ANIM_CNT, lv_anim_count_running());
+
+    /*Every animation is applied in the first round*/
+    lv_tick_inc(16);
+    lv_anim_refr_now();
+    for(i = 0; i < STRESS_ANIM_CNT; i++) {
+        TEST_ASSERT_NOT_EQUAL(-1, vars[i]);
+    }
+
+    /*None of them is finished before the shortest duration*/
+    for(i = 1; i < 62; i++) {
+        lv_tick_inc(16);
+        lv_anim_refr_now();
+    }
+    TEST_ASSERT_EQUAL(STRESS_ANIM_CNT, lv_anim_count_running());
+
+    /*All of them are finished with the value of their path at the end after the longest duration*/
+    for(i = 0; i < 8; i++) {
+        lv_tick_inc(16);
+        lv_anim_refr_now();
+    }
+    TEST_ASSERT_EQUAL(0, lv_anim_count_running());
+    for(i = 0; i < STRESS_ANIM_CNT; i++) {
+        lv_anim_t a;
+        lv_anim_init(&a);
+        lv_anim_set_values(&a, 0, 1000 + (int32_t)i);
+        LV_ANIM_SET_EASE_OUT_BACK(&a);
+        lv_anim_set_duration(&a, 1000 + i % 100);
+        a.act_time = a.duration;
+        TEST_ASSERT_EQUAL(paths[i % 6](&a), vars[i]);
+    }
+}
+
 #endif
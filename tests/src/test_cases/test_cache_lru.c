@@ -0,0 +1,228 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#include "../../src/misc/lv_cache_lru.h"
+
+#define ENTRY_SIZE  100
+#define MAX_SIZE    (3 * ENTRY_SIZE)
+
+static int32_t values[1000];
+static uint32_t invalidate_cnt;
+static uint32_t compare_cnt;
+static uint32_t data_type;
+
+static bool compare_cb(const void * data1, const void * data2, size_t data_size)
+{
+    LV_UNUSED(data_size);
+    compare_cnt++;
+    return *(const int32_t *)data1 == *(const int32_t *)data2;
+}
+
+static uint32_t hash_cb(const void * data, size_t data_size)
+{
+    LV_UNUSED(data_size);
+    const int32_t * v = data;
+    return (uint32_t)(*v);
+}
+
+static void invalidate_cb(lv_cache_entry_t * entry)
+{
+    LV_UNUSED(entry);
+    invalidate_cnt++;
+}
+
+static lv_cache_entry_t * add_entry(int32_t i, size_t memory_usage)
+{
+    lv_cache_entry_t * entry = lv_cache_add(&values[i], sizeof(int32_t), data_type, memory_usage);
+    TEST_ASSERT_NOT_NULL(entry);
+    entry->src = &values[i];
+    entry->src_type = LV_CACHE_SRC_TYPE_POINTER;
+    entry->compare_cb = compare_cb;
+    entry->invalidate_cb = invalidate_cb;
+    return entry;
+}
+
+static lv_cache_entry_t * find_value(int32_t i)
+{
+    return lv_cache_find_by_src(NULL, &values[i], LV_CACHE_SRC_TYPE_POINTER);
+}
+
+void setUp(void)
+{
+    int32_t i;
+    for(i = 0; i < (int32_t)(sizeof(values) / sizeof(values[0])); i++) values[i] = i;
+    invalidate_cnt = 0;
+
+    lv_cache_lock();
+    lv_cache_manager_t manager;
+    lv_cache_lru_manager_init(&manager);
+    lv_cache_set_manager(&manager);
+    lv_cache_set_max_size(MAX_SIZE);
+    data_type = lv_cache_register_data_type();
+}
+
+void tearDown(void)
+{
+    lv_cache_set_max_size(0);
+    lv_cache_unlock();
+}
+
+void test_cache_lru_find_by_src(void)
+{
+    lv_cache_entry_t * e1 = add_entry(1, ENTRY_SIZE);
+    lv_cache_entry_t * e2 = lv_cache_add(NULL, 0, LV_CACHE_DATA_TYPE_NOT_SET, ENTRY_SIZE);
+    e2->src = "A:path/to/image.png";
+    e2->src_type = LV_CACHE_SRC_TYPE_PATH;
+
+    char path[] = "A:path/to/image.png";
+    TEST_ASSERT_EQUAL_PTR(e1, find_value(1));
+    TEST_ASSERT_NULL(find_value(2));
+    TEST_ASSERT_EQUAL_PTR(e2, lv_cache_find_by_src(NULL, path, LV_CACHE_SRC_TYPE_PATH));
+    TEST_ASSERT_NULL(lv_cache_find_by_src(NULL, "A:other.png", LV_CACHE_SRC_TYPE_PATH));
+    TEST_ASSERT_NULL(lv_cache_find_by_src(NULL, e2->src, LV_CACHE_SRC_TYPE_POINTER));
+
+    lv_cache_invalidate(e1);
+    TEST_ASSERT_NULL(find_value(1));
+    TEST_ASSERT_EQUAL(1, invalidate_cnt);
+}
+
+void test_cache_lru_find_by_data(void)
+{
+    lv_cache_entry_t * e1 = add_entry(1, ENTRY_SIZE);
+    lv_cache_entry_t * e2 = add_entry(2, ENTRY_SIZE);
+
+    int32_t v = 2;
+    TEST_ASSERT_EQUAL_PTR(e2, lv_cache_find_by_data(&v, sizeof(v), data_type));
+    v = 1;
+    TEST_ASSERT_EQUAL_PTR(e1, lv_cache_find_by_data(&v, sizeof(v), data_type));
+    TEST_ASSERT_NULL(lv_cache_find_by_data(&v, sizeof(v), data_type + 1));
+    TEST_ASSERT_NULL(lv_cache_find_by_data(&v, 2, data_type));
+    v = 3;
+    TEST_ASSERT_NULL(lv_cache_find_by_data(&v, sizeof(v), data_type));
+}
+
+void test_cache_lru_drop_least_recently_used(void)
+{
+    add_entry(1, ENTRY_SIZE);
+    lv_cache_entry_t * e2 = add_entry(2, ENTRY_SIZE);
+    add_entry(3, ENTRY_SIZE);
+
+    /*Use 1 so 2 will be the least recently used*/
+    lv_cache_entry_t * e1 = find_value(1);
+    lv_cache_get_data(e1);
+    lv_cache_release(e1);
+
+    add_entry(4, ENTRY_SIZE);
+    TEST_ASSERT_EQUAL(1, invalidate_cnt);
+    TEST_ASSERT_NULL(find_value(2));
+    TEST_ASSERT_NOT_NULL(find_value(1));
+    TEST_ASSERT_NOT_NULL(find_value(3));
+    TEST_ASSERT_NOT_NULL(find_value(4));
+    LV_UNUSED(e2);
+}
+
+void test_cache_lru_keep_used_entries(void)
+{
+    lv_cache_entry_t * e[3];
+    int32_t i;
+    for(i = 0; i < 3; i++) {
+        e[i] = add_entry(i, ENTRY_SIZE);
+        lv_cache_get_data(e[i]);
+    }
+
+    /*Nothing can be dropped so the new entry is temporary*/
+    lv_cache_entry_t * tmp = add_entry(3, ENTRY_SIZE);
+    TEST_ASSERT_TRUE(tmp->temporary);
+    TEST_ASSERT_EQUAL(0, invalidate_cnt);
+    lv_cache_get_data(tmp);
+    lv_cache_release(tmp);
+    TEST_ASSERT_EQUAL(1, invalidate_cnt);
+    TEST_ASSERT_NULL(find_value(3));
+
+    /*The temporary entry shouldn't change the used size, so after releasing
+     *an entry exactly one entry needs to be dropped*/
+    lv_cache_release(e[1]);
+    lv_cache_entry_t * e4 = add_entry(4, ENTRY_SIZE);
+    TEST_ASSERT_FALSE(e4->temporary);
+    TEST_ASSERT_EQUAL(2, invalidate_cnt);
+    TEST_ASSERT_NULL(find_value(1));
+
+    lv_cache_release(e[0]);
+    lv_cache_release(e[2]);
+}
+
+void test_cache_lru_many_entries(void)
+{
+    lv_cache_set_max_size(1000 * ENTRY_SIZE);
+
+    int32_t i;
+    for(i = 0; i < 1000; i++) add_entry(i, ENTRY_SIZE);
+
+    for(i = 0; i < 1000; i++) {
+        lv_cache_entry_t * entry = find_value(i);
+        TEST_ASSERT_NOT_NULL(entry);
+        TEST_ASSERT_EQUAL_PTR(&values[i], entry->data);
+        TEST_ASSERT_EQUAL_PTR(entry, lv_cache_find_by_data(&i, sizeof(i), data_type));
+    }
+
+    /*Shrinking drops the least recently used entries*/
+    lv_cache_set_max_size(10 * ENTRY_SIZE);
+    TEST_ASSERT_EQUAL(990, invalidate_cnt);
+    TEST_ASSERT_NULL(find_value(989));
+    TEST_ASSERT_NOT_NULL(find_value(990));
+    TEST_ASSERT_NOT_NULL(find_value(999));
+}
+
+void test_cache_lru_find_by_hashed_data(void)
+{
+    lv_cache_set_data_hash_cb(data_type, hash_cb);
+    lv_cache_set_max_size(1000 * ENTRY_SIZE);
+
+    int32_t i;
+    for(i = 0; i < 1000; i++) add_entry(i, ENTRY_SIZE);
+
+    compare_cnt = 0;
+    for(i = 0; i < 1000; i++) {
+        lv_cache_entry_t * entry = lv_cache_find_by_data(&i, sizeof(i), data_type);
+        TEST_ASSERT_NOT_NULL(entry);
+        TEST_ASSERT_EQUAL_PTR(&values[i], entry->data);
+    }
+
+    /*Only the entries with the same hash are compared, not all the entries of the data type*/
+    TEST_ASSERT_LESS_OR_EQUAL(1000, compare_cnt);
+
+    i = 1000;
+    TEST_ASSERT_NULL(lv_cache_find_by_data(&i, sizeof(i), data_type));
+
+    lv_cache_set_data_hash_cb(data_type, NULL);
+}
+
+void test_cache_lru_invalidate_by_src(void)
+{
+    lv_cache_set_max_size(10 * ENTRY_SIZE);
+
+    /*Several entries can belong to the same source, e.g. glyphs of a font*/
+    int32_t i;
+    for(i = 0; i < 5; i++) {
+        lv_cache_entry_t * entry = add_entry(i, ENTRY_SIZE);
+        entry->src = &values[0];
+    }
+    add_entry(5, ENTRY_SIZE);
+
+    uint32_t cnt = 0;
+    lv_cache_entry_t * entry = find_value(0);
+    while(entry) {
+        cnt++;
+        entry = lv_cache_find_by_src(entry, &values[0], LV_CACHE_SRC_TYPE_POINTER);
+    }
+    TEST_ASSERT_EQUAL(5, cnt);
+
+    lv_cache_invalidate_by_src(&values[0], LV_CACHE_SRC_TYPE_POINTER);
+    TEST_ASSERT_EQUAL(5, invalidate_cnt);
+    TEST_ASSERT_NULL(find_value(0));
+    TEST_ASSERT_NOT_NULL(find_value(5));
+}
+
+#endif
@@ -0,0 +1,179 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_OS == LV_OS_PTHREAD
+#include <sched.h>
+#endif
+
+#define HOR_RES     128
+#define VER_RES     100
+#define BUF_ROWS    10
+#define BUF_CNT     3
+#define BUF_SIZE    (HOR_RES * BUF_ROWS * 2)
+#define QUEUE_SIZE  32
+
+static uint8_t bufs[BUF_CNT][BUF_SIZE];
+static uint8_t * queued_bufs[QUEUE_SIZE];
+static lv_area_t queued_areas[QUEUE_SIZE];
+static volatile uint32_t queue_cnt;
+static volatile uint32_t finished_cnt;
+static uint32_t wait_cnt;
+static uint32_t max_pending;
+static bool sync_flush;
+
+static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map)
+{
+    TEST_ASSERT_LESS_THAN(QUEUE_SIZE, queue_cnt);
+    queued_bufs[queue_cnt] = px_map;
+    queued_areas[queue_cnt] = *area;
+    queue_cnt++;
+
+    uint32_t pending = lv_display_get_flush_pending_count(disp);
+    if(pending > max_pending) max_pending = pending;
+
+    if(sync_flush) {
+        finished_cnt++;
+        lv_display_flush_ready(disp);
+    }
+}
+
+/*Simulate the end of a DMA transfer of the oldest queued buffer*/
+static void flush_wait_cb(lv_display_t * disp)
+{
+    /*Without the buffer ring it's called even if the flushing is ready*/
+    if(finished_cnt == queue_cnt) return;
+
+    wait_cnt++;
+    finished_cnt++;
+    lv_display_flush_ready(disp);
+}
+
+static lv_display_t * disp;
+
+void setUp(void)
+{
+    /* Function run before every test */
+    disp = lv_display_create(HOR_RES, VER_RES);
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565);
+    lv_display_set_flush_cb(disp, flush_cb);
+    lv_display_set_flush_wait_cb(disp, flush_wait_cb);
+
+    void * ring[BUF_CNT] = {bufs[0], bufs[1], bufs[2]};
+    lv_display_set_draw_buffer_ring(disp, ring, BUF_CNT, BUF_SIZE);
+
+    queue_cnt = 0;
+    finished_cnt = 0;
+    wait_cnt = 0;
+    max_pending = 0;
+    sync_flush = false;
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    while(finished_cnt < queue_cnt) flush_wait_cb(disp);
+    lv_display_delete(disp);
+}
+
+void test_display_buf_ring_render_while_flushing(void)
+{
+    lv_obj_set_style_bg_color(lv_display_get_screen_active(disp), lv_color_hex(0xff0000), 0);
+    lv_refr_now(disp);
+
+    /*The whole screen is rendered in 10 rows high parts*/
+    TEST_ASSERT_EQUAL(VER_RES / BUF_ROWS, queue_cnt);
+    uint32_t i;
+    for(i = 0; i < queue_cnt; i++) {
+        TEST_ASSERT_EQUAL_PTR(bufs[i % BUF_CNT], queued_bufs[i]);
+        TEST_ASSERT_EQUAL(i * BUF_ROWS, queued_areas[i].y1);
+        TEST_ASSERT_EQUAL(i * BUF_ROWS + BUF_ROWS - 1, queued_areas[i].y2);
+    }
+
+    /*LVGL waited only when all buffers were in the flush queue*/
+    TEST_ASSERT_EQUAL(BUF_CNT, max_pending);
+    TEST_ASSERT_EQUAL(queue_cnt - BUF_CNT, wait_cnt);
+    TEST_ASSERT_EQUAL(BUF_CNT, lv_display_get_flush_pending_count(disp));
+
+    /*The content of the queued buffers is not overwritten*/
+    for(i = queue_cnt - BUF_CNT; i < queue_cnt; i++) {
+        uint16_t * px = (uint16_t *)queued_bufs[i];
+        TEST_ASSERT_EQUAL_HEX16(0xf800, px[0]);
+        TEST_ASSERT_EQUAL_HEX16(0xf800, px[HOR_RES * BUF_ROWS - 1]);
+    }
+}
+
+void test_display_buf_ring_sync_driver(void)
+{
+    sync_flush = true;
+    lv_obj_invalidate(lv_display_get_screen_active(disp));
+    lv_refr_now(disp);
+
+    TEST_ASSERT_EQUAL(VER_RES / BUF_ROWS, queue_cnt);
+    TEST_ASSERT_EQUAL(0, wait_cnt);
+    TEST_ASSERT_EQUAL(0, lv_display_get_flush_pending_count(disp));
+}
+
+void test_display_buf_ring_leave_pipelined_mode(void)
+{
+    sync_flush = true;
+    lv_display_set_draw_buffers(disp, bufs[0], NULL, BUF_SIZE, LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_obj_invalidate(lv_display_get_screen_active(disp));
+    lv_refr_now(disp);
+
+    TEST_ASSERT_EQUAL(VER_RES / BUF_ROWS, queue_cnt);
+    uint32_t i;
+    for(i = 0; i < queue_cnt; i++) {
+        TEST_ASSERT_EQUAL_PTR(bufs[0], queued_bufs[i]);
+    }
+}
+
+#if LV_USE_OS == LV_OS_PTHREAD
+static volatile bool dma_stop;
+
+/*Finish the queued buffers one by one in an other thread like a DMA interrupt would do*/
+static void dma_thread_cb(void * user_data)
+{
+    LV_UNUSED(user_data);
+    while(!dma_stop) {
+        if(finished_cnt < queue_cnt) {
+            finished_cnt++;
+            lv_display_flush_ready(disp);
+        }
+        else {
+            sched_yield();
+        }
+    }
+}
+#endif
+
+void test_display_buf_ring_wait_for_flush_ready_without_wait_cb(void)
+{
+#if LV_USE_OS == LV_OS_PTHREAD
+    /*LVGL sleeps until `lv_display_flush_ready()` is called from the other thread*/
+    lv_display_set_flush_wait_cb(disp, NULL);
+    dma_stop = false;
+    lv_thread_t dma_thread;
+    lv_thread_init(&dma_thread, LV_THREAD_PRIO_MID, dma_thread_cb, 8 * 1024, NULL);
+
+    lv_obj_invalidate(lv_display_get_screen_active(disp));
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL(VER_RES / BUF_ROWS, queue_cnt);
+    TEST_ASSERT_LESS_OR_EQUAL(BUF_CNT, max_pending);
+
+    /*Without the buffer ring too*/
+    while(finished_cnt < queue_cnt) sched_yield();
+    lv_display_set_draw_buffers(disp, bufs[0], NULL, BUF_SIZE, LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_obj_invalidate(lv_display_get_screen_active(disp));
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL(2 * VER_RES / BUF_ROWS, queue_cnt);
+
+    while(finished_cnt < queue_cnt) sched_yield();
+    dma_stop = true;
+    lv_thread_delete(&dma_thread);
+    TEST_ASSERT_EQUAL(0, lv_display_get_flush_pending_count(disp));
+#endif
+}
+
+#endif
@@ -0,0 +1,120 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+}
+
+#if LV_USE_DRAW_ARENA
+static int32_t dispatch_cb(lv_draw_unit_t * draw_unit, lv_layer_t * layer)
+{
+    LV_UNUSED(draw_unit);
+    LV_UNUSED(layer);
+    return 0;
+}
+
+/*A draw unit which doesn't take any tasks, only its arena is used*/
+static lv_draw_unit_t * create_unit(void)
+{
+    lv_draw_unit_t * u = lv_draw_create_unit(sizeof(lv_draw_unit_t));
+    u->dispatch_cb = dispatch_cb;
+    return u;
+}
+#endif
+
+void test_draw_arena_reuse_freed_buffers(void)
+{
+#if LV_USE_DRAW_ARENA
+    lv_draw_unit_t * u = create_unit();
+
+    uint8_t * a = lv_draw_arena_alloc(u, 100);
+    uint8_t * b = lv_draw_arena_alloc(u, 200);
+    TEST_ASSERT_NOT_NULL(a);
+    TEST_ASSERT_TRUE(b > a);
+    lv_memset(a, 0xaa, 100);
+    lv_memset(b, 0xbb, 200);
+    TEST_ASSERT_EACH_EQUAL_UINT8(0xaa, a, 100);
+
+    /*Freed in reverse order*/
+    lv_draw_arena_free(u, b);
+    lv_draw_arena_free(u, a);
+    TEST_ASSERT_EQUAL_PTR(a, lv_draw_arena_alloc(u, 50));
+
+    /*Not in reverse order: `a` can be reused only when `c` is freed too*/
+    b = lv_draw_arena_alloc(u, 200);
+    lv_draw_arena_free(u, a);
+    uint8_t * c = lv_draw_arena_alloc(u, 10);
+    TEST_ASSERT_TRUE(c > b);
+    lv_draw_arena_free(u, b);
+    lv_draw_arena_free(u, c);
+    TEST_ASSERT_EQUAL_PTR(a, lv_draw_arena_alloc(u, 10));
+    lv_draw_arena_free(u, a);
+
+    lv_draw_arena_info_t info;
+    lv_draw_arena_get_info(u, &info);
+    TEST_ASSERT_EQUAL(LV_DRAW_ARENA_SIZE, info.size);
+    TEST_ASSERT_EQUAL(0, info.overflow_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL(300, info.peak);
+#endif
+}
+
+void test_draw_arena_overflow_to_heap(void)
+{
+#if LV_USE_DRAW_ARENA
+    lv_draw_unit_t * u = create_unit();
+
+    uint8_t * a = lv_draw_arena_alloc(u, LV_DRAW_ARENA_SIZE / 2);
+    uint8_t * b = lv_draw_arena_alloc(u, LV_DRAW_ARENA_SIZE);
+    TEST_ASSERT_NOT_NULL(b);
+    lv_memset(b, 0xbb, LV_DRAW_ARENA_SIZE);
+
+    /*Still fits into the arena*/
+    uint8_t * c = lv_draw_arena_alloc(u, 100);
+    TEST_ASSERT_TRUE(c > a && c < a + LV_DRAW_ARENA_SIZE);
+
+    lv_draw_arena_info_t info;
+    lv_draw_arena_get_info(u, &info);
+    TEST_ASSERT_EQUAL(1, info.overflow_cnt);
+    TEST_ASSERT_GREATER_THAN(LV_DRAW_ARENA_SIZE + LV_DRAW_ARENA_SIZE / 2, info.peak);
+
+    lv_draw_arena_free(u, b);
+    lv_draw_arena_free(u, c);
+    lv_draw_arena_free(u, a);
+    TEST_ASSERT_EQUAL_PTR(a, lv_draw_arena_alloc(u, LV_DRAW_ARENA_SIZE / 2));
+    lv_draw_arena_free(u, a);
+#endif
+}
+
+void test_draw_arena_frame_peak(void)
+{
+#if LV_USE_DRAW_ARENA
+    lv_draw_unit_t * u = create_unit();
+
+    void * a = lv_draw_arena_alloc(u, 1000);
+    lv_draw_arena_free(u, a);
+
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+
+    lv_draw_arena_info_t info;
+    lv_draw_arena_get_info(u, &info);
+    TEST_ASSERT_GREATER_OR_EQUAL(1000, info.last_frame_peak);
+
+    /*Nothing was allocated in the next frame*/
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    lv_draw_arena_get_info(u, &info);
+    TEST_ASSERT_EQUAL(0, info.last_frame_peak);
+    TEST_ASSERT_GREATER_OR_EQUAL(1000, info.peak);
+#endif
+}
+
+#endif
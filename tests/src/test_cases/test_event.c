@@ -23,4 +23,66 @@ void test_event_object_deletion(void)
     lv_obj_send_event(obj, LV_EVENT_VALUE_CHANGED, NULL);
 }
 
+static uint32_t cb_calls[4];
+
+static void counter_event_cb(lv_event_t * e)
+{
+    uint32_t * cnt = lv_event_get_user_data(e);
+    (*cnt)++;
+}
+
+/* Callbacks are called only for their event code, in the order they were added */
+void test_event_filter_and_remove(void)
+{
+    lv_memzero(cb_calls, sizeof(cb_calls));
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_add_event_cb(obj, counter_event_cb, LV_EVENT_CLICKED, &cb_calls[0]);
+    lv_obj_add_event_cb(obj, counter_event_cb, LV_EVENT_ALL, &cb_calls[1]);
+    lv_obj_add_event_cb(obj, counter_event_cb, LV_EVENT_VALUE_CHANGED | LV_EVENT_PREPROCESS, &cb_calls[2]);
+    /*Same `code % 64` as LV_EVENT_CLICKED*/
+    lv_obj_add_event_cb(obj, counter_event_cb, LV_EVENT_CLICKED + 64, &cb_calls[3]);
+
+    lv_obj_send_event(obj, LV_EVENT_CLICKED, NULL);
+    lv_obj_send_event(obj, LV_EVENT_VALUE_CHANGED, NULL);
+    TEST_ASSERT_EQUAL(1, cb_calls[0]);
+    TEST_ASSERT_EQUAL(2, cb_calls[1]);
+    TEST_ASSERT_EQUAL(1, cb_calls[2]);
+    TEST_ASSERT_EQUAL(0, cb_calls[3]);
+
+    /*Remove the LV_EVENT_ALL callback*/
+    TEST_ASSERT_EQUAL_PTR(&cb_calls[1], lv_event_dsc_get_user_data(lv_obj_get_event_dsc(obj, 1)));
+    TEST_ASSERT_TRUE(lv_obj_remove_event(obj, 1));
+    TEST_ASSERT_EQUAL(3, lv_obj_get_event_count(obj));
+    TEST_ASSERT_EQUAL_PTR(&cb_calls[2], lv_event_dsc_get_user_data(lv_obj_get_event_dsc(obj, 1)));
+
+    lv_obj_send_event(obj, LV_EVENT_CLICKED, NULL);
+    lv_obj_send_event(obj, LV_EVENT_PRESSED, NULL);
+    TEST_ASSERT_EQUAL(2, cb_calls[0]);
+    TEST_ASSERT_EQUAL(2, cb_calls[1]);
+
+    lv_obj_delete(obj);
+}
+
+void test_event_stats(void)
+{
+#if LV_USE_EVENT_STATS
+    lv_memzero(cb_calls, sizeof(cb_calls));
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_add_event_cb(obj, counter_event_cb, LV_EVENT_REFRESH, &cb_calls[0]);
+
+    lv_event_reset_stats();
+    lv_obj_send_event(obj, LV_EVENT_REFRESH, NULL);
+    lv_obj_send_event(obj, LV_EVENT_REFRESH, NULL);
+    lv_obj_send_event(obj, LV_EVENT_READY, NULL);
+
+    const lv_event_stats_t * stats = lv_event_get_stats();
+    TEST_ASSERT_EQUAL(2, stats->sent_cnt[LV_EVENT_REFRESH]);
+    TEST_ASSERT_EQUAL(2, stats->handled_cnt[LV_EVENT_REFRESH]);
+    TEST_ASSERT_EQUAL(1, stats->sent_cnt[LV_EVENT_READY]);
+    TEST_ASSERT_EQUAL(0, stats->handled_cnt[LV_EVENT_READY]);
+
+    lv_obj_delete(obj);
+#endif
+}
+
 #endif
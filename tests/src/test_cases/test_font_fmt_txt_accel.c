@@ -0,0 +1,301 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+LV_FONT_DECLARE(test_font_montserrat_ascii_1bpp);
+LV_FONT_DECLARE(test_font_montserrat_ascii_2bpp);
+LV_FONT_DECLARE(test_font_montserrat_ascii_4bpp);
+
+static uint8_t bitmap_act[128 * 64];
+static uint8_t bitmap_ref[128 * 64];
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+}
+
+/*Reference: convert the glyph pixel by pixel*/
+static void unpack_ref(const lv_font_fmt_txt_dsc_t * fdsc, const lv_font_fmt_txt_glyph_dsc_t * gdsc)
+{
+    const uint8_t * in = &fdsc->glyph_bitmap[gdsc->bitmap_index];
+    uint32_t stride = lv_draw_buf_width_to_stride(gdsc->box_w, LV_COLOR_FORMAT_A8);
+    uint32_t bpp = fdsc->bpp;
+    uint32_t mask = (1 << bpp) - 1;
+    uint32_t bit_pos = 0;
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < gdsc->box_h; y++) {
+        for(x = 0; x < gdsc->box_w; x++) {
+            uint32_t v = (in[bit_pos >> 3] >> (8 - bpp - (bit_pos & 0x7))) & mask;
+            bitmap_ref[y * stride + x] = (uint8_t)(v * 255 / mask);
+            bit_pos += bpp;
+        }
+    }
+}
+
+static void check_glyph_bitmap(const lv_font_t * font, uint32_t letter, uint32_t gid)
+{
+    const lv_font_fmt_txt_dsc_t * fdsc = font->dsc;
+    const lv_font_fmt_txt_glyph_dsc_t * gdsc = &fdsc->glyph_dsc[gid];
+    uint32_t stride = lv_draw_buf_width_to_stride(gdsc->box_w, LV_COLOR_FORMAT_A8);
+    if(gdsc->box_w == 0 || gdsc->box_h == 0) return;
+    TEST_ASSERT_LESS_OR_EQUAL(sizeof(bitmap_act), stride * gdsc->box_h);
+
+    lv_memset(bitmap_ref, 0xAA, sizeof(bitmap_ref));
+    lv_memset(bitmap_act, 0xAA, sizeof(bitmap_act));
+    unpack_ref(fdsc, gdsc);
+    TEST_ASSERT_EQUAL_PTR(bitmap_act, lv_font_get_glyph_bitmap(font, letter, bitmap_act));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(bitmap_ref, bitmap_act, stride * gdsc->box_h);
+}
+
+/*Check all glyphs of the simple and sparse cmaps*/
+static void check_unpack(const lv_font_t * font)
+{
+    const lv_font_fmt_txt_dsc_t * fdsc = font->dsc;
+    uint32_t i;
+    for(i = 0; i < fdsc->cmap_num; i++) {
+        const lv_font_fmt_txt_cmap_t * cmap = &fdsc->cmaps[i];
+        uint32_t k;
+        if(cmap->type == LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY) {
+            for(k = 0; k < cmap->range_length; k++) {
+                check_glyph_bitmap(font, cmap->range_start + k, cmap->glyph_id_start + k);
+            }
+        }
+        else if(cmap->type == LV_FONT_FMT_TXT_CMAP_SPARSE_TINY) {
+            for(k = 0; k < cmap->list_length; k++) {
+                check_glyph_bitmap(font, cmap->range_start + cmap->unicode_list[k], cmap->glyph_id_start + k);
+            }
+        }
+    }
+}
+
+void test_font_fmt_txt_unpack_1bpp(void)
+{
+    check_unpack(&test_font_montserrat_ascii_1bpp);
+}
+
+void test_font_fmt_txt_unpack_2bpp(void)
+{
+    check_unpack(&test_font_montserrat_ascii_2bpp);
+}
+
+void test_font_fmt_txt_unpack_4bpp(void)
+{
+    check_unpack(&test_font_montserrat_ascii_4bpp);
+    check_unpack(&lv_font_montserrat_14);
+    check_unpack(&lv_font_simsun_16_cjk);
+}
+
+static void check_glyph_ids(const lv_font_t * font, uint32_t letter_start, uint32_t letter_end)
+{
+    static lv_font_glyph_dsc_t ref[0x1000];
+    static bool found[0x1000];
+    TEST_ASSERT_LESS_THAN(0x1000, letter_end - letter_start);
+
+    /*Fill the lookup table. The letters are 256 apart in the same slot so most
+     *letters replace an other letter in the table.*/
+    lv_font_fmt_txt_cache_invalidate(font);
+    uint32_t letter;
+    for(letter = letter_start; letter <= letter_end; letter++) {
+        found[letter - letter_start] = lv_font_get_glyph_dsc(font, &ref[letter - letter_start], letter, 0);
+    }
+
+    /*Read it in reverse order to mix found and replaced slots*/
+    int32_t i;
+    for(i = letter_end - letter_start; i >= 0; i--) {
+        letter = letter_start + i;
+        lv_font_glyph_dsc_t g;
+        bool f = lv_font_get_glyph_dsc(font, &g, letter, 0);
+        TEST_ASSERT_EQUAL(found[letter - letter_start], f);
+        if(!f) continue;
+        TEST_ASSERT_EQUAL(ref[letter - letter_start].adv_w, g.adv_w);
+        TEST_ASSERT_EQUAL(ref[letter - letter_start].box_w, g.box_w);
+        TEST_ASSERT_EQUAL(ref[letter - letter_start].box_h, g.box_h);
+        TEST_ASSERT_EQUAL(ref[letter - letter_start].ofs_x, g.ofs_x);
+        TEST_ASSERT_EQUAL(ref[letter - letter_start].ofs_y, g.ofs_y);
+    }
+}
+
+void test_font_fmt_txt_glyph_id_lookup(void)
+{
+    check_glyph_ids(&lv_font_montserrat_14, 0x0, 0x7FF);
+    check_glyph_ids(&lv_font_montserrat_14, 0xF000, 0xF8FF);
+    check_glyph_ids(&lv_font_simsun_16_cjk, 0x4E00, 0x4FFF);
+}
+
+/*A font with 40 glyphs from U+0100 and kerning pairs whose glyph IDs are 16 apart
+ *to use the same slots of the kerning table*/
+static const uint8_t kern_glyph_bitmap[] = {0};
+
+static lv_font_fmt_txt_glyph_dsc_t kern_glyph_dsc[41];
+
+static const lv_font_fmt_txt_cmap_t kern_cmaps[] = {
+    {
+        .range_start = 0x100, .range_length = 40, .glyph_id_start = 1,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    }
+};
+
+static const uint8_t kern_pair_glyph_ids[] = {
+    1, 2,
+    1, 18,
+    17, 2,
+    17, 18,
+    33, 34,
+};
+
+static const int8_t kern_pair_values[] = {-3, 5, 7, -9, 2};
+
+static const lv_font_fmt_txt_kern_pair_t kern_pairs = {
+    .glyph_ids = kern_pair_glyph_ids,
+    .values = kern_pair_values,
+    .pair_cnt = 5,
+    .glyph_ids_size = 0
+};
+
+static const lv_font_fmt_txt_dsc_t kern_font_dsc = {
+    .glyph_bitmap = kern_glyph_bitmap,
+    .glyph_dsc = kern_glyph_dsc,
+    .cmaps = kern_cmaps,
+    .kern_dsc = &kern_pairs,
+    .kern_scale = 256,      /*The kerning values are in pixels*/
+    .cmap_num = 1,
+    .bpp = 4,
+    .kern_classes = 0,
+    .bitmap_format = 0,
+};
+
+static const lv_font_t kern_font = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,
+    .line_height = 10,
+    .base_line = 0,
+    .dsc = &kern_font_dsc
+};
+
+static int32_t get_adv_w(uint32_t gid_left, uint32_t gid_right)
+{
+    lv_font_glyph_dsc_t g;
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(&kern_font, &g, 0xFF + gid_left, 0xFF + gid_right));
+    return g.adv_w;
+}
+
+void test_font_fmt_txt_kern_pair_lookup(void)
+{
+    uint32_t i;
+    for(i = 1; i < 41; i++) kern_glyph_dsc[i].adv_w = 160;     /*10 px*/
+
+    lv_font_fmt_txt_cache_invalidate(&kern_font);
+
+    uint32_t round;
+    for(round = 0; round < 2; round++) {
+        TEST_ASSERT_EQUAL(10 - 3, get_adv_w(1, 2));
+        TEST_ASSERT_EQUAL(10 + 5, get_adv_w(1, 18));
+        TEST_ASSERT_EQUAL(10 + 7, get_adv_w(17, 2));
+        TEST_ASSERT_EQUAL(10 - 9, get_adv_w(17, 18));
+        TEST_ASSERT_EQUAL(10 + 2, get_adv_w(33, 34));
+        TEST_ASSERT_EQUAL(10, get_adv_w(33, 2));
+        TEST_ASSERT_EQUAL(10, get_adv_w(2, 1));
+        TEST_ASSERT_EQUAL(10, get_adv_w(40, 40));
+    }
+
+    lv_font_fmt_txt_cache_invalidate(&kern_font);
+}
+
+/*Reference: find the glyph ID by walking all character maps linearly*/
+static uint32_t ref_glyph_id(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t letter)
+{
+    uint32_t i;
+    for(i = 0; i < fdsc->cmap_num; i++) {
+        const lv_font_fmt_txt_cmap_t * cmap = &fdsc->cmaps[i];
+        uint32_t rcp = letter - cmap->range_start;
+        if(letter < cmap->range_start || rcp >= cmap->range_length) continue;
+
+        if(cmap->type == LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY) {
+            return cmap->glyph_id_start + rcp;
+        }
+        else if(cmap->type == LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL) {
+            const uint8_t * gid_ofs_8 = cmap->glyph_id_ofs_list;
+            return cmap->glyph_id_start + gid_ofs_8[rcp];
+        }
+
+        uint32_t k;
+        for(k = 0; k < cmap->list_length; k++) {
+            if(cmap->unicode_list[k] != rcp) continue;
+            if(cmap->type == LV_FONT_FMT_TXT_CMAP_SPARSE_TINY) return cmap->glyph_id_start + k;
+
+            const uint16_t * gid_ofs_16 = cmap->glyph_id_ofs_list;
+            return cmap->glyph_id_start + gid_ofs_16[k];
+        }
+    }
+
+    return 0;
+}
+
+/*Look up the glyphs of a text twice, to use the filled tables too,
+ *and compare them with the linear search. Return the number of found glyphs.*/
+static uint32_t check_text_glyphs(const lv_font_t * font, const char * txt)
+{
+    const lv_font_fmt_txt_dsc_t * fdsc = font->dsc;
+    uint32_t found_cnt = 0;
+    uint32_t ref_found_cnt = 0;
+    uint32_t round;
+    lv_font_fmt_txt_cache_invalidate(font);
+    for(round = 0; round < 2; round++) {
+        uint32_t i = 0;
+        while(txt[i]) {
+            uint32_t letter = _lv_text_encoded_next(txt, &i);
+            uint32_t gid = ref_glyph_id(fdsc, letter);
+            lv_font_glyph_dsc_t g;
+            bool found = lv_font_get_glyph_dsc_fmt_txt(font, &g, letter, 0);
+            TEST_ASSERT_EQUAL(gid != 0, found);
+            if(gid) ref_found_cnt++;
+            if(!found) continue;
+
+            found_cnt++;
+            const lv_font_fmt_txt_glyph_dsc_t * gdsc = &fdsc->glyph_dsc[gid];
+            TEST_ASSERT_EQUAL((gdsc->adv_w + 8) >> 4, g.adv_w);
+            TEST_ASSERT_EQUAL(gdsc->box_w, g.box_w);
+            TEST_ASSERT_EQUAL(gdsc->box_h, g.box_h);
+            TEST_ASSERT_EQUAL(gdsc->ofs_x, g.ofs_x);
+            TEST_ASSERT_EQUAL(gdsc->ofs_y, g.ofs_y);
+            check_glyph_bitmap(font, letter, gid);
+        }
+    }
+
+    TEST_ASSERT_EQUAL(ref_found_cnt, found_cnt);
+    return found_cnt / 2;
+}
+
+void test_font_fmt_txt_text_glyphs(void)
+{
+    static const char * txt_latin =
+        "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore "
+        "et dolore magna aliqua. AVATAR Type Wave LT Tj Yo";
+
+    static const char * txt_cjk =
+        "嵌入式图形库是一个免费的开源图形库，提供创建嵌入式图形界面所需的一切，"
+        "具有易于使用的图形元素，精美的视觉效果和低内存占用。";
+
+    uint32_t latin_len = lv_strlen(txt_latin);
+    uint32_t cjk_len = _lv_text_get_encoded_length(txt_cjk);
+
+    TEST_ASSERT_EQUAL(latin_len, check_text_glyphs(&lv_font_montserrat_14, txt_latin));
+    TEST_ASSERT_EQUAL(latin_len, check_text_glyphs(&test_font_montserrat_ascii_2bpp, txt_latin));
+    /*The font has only a subset of the CJK characters*/
+    uint32_t cjk_found_cnt = check_text_glyphs(&lv_font_simsun_16_cjk, txt_cjk);
+    TEST_ASSERT_GREATER_THAN(cjk_len / 2, cjk_found_cnt);
+    TEST_ASSERT_LESS_OR_EQUAL(cjk_len, cjk_found_cnt);
+    TEST_ASSERT_EQUAL(latin_len, check_text_glyphs(&lv_font_simsun_16_cjk, txt_latin));
+
+    /*Only the punctuation of the CJK text might be in Montserrat*/
+    TEST_ASSERT_LESS_THAN(cjk_len, check_text_glyphs(&lv_font_montserrat_14, txt_cjk));
+}
+
+#endif
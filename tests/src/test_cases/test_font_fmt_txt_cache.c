@@ -0,0 +1,53 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_font_fmt_txt_cache_hit_after_first_draw(void)
+{
+#if LV_FONT_FMT_TXT_CACHE_SIZE > 0
+    lv_obj_t * label = lv_label_create(lv_screen_active());
+    lv_obj_set_style_text_font(label, &lv_font_montserrat_28_compressed, 0);
+    lv_label_set_text(label, "Hello hello");
+
+    lv_font_fmt_txt_cache_invalidate(NULL);
+    lv_font_fmt_txt_cache_reset_counters();
+    lv_refr_now(NULL);
+
+    /*Each different letter is converted once*/
+    lv_font_fmt_txt_cache_info_t info;
+    lv_font_fmt_txt_cache_get_info(&info);
+    TEST_ASSERT_EQUAL(5, info.miss_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL(5, info.hit_cnt);
+    TEST_ASSERT_EQUAL(5, info.entry_cnt);
+    TEST_ASSERT_GREATER_THAN(0, info.cur_size);
+    TEST_ASSERT_LESS_OR_EQUAL(LV_FONT_FMT_TXT_CACHE_SIZE, info.cur_size);
+
+    /*Redrawing uses only the cache.
+     *(A letter might be drawn more times if the label is drawn in more parts)*/
+    lv_font_fmt_txt_cache_reset_counters();
+    lv_obj_invalidate(label);
+    lv_refr_now(NULL);
+    lv_font_fmt_txt_cache_get_info(&info);
+    TEST_ASSERT_EQUAL(0, info.miss_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL(10, info.hit_cnt);
+
+    lv_font_fmt_txt_cache_invalidate(&lv_font_montserrat_28_compressed);
+    lv_font_fmt_txt_cache_get_info(&info);
+    TEST_ASSERT_EQUAL(0, info.entry_cnt);
+    TEST_ASSERT_EQUAL(0, info.cur_size);
+#endif
+}
+
+#endif
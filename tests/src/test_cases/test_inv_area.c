@@ -0,0 +1,124 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+static lv_area_t flushed_areas[64];
+static uint32_t flush_cnt;
+
+static void flush_start_event_cb(lv_event_t * e);
+
+void setUp(void)
+{
+    /* Function run before every test */
+    lv_refr_now(NULL);
+    flush_cnt = 0;
+    lv_display_add_event_cb(lv_display_get_default(), flush_start_event_cb, LV_EVENT_FLUSH_START, NULL);
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_display_t * disp = lv_display_get_default();
+    lv_display_delete_event(disp, lv_display_get_event_count(disp) - 1);
+}
+
+static void flush_start_event_cb(lv_event_t * e)
+{
+    if(flush_cnt < sizeof(flushed_areas) / sizeof(flushed_areas[0])) {
+        flushed_areas[flush_cnt] = *(lv_area_t *)lv_event_get_param(e);
+    }
+    flush_cnt++;
+}
+
+static void inv_area(int32_t x1, int32_t y1, int32_t x2, int32_t y2)
+{
+    lv_area_t a;
+    lv_area_set(&a, x1, y1, x2, y2);
+    _lv_inv_area(NULL, &a);
+}
+
+static uint32_t get_flushed_size(void)
+{
+    uint32_t size = 0;
+    uint32_t i;
+    for(i = 0; i < flush_cnt; i++) size += lv_area_get_size(&flushed_areas[i]);
+    return size;
+}
+
+static void assert_no_overlap(void)
+{
+    uint32_t i;
+    uint32_t j;
+    for(i = 0; i < flush_cnt; i++) {
+        for(j = i + 1; j < flush_cnt; j++) {
+            TEST_ASSERT_FALSE(_lv_area_is_on(&flushed_areas[i], &flushed_areas[j]));
+        }
+    }
+}
+
+void test_inv_area_join_close_areas(void)
+{
+    inv_area(100, 100, 109, 109);
+    inv_area(100, 115, 109, 124);
+    lv_refr_now(NULL);
+
+    TEST_ASSERT_EQUAL(1, flush_cnt);
+    TEST_ASSERT_EQUAL(100, flushed_areas[0].x1);
+    TEST_ASSERT_EQUAL(100, flushed_areas[0].y1);
+    TEST_ASSERT_EQUAL(109, flushed_areas[0].x2);
+    TEST_ASSERT_EQUAL(124, flushed_areas[0].y2);
+}
+
+void test_inv_area_keep_far_areas(void)
+{
+    inv_area(0, 0, 9, 9);
+    inv_area(700, 400, 709, 409);
+    lv_refr_now(NULL);
+
+    TEST_ASSERT_EQUAL(2, flush_cnt);
+    TEST_ASSERT_EQUAL(200, get_flushed_size());
+}
+
+void test_inv_area_drop_covered_areas(void)
+{
+    inv_area(10, 10, 19, 19);
+    inv_area(300, 10, 309, 19);
+    inv_area(0, 0, 399, 99);
+    lv_refr_now(NULL);
+
+    TEST_ASSERT_EQUAL(1, flush_cnt);
+    TEST_ASSERT_EQUAL(400 * 100, get_flushed_size());
+}
+
+void test_inv_area_split_overlapping_areas(void)
+{
+    /*An L shape: joining them would redraw a 400x400 area*/
+    inv_area(0, 0, 399, 19);
+    inv_area(0, 0, 19, 399);
+    lv_refr_now(NULL);
+
+    TEST_ASSERT_EQUAL(2, flush_cnt);
+    assert_no_overlap();
+    TEST_ASSERT_EQUAL(400 * 20 + 380 * 20, get_flushed_size());
+}
+
+void test_inv_area_overflow(void)
+{
+    /*More far areas than LV_INV_BUF_SIZE shouldn't redraw the whole screen*/
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < 8; y++) {
+        for(x = 0; x < 8; x++) {
+            inv_area(x * 100, y * 60, x * 100 + 4, y * 60 + 4);
+        }
+    }
+    lv_refr_now(NULL);
+
+    TEST_ASSERT_GREATER_THAN(1, flush_cnt);
+    TEST_ASSERT_LESS_OR_EQUAL(32, flush_cnt);
+    assert_no_overlap();
+    TEST_ASSERT_LESS_THAN(800 * 480 / 4, get_flushed_size());
+}
+
+#endif
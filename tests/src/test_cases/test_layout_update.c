@@ -0,0 +1,180 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+static uint32_t counting_layout;
+static uint32_t layout_cnt;
+
+/*Count the updates of the layout and apply flex on the object*/
+static void counting_layout_cb(lv_obj_t * obj, void * user_data)
+{
+    LV_UNUSED(user_data);
+    layout_cnt++;
+    lv_obj_set_user_data(obj, (void *)((lv_uintptr_t)lv_obj_get_user_data(obj) + 1));
+
+    lv_layout_dsc_t * flex = &LV_GLOBAL_DEFAULT()->layout_list[LV_LAYOUT_FLEX];
+    flex->cb(obj, flex->user_data);
+}
+
+static uint32_t get_layout_cnt(lv_obj_t * obj)
+{
+    return (uint32_t)(lv_uintptr_t)lv_obj_get_user_data(obj);
+}
+
+static void reset_layout_cnt(lv_obj_t * list)
+{
+    layout_cnt = 0;
+    lv_obj_set_user_data(list, NULL);
+    uint32_t i;
+    for(i = 0; i < lv_obj_get_child_count(list); i++) {
+        lv_obj_set_user_data(lv_obj_get_child(list, i), NULL);
+    }
+}
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+}
+
+/*A column of `row_cnt` rows, each with a content sized row with `label_cnt` labels*/
+static lv_obj_t * create_list(lv_obj_t * parent, uint32_t row_cnt, uint32_t label_cnt)
+{
+    lv_obj_t * list = lv_obj_create(parent);
+    lv_obj_set_size(list, 400, LV_SIZE_CONTENT);
+    lv_obj_set_flex_flow(list, LV_FLEX_FLOW_COLUMN);
+
+    uint32_t i;
+    for(i = 0; i < row_cnt; i++) {
+        lv_obj_t * row = lv_obj_create(list);
+        lv_obj_set_size(row, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
+        lv_obj_set_flex_flow(row, LV_FLEX_FLOW_ROW);
+
+        uint32_t j;
+        for(j = 0; j < label_cnt; j++) {
+            lv_obj_t * label = lv_label_create(row);
+            lv_label_set_text(label, "A");
+        }
+    }
+
+    return list;
+}
+
+void test_layout_update_content_size_of_ancestors(void)
+{
+    lv_obj_t * list = create_list(lv_screen_active(), 5, 3);
+    lv_obj_update_layout(list);
+
+    lv_obj_t * row2 = lv_obj_get_child(list, 2);
+    lv_obj_t * row3 = lv_obj_get_child(list, 3);
+    lv_obj_t * label = lv_obj_get_child(row2, 1);
+    int32_t list_h = lv_obj_get_height(list);
+    int32_t row2_w = lv_obj_get_width(row2);
+    int32_t row2_h = lv_obj_get_height(row2);
+    int32_t row3_y = lv_obj_get_y(row3);
+    int32_t label_h = lv_obj_get_height(label);
+
+    /*A taller label makes its row, the list and the position of the next rows change*/
+    lv_label_set_text(label, "AAAA\nA\nA");
+    lv_obj_update_layout(list);
+
+    int32_t label_dh = lv_obj_get_height(label) - label_h;
+    TEST_ASSERT_GREATER_THAN(0, label_dh);
+    TEST_ASSERT_GREATER_THAN(row2_w, lv_obj_get_width(row2));
+    TEST_ASSERT_EQUAL(row2_h + label_dh, lv_obj_get_height(row2));
+    TEST_ASSERT_EQUAL(row3_y + label_dh, lv_obj_get_y(row3));
+    TEST_ASSERT_EQUAL(list_h + label_dh, lv_obj_get_height(list));
+}
+
+void test_layout_update_hidden_and_moved_children(void)
+{
+    lv_obj_t * list = create_list(lv_screen_active(), 4, 2);
+    lv_obj_update_layout(list);
+
+    lv_obj_t * row0 = lv_obj_get_child(list, 0);
+    lv_obj_t * row1 = lv_obj_get_child(list, 1);
+    lv_obj_t * row2 = lv_obj_get_child(list, 2);
+    int32_t row1_y = lv_obj_get_y(row1);
+
+    lv_obj_add_flag(row1, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_update_layout(list);
+    TEST_ASSERT_EQUAL(row1_y, lv_obj_get_y(row2));
+
+    /*Move a label to another row*/
+    lv_obj_remove_flag(row1, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_t * label = lv_obj_get_child(row0, 0);
+    int32_t row0_w = lv_obj_get_width(row0);
+    int32_t row2_w = lv_obj_get_width(row2);
+    lv_obj_set_parent(label, row2);
+    lv_obj_update_layout(list);
+    TEST_ASSERT_LESS_THAN(row0_w, lv_obj_get_width(row0));
+    TEST_ASSERT_GREATER_THAN(row2_w, lv_obj_get_width(row2));
+    TEST_ASSERT_EQUAL(row1_y, lv_obj_get_y(row1));
+}
+
+/*Update the layout after changing one label with visiting only the dirty subtrees
+ *and with updating all objects, and compare the number of layout updates and the results*/
+void test_layout_update_only_dirty_subtrees(void)
+{
+    if(counting_layout == 0) counting_layout = lv_layout_register(counting_layout_cb, NULL);
+
+    lv_obj_t * lists[2];
+    uint32_t l;
+    for(l = 0; l < 2; l++) {
+        lists[l] = create_list(lv_screen_active(), 50, 3);
+        lv_obj_set_style_layout(lists[l], counting_layout, 0);
+        uint32_t i;
+        for(i = 0; i < lv_obj_get_child_count(lists[l]); i++) {
+            lv_obj_set_style_layout(lv_obj_get_child(lists[l], i), counting_layout, 0);
+        }
+    }
+    lv_obj_update_layout(lv_screen_active());
+
+    /*Only the row of the label and the list are updated.
+     *The row is updated twice as its size changes in its first update.*/
+    reset_layout_cnt(lists[0]);
+    lv_label_set_text(lv_obj_get_child(lv_obj_get_child(lists[0], 25), 1), "AAA");
+    lv_obj_update_layout(lv_screen_active());
+    TEST_ASSERT_EQUAL(3, layout_cnt);
+    TEST_ASSERT_EQUAL(1, get_layout_cnt(lists[0]));
+    TEST_ASSERT_EQUAL(2, get_layout_cnt(lv_obj_get_child(lists[0], 25)));
+
+    /*Update all objects of the other list after the same change*/
+    reset_layout_cnt(lists[1]);
+    lv_label_set_text(lv_obj_get_child(lv_obj_get_child(lists[1], 25), 1), "AAA");
+    lv_obj_mark_layout_as_dirty(lists[1]);
+    uint32_t i;
+    for(i = 0; i < lv_obj_get_child_count(lists[1]); i++) {
+        lv_obj_mark_layout_as_dirty(lv_obj_get_child(lists[1], i));
+    }
+    lv_obj_update_layout(lv_screen_active());
+    TEST_ASSERT_EQUAL(52, layout_cnt);
+    TEST_ASSERT_EQUAL(1, get_layout_cnt(lists[1]));
+    for(i = 0; i < lv_obj_get_child_count(lists[1]); i++) {
+        TEST_ASSERT_EQUAL(i == 25 ? 2 : 1, get_layout_cnt(lv_obj_get_child(lists[1], i)));
+    }
+
+    /*The results are the same*/
+    lv_area_t list0_coords;
+    lv_area_t list1_coords;
+    lv_obj_get_coords(lists[0], &list0_coords);
+    lv_obj_get_coords(lists[1], &list1_coords);
+    TEST_ASSERT_EQUAL(lv_area_get_width(&list0_coords), lv_area_get_width(&list1_coords));
+    TEST_ASSERT_EQUAL(lv_area_get_height(&list0_coords), lv_area_get_height(&list1_coords));
+    for(i = 0; i < lv_obj_get_child_count(lists[0]); i++) {
+        lv_obj_t * row0 = lv_obj_get_child(lists[0], i);
+        lv_obj_t * row1 = lv_obj_get_child(lists[1], i);
+        TEST_ASSERT_EQUAL(lv_obj_get_y(row0), lv_obj_get_y(row1));
+        TEST_ASSERT_EQUAL(lv_obj_get_width(row0), lv_obj_get_width(row1));
+        TEST_ASSERT_EQUAL(lv_obj_get_height(row0), lv_obj_get_height(row1));
+        TEST_ASSERT_EQUAL(lv_obj_get_x(lv_obj_get_child(row0, 2)), lv_obj_get_x(lv_obj_get_child(row1, 2)));
+    }
+}
+
+#endif
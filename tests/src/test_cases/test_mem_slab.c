@@ -0,0 +1,138 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#define BLOCK_CNT 200
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+}
+
+void test_mem_slab_alloc_and_free(void)
+{
+    static uint8_t * blocks[BLOCK_CNT];
+    uint32_t i;
+    for(i = 0; i < BLOCK_CNT; i++) {
+        size_t size = 1 + i % 256;
+        blocks[i] = lv_malloc_slab(size);
+        TEST_ASSERT_NOT_NULL(blocks[i]);
+        TEST_ASSERT_EQUAL(0, (lv_uintptr_t)blocks[i] % sizeof(void *));
+        lv_memset(blocks[i], i & 0xff, size);
+    }
+
+    /*No block is overwritten by an other one*/
+    for(i = 0; i < BLOCK_CNT; i++) {
+        size_t size = 1 + i % 256;
+        size_t j;
+        for(j = 0; j < size; j++) TEST_ASSERT_EQUAL_UINT8(i & 0xff, blocks[i][j]);
+    }
+
+    for(i = 0; i < BLOCK_CNT; i++) {
+        lv_free(blocks[i]);
+    }
+
+    /*Zeroed and too large allocations*/
+    uint8_t * p = lv_malloc_slab_zeroed(100);
+    TEST_ASSERT_EACH_EQUAL_UINT8(0, p, 100);
+    lv_free(p);
+
+    p = lv_malloc_slab_zeroed(1000);
+    TEST_ASSERT_EACH_EQUAL_UINT8(0, p, 1000);
+    lv_free(p);
+}
+
+void test_mem_slab_realloc(void)
+{
+    uint8_t * p = lv_malloc_slab(40);
+    uint32_t i;
+    for(i = 0; i < 40; i++) p[i] = i;
+
+    /*Still fits into the block*/
+    p = lv_realloc(p, 44);
+    for(i = 0; i < 40; i++) TEST_ASSERT_EQUAL_UINT8(i, p[i]);
+
+    p = lv_realloc(p, 600);
+    for(i = 0; i < 40; i++) TEST_ASSERT_EQUAL_UINT8(i, p[i]);
+
+    lv_free(p);
+}
+
+#if LV_USE_MEM_SLAB
+static const lv_mem_slab_monitor_t * get_class_mon(lv_mem_monitor_t * mon, uint32_t block_size)
+{
+    uint32_t i;
+    for(i = 0; i < LV_MEM_SLAB_CLASS_CNT; i++) {
+        if(mon->slab[i].block_size == block_size) return &mon->slab[i];
+    }
+
+    TEST_FAIL();
+    return NULL;
+}
+#endif
+
+void test_mem_slab_monitor(void)
+{
+#if LV_USE_MEM_SLAB
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    lv_mem_slab_monitor_t before = *get_class_mon(&mon, 96);
+
+    static void * blocks[BLOCK_CNT];
+    uint32_t i;
+    for(i = 0; i < BLOCK_CNT; i++) {
+        blocks[i] = lv_malloc_slab(90);
+    }
+
+    lv_mem_monitor(&mon);
+    const lv_mem_slab_monitor_t * after = get_class_mon(&mon, 96);
+    TEST_ASSERT_EQUAL(before.used_cnt + BLOCK_CNT, after->used_cnt);
+    TEST_ASSERT_EQUAL(before.alloc_cnt + BLOCK_CNT, after->alloc_cnt);
+    TEST_ASSERT_GREATER_THAN(before.page_cnt, after->page_cnt);
+    TEST_ASSERT_LESS_OR_EQUAL(after->page_cnt * LV_MEM_SLAB_PAGE_SIZE / 96, after->used_cnt + after->free_cnt);
+
+    /*The empty pages are given back except one which is kept for the next allocations*/
+    for(i = 0; i < BLOCK_CNT; i++) {
+        lv_free(blocks[i]);
+    }
+
+    lv_mem_monitor(&mon);
+    after = get_class_mon(&mon, 96);
+    TEST_ASSERT_EQUAL(before.used_cnt, after->used_cnt);
+    TEST_ASSERT_LESS_OR_EQUAL(before.page_cnt + 1, after->page_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL(1, after->page_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL((LV_MEM_SLAB_PAGE_SIZE - 64) / 96, after->free_cnt);
+#endif
+}
+
+void test_mem_slab_keep_empty_page(void)
+{
+#if LV_USE_MEM_SLAB
+    /*Allocating and freeing a block in every frame shouldn't allocate and free a page every time*/
+    void * p = lv_malloc_slab(90);
+    lv_free(p);
+
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    lv_mem_slab_monitor_t before = *get_class_mon(&mon, 96);
+    TEST_ASSERT_GREATER_OR_EQUAL(1, before.page_cnt);
+
+    uint32_t i;
+    for(i = 0; i < 100; i++) {
+        void * p2 = lv_malloc_slab(90);
+        TEST_ASSERT_NOT_NULL(p2);
+        lv_free(p2);
+
+        lv_mem_monitor(&mon);
+        TEST_ASSERT_EQUAL(before.page_cnt, get_class_mon(&mon, 96)->page_cnt);
+    }
+#endif
+}
+
+#endif
@@ -0,0 +1,226 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#define SCREEN_BUF_SIZE (800 * 480 * 4)
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+}
+
+#if LV_OBJ_DRAW_CACHE
+static uint32_t draw_main_cnt;
+static uint8_t screen_ref[SCREEN_BUF_SIZE];
+
+static void draw_main_event_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    draw_main_cnt++;
+}
+
+static void save_screen(void)
+{
+    extern uint8_t * last_flushed_buf;
+    lv_memcpy(screen_ref, lv_draw_buf_align(last_flushed_buf, LV_COLOR_FORMAT_ARGB8888), SCREEN_BUF_SIZE);
+}
+
+static void check_screen(void)
+{
+    extern uint8_t * last_flushed_buf;
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(screen_ref, lv_draw_buf_align(last_flushed_buf, LV_COLOR_FORMAT_ARGB8888),
+                                  SCREEN_BUF_SIZE);
+}
+
+/*Redraw the whole screen without invalidating any objects*/
+static void refr_screen(void)
+{
+    lv_area_t a = {0, 0, 799, 479};
+    _lv_inv_area(NULL, &a);
+    lv_refr_now(NULL);
+}
+
+static lv_obj_t * create_counted_obj(lv_obj_t * parent)
+{
+    lv_obj_t * obj = lv_obj_create(parent);
+    lv_obj_set_size(obj, 200, 100);
+    lv_obj_set_style_shadow_width(obj, 20, 0);
+    lv_obj_add_event_cb(obj, draw_main_event_cb, LV_EVENT_DRAW_MAIN, NULL);
+    return obj;
+}
+#endif
+
+void test_obj_draw_cache_replay_looks_the_same(void)
+{
+#if LV_OBJ_DRAW_CACHE
+    lv_obj_t * obj = create_counted_obj(lv_screen_active());
+    lv_obj_set_style_bg_grad_color(obj, lv_palette_main(LV_PALETTE_RED), 0);
+    lv_obj_set_style_bg_grad_dir(obj, LV_GRAD_DIR_VER, 0);
+
+    lv_obj_t * label = lv_label_create(obj);
+    lv_label_set_text(label, "Draw cache");
+
+    /*Scales draw their labels with local texts*/
+    lv_obj_t * scale = lv_scale_create(lv_screen_active());
+    lv_obj_set_size(scale, 300, 300);
+    lv_obj_align(scale, LV_ALIGN_RIGHT_MID, -20, 0);
+    lv_scale_set_mode(scale, LV_SCALE_MODE_ROUND_INNER);
+    lv_scale_set_label_show(scale, true);
+
+    lv_obj_t * slider = lv_slider_create(lv_screen_active());
+    lv_obj_align(slider, LV_ALIGN_BOTTOM_LEFT, 20, -40);
+    lv_slider_set_value(slider, 40, LV_ANIM_OFF);
+
+    draw_main_cnt = 0;
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(1, draw_main_cnt);
+    save_screen();
+
+    refr_screen();
+    TEST_ASSERT_EQUAL(1, draw_main_cnt);
+    check_screen();
+
+    /*Only a part of the object is redrawn*/
+    lv_area_t a = {30, 30, 80, 60};
+    _lv_inv_area(NULL, &a);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(1, draw_main_cnt);
+    check_screen();
+#endif
+}
+
+void test_obj_draw_cache_redraw_changed_objects(void)
+{
+#if LV_OBJ_DRAW_CACHE
+    lv_obj_t * obj1 = create_counted_obj(lv_screen_active());
+    lv_obj_t * obj2 = create_counted_obj(lv_screen_active());
+    lv_obj_set_pos(obj2, 300, 0);
+    lv_obj_set_style_bg_color(obj1, lv_palette_main(LV_PALETTE_RED), LV_STATE_CHECKED);
+
+    draw_main_cnt = 0;
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(2, draw_main_cnt);
+
+    /*Invalidated*/
+    lv_obj_invalidate(obj1);
+    refr_screen();
+    TEST_ASSERT_EQUAL(3, draw_main_cnt);
+
+    /*Style change*/
+    lv_obj_set_style_bg_color(obj2, lv_palette_main(LV_PALETTE_GREEN), 0);
+    refr_screen();
+    TEST_ASSERT_EQUAL(4, draw_main_cnt);
+
+    /*State change*/
+    lv_obj_add_state(obj1, LV_STATE_CHECKED);
+    refr_screen();
+    TEST_ASSERT_EQUAL(5, draw_main_cnt);
+
+    /*Moved*/
+    lv_obj_set_pos(obj1, 0, 200);
+    refr_screen();
+    TEST_ASSERT_EQUAL(6, draw_main_cnt);
+
+    refr_screen();
+    TEST_ASSERT_EQUAL(6, draw_main_cnt);
+#endif
+}
+
+void test_obj_draw_cache_scrolled_children(void)
+{
+#if LV_OBJ_DRAW_CACHE
+    lv_obj_t * cont = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(cont, 300, 300);
+    lv_obj_t * obj = create_counted_obj(cont);
+    lv_obj_set_y(obj, 400);
+
+    draw_main_cnt = 0;
+    lv_obj_scroll_to_y(cont, 300, LV_ANIM_OFF);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(1, draw_main_cnt);
+    save_screen();
+
+    /*The recorded tasks have absolute coordinates so they can't be used after scrolling*/
+    lv_obj_scroll_by(cont, 0, 20, LV_ANIM_OFF);
+    refr_screen();
+    TEST_ASSERT_EQUAL(2, draw_main_cnt);
+
+    lv_obj_scroll_by(cont, 0, -20, LV_ANIM_OFF);
+    refr_screen();
+    TEST_ASSERT_EQUAL(3, draw_main_cnt);
+    check_screen();
+#endif
+}
+
+void test_obj_draw_cache_keep_children_on_parent_invalidation(void)
+{
+#if LV_OBJ_DRAW_CACHE
+    lv_obj_t * cont = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(cont, 400, 300);
+    create_counted_obj(cont);
+
+    draw_main_cnt = 0;
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(1, draw_main_cnt);
+    save_screen();
+
+    /*Only the invalidated objects are redrawn, not their children*/
+    lv_obj_invalidate(cont);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(1, draw_main_cnt);
+
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(1, draw_main_cnt);
+
+    /*Not inherited properties of the parent don't change the children*/
+    lv_obj_set_style_bg_color(cont, lv_palette_main(LV_PALETTE_RED), 0);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(1, draw_main_cnt);
+
+    lv_obj_remove_local_style_prop(cont, LV_STYLE_BG_COLOR, 0);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(1, draw_main_cnt);
+    check_screen();
+#endif
+}
+
+void test_obj_draw_cache_redraw_children_on_inherited_change(void)
+{
+#if LV_OBJ_DRAW_CACHE
+    lv_obj_t * cont = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(cont, 400, 300);
+    lv_obj_t * obj = create_counted_obj(cont);
+    lv_obj_t * label = lv_label_create(obj);
+    lv_label_set_text(label, "Inherited color");
+
+    draw_main_cnt = 0;
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(1, draw_main_cnt);
+
+    /*The label inherits the text color through `obj`*/
+    lv_obj_set_style_text_color(cont, lv_palette_main(LV_PALETTE_RED), 0);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(2, draw_main_cnt);
+    save_screen();
+
+    /*The children use the opacity of the parents too*/
+    lv_obj_set_style_opa(cont, LV_OPA_50, 0);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(3, draw_main_cnt);
+
+    lv_obj_set_style_opa(cont, LV_OPA_COVER, 0);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(4, draw_main_cnt);
+    check_screen();
+#endif
+}
+
+#endif
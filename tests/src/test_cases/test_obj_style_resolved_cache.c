@@ -0,0 +1,123 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include "lv_test_helpers.h"
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_obj_style_resolved_cache_inherited_props(void)
+{
+    lv_obj_t * parent = lv_obj_create(lv_screen_active());
+    lv_obj_t * parent2 = lv_obj_create(lv_screen_active());
+    lv_obj_t * label = lv_label_create(parent);
+
+    lv_obj_set_style_text_color(parent, lv_color_hex(0xff0000), 0);
+    lv_obj_set_style_text_color(parent2, lv_color_hex(0x0000ff), 0);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0xff0000), lv_obj_get_style_text_color(label, 0));
+
+    /*Change the parent's style*/
+    lv_obj_set_style_text_color(parent, lv_color_hex(0x00ff00), 0);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x00ff00), lv_obj_get_style_text_color(label, 0));
+
+    /*Change the parent's state*/
+    lv_obj_set_style_text_color(parent, lv_color_hex(0x808080), LV_STATE_CHECKED);
+    lv_obj_add_state(parent, LV_STATE_CHECKED);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x808080), lv_obj_get_style_text_color(label, 0));
+    lv_obj_remove_state(parent, LV_STATE_CHECKED);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x00ff00), lv_obj_get_style_text_color(label, 0));
+
+    /*Move to an other parent*/
+    lv_obj_set_parent(label, parent2);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x0000ff), lv_obj_get_style_text_color(label, 0));
+}
+
+void test_obj_style_resolved_cache_shared_style_change(void)
+{
+    static lv_style_t style;
+    lv_style_init(&style);
+    lv_style_set_pad_top(&style, 5);
+
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_add_style(obj, &style, 0);
+    TEST_ASSERT_EQUAL(5, lv_obj_get_style_pad_top(obj, 0));
+
+    lv_style_set_pad_top(&style, 7);
+    lv_obj_report_style_change(&style);
+    TEST_ASSERT_EQUAL(7, lv_obj_get_style_pad_top(obj, 0));
+
+    lv_obj_remove_style(obj, &style, 0);
+    TEST_ASSERT_NOT_EQUAL(7, lv_obj_get_style_pad_top(obj, 0));
+
+    lv_style_reset(&style);
+}
+
+void test_obj_style_resolved_cache_transition_start(void)
+{
+    static const lv_style_prop_t props[] = {LV_STYLE_BG_OPA, 0};
+    static lv_style_transition_dsc_t tr;
+    lv_style_transition_dsc_init(&tr, props, lv_anim_path_linear, 100, 0, NULL);
+
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, 0);
+    lv_obj_set_style_bg_opa(obj, LV_OPA_TRANSP, LV_STATE_PRESSED);
+    lv_obj_set_style_transition(obj, &tr, LV_STATE_PRESSED);
+    TEST_ASSERT_EQUAL(LV_OPA_COVER, lv_obj_get_style_bg_opa(obj, 0));
+
+    /*The transition starts from the previous value*/
+    lv_obj_add_state(obj, LV_STATE_PRESSED);
+    TEST_ASSERT_EQUAL(LV_OPA_COVER, lv_obj_get_style_bg_opa(obj, 0));
+
+    lv_test_wait(50);
+    lv_opa_t opa = lv_obj_get_style_bg_opa(obj, 0);
+    TEST_ASSERT_LESS_THAN(LV_OPA_COVER, opa);
+    TEST_ASSERT_GREATER_THAN(LV_OPA_TRANSP, opa);
+
+    lv_test_wait(100);
+    TEST_ASSERT_EQUAL(LV_OPA_TRANSP, lv_obj_get_style_bg_opa(obj, 0));
+}
+
+void test_obj_style_resolved_cache_info(void)
+{
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_set_style_radius(obj, 12, 0);
+    lv_obj_set_style_radius(obj, 3, LV_PART_SCROLLBAR);
+
+    lv_obj_style_resolved_cache_info_t info;
+    lv_obj_style_get_resolved_cache_info(&info);
+    TEST_ASSERT_EQUAL(32, info.prop_cnt);
+    TEST_ASSERT_EQUAL(info.entry_cnt * info.entry_size, info.mem_size);
+    uint32_t hit_cnt = info.hit_cnt;
+    uint32_t miss_cnt = info.miss_cnt;
+
+    TEST_ASSERT_EQUAL(12, lv_obj_get_style_radius(obj, 0));
+    TEST_ASSERT_EQUAL(12, lv_obj_get_style_radius(obj, 0));
+    TEST_ASSERT_EQUAL(3, lv_obj_get_style_radius(obj, LV_PART_SCROLLBAR));
+    TEST_ASSERT_EQUAL(3, lv_obj_get_style_radius(obj, LV_PART_SCROLLBAR));
+
+    /*Not cached property*/
+    lv_obj_get_style_shadow_offset_x(obj, 0);
+
+    lv_obj_style_get_resolved_cache_info(&info);
+    TEST_ASSERT_EQUAL(hit_cnt + 2, info.hit_cnt);
+    TEST_ASSERT_EQUAL(miss_cnt + 2, info.miss_cnt);
+
+    /*The entries of the main and scrollbar parts are freed with the object*/
+    uint32_t entry_cnt = info.entry_cnt;
+    lv_obj_delete(obj);
+    lv_obj_style_get_resolved_cache_info(&info);
+    TEST_ASSERT_LESS_OR_EQUAL(entry_cnt - 2, info.entry_cnt);
+#endif
+}
+
+#endif
@@ -0,0 +1,170 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+static uint32_t covered_draw_cnt;
+static uint32_t visible_draw_cnt;
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+}
+
+static void draw_main_cb(lv_event_t * e)
+{
+    uint32_t * cnt = lv_event_get_user_data(e);
+    (*cnt)++;
+}
+
+/*A row of buttons with a panel above them and a button below the panel*/
+static lv_obj_t * create_scene(void)
+{
+    lv_obj_t * scr = lv_screen_active();
+    uint32_t i;
+    for(i = 0; i < 10; i++) {
+        lv_obj_t * btn = lv_button_create(scr);
+        lv_obj_set_pos(btn, 20 + i * 70, 100);
+        lv_obj_set_size(btn, 60, 40);
+        lv_obj_add_event_cb(btn, draw_main_cb, LV_EVENT_DRAW_MAIN_BEGIN, &covered_draw_cnt);
+    }
+
+    lv_obj_t * btn = lv_button_create(scr);
+    lv_obj_set_pos(btn, 20, 400);
+    lv_obj_set_size(btn, 60, 40);
+    lv_obj_add_event_cb(btn, draw_main_cb, LV_EVENT_DRAW_MAIN_BEGIN, &visible_draw_cnt);
+
+    lv_obj_t * panel = lv_obj_create(scr);
+    lv_obj_set_pos(panel, 0, 50);
+    lv_obj_set_size(panel, 800, 200);
+    lv_obj_set_style_radius(panel, 0, 0);
+    lv_obj_set_style_bg_color(panel, lv_palette_lighten(LV_PALETTE_BLUE, 3), 0);
+
+    lv_obj_t * label = lv_label_create(panel);
+    lv_label_set_text(label, "Opaque panel");
+    lv_obj_center(label);
+
+    return panel;
+}
+
+static void refr_all(void)
+{
+    covered_draw_cnt = 0;
+    visible_draw_cnt = 0;
+
+    /*Invalidate the objects one by one to not draw them from their draw cache without the draw events*/
+    lv_obj_t * scr = lv_screen_active();
+    uint32_t i;
+    for(i = 0; i < lv_obj_get_child_count(scr); i++) {
+        lv_obj_invalidate(lv_obj_get_child(scr, i));
+    }
+    lv_obj_invalidate(scr);
+    lv_refr_now(NULL);
+}
+
+void test_occlusion_culling_skip_covered_objects(void)
+{
+    create_scene();
+    refr_all();
+
+#if LV_OBJ_OCCLUSION_CULLING
+    TEST_ASSERT_EQUAL(0, covered_draw_cnt);
+#if LV_USE_REFR_STATS
+    /*At least the area of the buttons wasn't drawn*/
+    TEST_ASSERT_GREATER_OR_EQUAL(10 * 60 * 40, lv_refr_stats_get(NULL)->px_occluded);
+#endif
+#else
+    TEST_ASSERT_GREATER_THAN(0, covered_draw_cnt);
+#endif
+    TEST_ASSERT_GREATER_THAN(0, visible_draw_cnt);
+
+    /*Must look the same as without occlusion culling*/
+    TEST_ASSERT_EQUAL_SCREENSHOT("occlusion_culling_1.png");
+}
+
+void test_occlusion_culling_marks_are_cleared(void)
+{
+    lv_obj_t * panel = create_scene();
+    refr_all();
+
+    lv_obj_add_flag(panel, LV_OBJ_FLAG_HIDDEN);
+    refr_all();
+    TEST_ASSERT_GREATER_THAN(0, covered_draw_cnt);
+#if LV_USE_REFR_STATS
+    TEST_ASSERT_EQUAL(0, lv_refr_stats_get(NULL)->px_occluded);
+#endif
+}
+
+void test_occlusion_culling_translucent_objects_dont_cover(void)
+{
+    lv_obj_t * panel = create_scene();
+    lv_obj_set_style_bg_opa(panel, LV_OPA_70, 0);
+    refr_all();
+    TEST_ASSERT_GREATER_THAN(0, covered_draw_cnt);
+
+    /*Opaque background but semi transparent parent*/
+    lv_obj_set_style_bg_opa(panel, LV_OPA_COVER, 0);
+    lv_obj_t * cont = lv_obj_create(lv_screen_active());
+    lv_obj_remove_style_all(cont);
+    lv_obj_set_size(cont, LV_PCT(100), LV_PCT(100));
+    lv_obj_set_style_opa(cont, LV_OPA_70, 0);
+    lv_obj_set_parent(panel, cont);
+    refr_all();
+    TEST_ASSERT_GREATER_THAN(0, covered_draw_cnt);
+}
+
+void test_occlusion_culling_child_of_later_sibling_covers(void)
+{
+    /*Move the panel to a transparent container created after the buttons*/
+    lv_obj_t * panel = create_scene();
+    lv_obj_t * cont = lv_obj_create(lv_screen_active());
+    lv_obj_remove_style_all(cont);
+    lv_obj_set_size(cont, LV_PCT(100), LV_PCT(100));
+    lv_obj_set_parent(panel, cont);
+    refr_all();
+
+#if LV_OBJ_OCCLUSION_CULLING
+    TEST_ASSERT_EQUAL(0, covered_draw_cnt);
+#endif
+    TEST_ASSERT_GREATER_THAN(0, visible_draw_cnt);
+    TEST_ASSERT_EQUAL_SCREENSHOT("occlusion_culling_1.png");
+}
+
+static void ext_draw_size_cb(lv_event_t * e)
+{
+    lv_event_set_ext_draw_size(e, 60);
+}
+
+void test_occlusion_culling_overflow_visible_parent(void)
+{
+    /*Move the panel to a container which ends above the buttons*/
+    lv_obj_t * panel = create_scene();
+    lv_obj_t * cont = lv_obj_create(lv_screen_active());
+    lv_obj_remove_style_all(cont);
+    lv_obj_set_size(cont, 800, 90);
+    lv_obj_add_event_cb(cont, ext_draw_size_cb, LV_EVENT_REFR_EXT_DRAW_SIZE, NULL);
+    lv_obj_refresh_ext_draw_size(cont);
+    lv_obj_set_parent(panel, cont);
+
+    /*The panel is clipped to the container so it doesn't cover the buttons*/
+    refr_all();
+    TEST_ASSERT_GREATER_THAN(0, covered_draw_cnt);
+
+    /*The panel is drawn on the extended draw area of the container too, until y = 149*/
+    lv_obj_add_flag(cont, LV_OBJ_FLAG_OVERFLOW_VISIBLE);
+    refr_all();
+#if LV_OBJ_OCCLUSION_CULLING
+    TEST_ASSERT_EQUAL(0, covered_draw_cnt);
+#else
+    TEST_ASSERT_GREATER_THAN(0, covered_draw_cnt);
+#endif
+    TEST_ASSERT_GREATER_THAN(0, visible_draw_cnt);
+}
+
+#endif
@@ -0,0 +1,130 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_REFR_STATS
+static uint32_t fake_tick;
+
+static uint32_t fake_tick_get_cb(void)
+{
+    /*Every query takes 10 us*/
+    fake_tick += 10;
+    return fake_tick;
+}
+#endif
+
+void setUp(void)
+{
+    /* Function run before every test */
+    lv_refr_now(NULL);
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+#if LV_USE_REFR_STATS
+    lv_refr_stats_set_tick_cb(NULL, 0);
+#endif
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_refr_stats_count_areas_and_tasks(void)
+{
+#if LV_USE_REFR_STATS
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(obj, 100, 50);
+    lv_obj_set_style_border_width(obj, 0, 0);
+    lv_obj_set_style_shadow_width(obj, 0, 0);
+    lv_obj_t * label = lv_label_create(lv_screen_active());
+    lv_label_set_text(label, "Stats");
+    lv_obj_set_pos(label, 600, 400);
+    lv_refr_now(NULL);
+
+    uint32_t frame_id = lv_refr_stats_get(NULL)->frame_id;
+
+    lv_area_t a1 = {0, 0, 99, 49};
+    lv_area_t a2 = {600, 400, 649, 419};
+    _lv_inv_area(NULL, &a1);
+    _lv_inv_area(NULL, &a2);
+    lv_refr_now(NULL);
+
+    const lv_refr_stats_t * stats = lv_refr_stats_get(NULL);
+    TEST_ASSERT_EQUAL(frame_id + 1, stats->frame_id);
+    TEST_ASSERT_EQUAL(2, stats->inv_area_cnt);
+    TEST_ASSERT_EQUAL(100 * 50 + 50 * 20, stats->px_rendered);
+    TEST_ASSERT_EQUAL(2, stats->flush_cnt);
+    TEST_ASSERT_EQUAL(stats->px_rendered, stats->px_flushed);
+
+    /*Screen background in both areas and the background of obj*/
+    TEST_ASSERT_EQUAL(3, stats->task_cnt[LV_DRAW_TASK_TYPE_FILL]);
+    TEST_ASSERT_EQUAL(1, stats->task_cnt[LV_DRAW_TASK_TYPE_LABEL]);
+
+    uint32_t task_cnt = 0;
+    uint32_t i;
+    for(i = 0; i < stats->unit_cnt; i++) task_cnt += stats->unit_task_cnt[i];
+    TEST_ASSERT_EQUAL(4, task_cnt);
+
+    /*Nothing is redrawn so the last stats remain*/
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(frame_id + 1, lv_refr_stats_get(NULL)->frame_id);
+#endif
+}
+
+void test_refr_stats_times(void)
+{
+#if LV_USE_REFR_STATS
+    lv_refr_stats_set_tick_cb(fake_tick_get_cb, 1000000);
+
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+
+    const lv_refr_stats_t * stats = lv_refr_stats_get(NULL);
+    TEST_ASSERT_GREATER_THAN(0, stats->refr_time);
+    TEST_ASSERT_GREATER_THAN(0, stats->flush_wait_time);
+    TEST_ASSERT_EQUAL(stats->refr_time, stats->render_time + stats->flush_wait_time);
+    TEST_ASSERT_GREATER_THAN(0, stats->unit_time[0]);
+#endif
+}
+
+void test_refr_stats_json_and_csv(void)
+{
+#if LV_USE_REFR_STATS
+    lv_refr_stats_t stats;
+    lv_memzero(&stats, sizeof(stats));
+    stats.frame_id = 3;
+    stats.inv_area_cnt = 2;
+    stats.task_cnt[LV_DRAW_TASK_TYPE_LABEL] = 5;
+    stats.unit_cnt = 2;
+    stats.unit_task_cnt[0] = 4;
+    stats.unit_task_cnt[1] = 6;
+    stats.unit_time[1] = 120;
+
+    char buf[1024];
+    uint32_t len = lv_refr_stats_to_json(&stats, buf, sizeof(buf));
+    TEST_ASSERT_EQUAL(lv_strlen(buf), len);
+    TEST_ASSERT_NOT_NULL(strstr(buf, "{\"frame_id\":3,\"inv_area_cnt\":2,"));
+    TEST_ASSERT_NOT_NULL(strstr(buf, "\"label\":5,"));
+    TEST_ASSERT_NOT_NULL(strstr(buf, "\"unit_task_cnt\":[4,6],\"unit_time\":[0,120]"));
+    TEST_ASSERT_EQUAL('}', buf[len - 1]);
+
+    /*Too small buffer: truncated but the required length is returned*/
+    char small_buf[16];
+    TEST_ASSERT_EQUAL(len, lv_refr_stats_to_json(&stats, small_buf, sizeof(small_buf)));
+    TEST_ASSERT_EQUAL(15, lv_strlen(small_buf));
+
+    /*The same number of columns in the header and the lines*/
+    char header[1024];
+    lv_refr_stats_csv_header(header, sizeof(header));
+    lv_refr_stats_to_csv(&stats, buf, sizeof(buf));
+    uint32_t header_col = 0;
+    uint32_t line_col = 0;
+    for(len = 0; header[len]; len++) if(header[len] == ',') header_col++;
+    for(len = 0; buf[len]; len++) if(buf[len] == ',') line_col++;
+    TEST_ASSERT_EQUAL(header_col, line_col);
+    TEST_ASSERT_EQUAL_STRING_LEN("frame_id,inv_area_cnt,", header, 22);
+    TEST_ASSERT_EQUAL_STRING_LEN("3,2,", buf, 4);
+#endif
+}
+
+#endif
@@ -117,4 +117,71 @@ void test_style_replacement(void)
     lv_style_reset(&style_blue);
 }
 
+void test_style_props_sorted(void)
+{
+    lv_style_t style;
+    lv_style_init(&style);
+
+    /*Set in random order and overwrite some*/
+    uint32_t i;
+    for(i = 0; i < 40; i++) {
+        lv_style_prop_t prop = (lv_style_prop_t)(1 + (i * 37) % (_LV_STYLE_NUM_BUILT_IN_PROPS - 1));
+        lv_style_set_prop(&style, prop, (lv_style_value_t) {
+            .num = prop
+        });
+    }
+    lv_style_set_prop(&style, LV_STYLE_RADIUS, (lv_style_value_t) {
+        .num = 1000
+    });
+
+    const lv_style_prop_t * props = (lv_style_prop_t *)style.values_and_props + style.prop_cnt * sizeof(lv_style_value_t);
+    for(i = 1; i < style.prop_cnt; i++) {
+        TEST_ASSERT_LESS_THAN(props[i], props[i - 1]);
+    }
+
+    lv_style_value_t v;
+    for(i = 0; i < 40; i++) {
+        lv_style_prop_t prop = (lv_style_prop_t)(1 + (i * 37) % (_LV_STYLE_NUM_BUILT_IN_PROPS - 1));
+        TEST_ASSERT_EQUAL(LV_STYLE_RES_FOUND, lv_style_get_prop(&style, prop, &v));
+        TEST_ASSERT_EQUAL(prop == LV_STYLE_RADIUS ? 1000 : prop, v.num);
+    }
+
+    /*Remove keeps the order*/
+    TEST_ASSERT_TRUE(lv_style_remove_prop(&style, props[style.prop_cnt / 2]));
+    props = (lv_style_prop_t *)style.values_and_props + style.prop_cnt * sizeof(lv_style_value_t);
+    for(i = 1; i < style.prop_cnt; i++) {
+        TEST_ASSERT_LESS_THAN(props[i], props[i - 1]);
+    }
+
+    lv_style_reset(&style);
+}
+
+void test_style_set_props(void)
+{
+    lv_style_t style;
+    lv_style_init(&style);
+    lv_style_set_bg_opa(&style, LV_OPA_50);
+    lv_style_set_width(&style, 20);
+
+    static const lv_style_prop_t props[] = {LV_STYLE_TEXT_LETTER_SPACE, LV_STYLE_PAD_TOP, LV_STYLE_BG_OPA, LV_STYLE_PAD_TOP};
+    lv_style_value_t values[] = {{.num = 3}, {.num = 5}, {.num = LV_OPA_COVER}, {.num = 6}};
+    lv_style_set_props(&style, props, values, 4);
+
+    TEST_ASSERT_EQUAL(4, style.prop_cnt);
+    TEST_ASSERT_TRUE(style.has_group & ((uint32_t)1 << _lv_style_get_prop_group(LV_STYLE_TEXT_LETTER_SPACE)));
+
+    lv_style_value_t v;
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_FOUND, lv_style_get_prop(&style, LV_STYLE_WIDTH, &v));
+    TEST_ASSERT_EQUAL(20, v.num);
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_FOUND, lv_style_get_prop(&style, LV_STYLE_PAD_TOP, &v));
+    TEST_ASSERT_EQUAL(6, v.num);
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_FOUND, lv_style_get_prop(&style, LV_STYLE_BG_OPA, &v));
+    TEST_ASSERT_EQUAL(LV_OPA_COVER, v.num);
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_FOUND, lv_style_get_prop(&style, LV_STYLE_TEXT_LETTER_SPACE, &v));
+    TEST_ASSERT_EQUAL(3, v.num);
+    TEST_ASSERT_EQUAL(LV_STYLE_RES_NOT_FOUND, lv_style_get_prop(&style, LV_STYLE_PAD_BOTTOM, &v));
+
+    lv_style_reset(&style);
+}
+
 #endif
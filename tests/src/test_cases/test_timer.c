@@ -0,0 +1,295 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include "lv_test_helpers.h"
+
+#define MAX_LOG 32
+
+static uint32_t run_log[MAX_LOG];
+static uint32_t run_cnt;
+static lv_timer_t * timer_to_delete;
+static lv_timer_t * created_timers[2];
+
+/*The timers of the display and the input devices*/
+static lv_timer_t * sys_timers[8];
+static uint32_t sys_timer_cnt;
+
+static void log_cb(lv_timer_t * timer)
+{
+    if(run_cnt < MAX_LOG) run_log[run_cnt] = (uint32_t)(lv_uintptr_t)lv_timer_get_user_data(timer);
+    run_cnt++;
+}
+
+static void delete_other_cb(lv_timer_t * timer)
+{
+    log_cb(timer);
+    if(timer_to_delete) {
+        lv_timer_delete(timer_to_delete);
+        timer_to_delete = NULL;
+    }
+}
+
+static void delete_self_cb(lv_timer_t * timer)
+{
+    log_cb(timer);
+    lv_timer_delete(timer);
+}
+
+static lv_timer_t * create(lv_timer_cb_t cb, uint32_t period, uint32_t id)
+{
+    return lv_timer_create(cb, period, (void *)(lv_uintptr_t)id);
+}
+
+static void create_other_cb(lv_timer_t * timer)
+{
+    log_cb(timer);
+    if(created_timers[0] == NULL) {
+        created_timers[0] = create(log_cb, 0, 10);
+        created_timers[1] = create(log_cb, 10, 11);
+    }
+}
+
+void setUp(void)
+{
+    /* Function run before every test */
+    run_cnt = 0;
+    timer_to_delete = NULL;
+    lv_memzero(created_timers, sizeof(created_timers));
+    lv_memzero(run_log, sizeof(run_log));
+
+    /*Pause the other timers to see only the timers of the tests*/
+    sys_timer_cnt = 0;
+    lv_timer_t * t = NULL;
+    while((t = lv_timer_get_next(t)) != NULL && sys_timer_cnt < 8) {
+        if(t->paused) continue;
+        lv_timer_pause(t);
+        sys_timers[sys_timer_cnt] = t;
+        sys_timer_cnt++;
+    }
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    uint32_t i;
+    for(i = 0; i < sys_timer_cnt; i++) {
+        lv_timer_resume(sys_timers[i]);
+    }
+}
+
+static bool timer_exists(lv_timer_t * timer)
+{
+    lv_timer_t * t = NULL;
+    while((t = lv_timer_get_next(t)) != NULL) {
+        if(t == timer) return true;
+    }
+    return false;
+}
+
+void test_timer_run_in_order_of_due_time(void)
+{
+    lv_timer_t * t1 = create(log_cb, 30, 1);
+    lv_timer_t * t2 = create(log_cb, 10, 2);
+    lv_timer_t * t3 = create(log_cb, 20, 3);
+
+    /*All of them are due, the one which has been waiting the longest runs first*/
+    lv_tick_inc(40);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL(3, run_cnt);
+    TEST_ASSERT_EQUAL(2, run_log[0]);
+    TEST_ASSERT_EQUAL(3, run_log[1]);
+    TEST_ASSERT_EQUAL(1, run_log[2]);
+
+    /*Only t2 is due and it tells when the next timer runs*/
+    lv_tick_inc(10);
+    uint32_t time_till_next = lv_timer_handler();
+    TEST_ASSERT_EQUAL(4, run_cnt);
+    TEST_ASSERT_EQUAL(2, run_log[3]);
+    TEST_ASSERT_EQUAL(10, time_till_next);
+
+    lv_timer_delete(t1);
+    lv_timer_delete(t2);
+    lv_timer_delete(t3);
+    TEST_ASSERT_EQUAL(LV_NO_TIMER_READY, lv_timer_handler());
+}
+
+void test_timer_same_due_time_runs_newest_first(void)
+{
+    lv_timer_t * t1 = create(log_cb, 10, 1);
+    lv_timer_t * t2 = create(log_cb, 10, 2);
+    lv_timer_t * t3 = create(log_cb, 10, 3);
+
+    /*Keep the order of the timer list: the newest timer runs first*/
+    uint32_t i;
+    for(i = 0; i < 2; i++) {
+        lv_tick_inc(10);
+        lv_timer_handler();
+        TEST_ASSERT_EQUAL(3 * (i + 1), run_cnt);
+        TEST_ASSERT_EQUAL(3, run_log[i * 3 + 0]);
+        TEST_ASSERT_EQUAL(2, run_log[i * 3 + 1]);
+        TEST_ASSERT_EQUAL(1, run_log[i * 3 + 2]);
+    }
+
+    lv_timer_delete(t1);
+    lv_timer_delete(t2);
+    lv_timer_delete(t3);
+}
+
+void test_timer_created_in_callback(void)
+{
+    lv_timer_t * t1 = create(create_other_cb, 10, 1);
+
+    /*The new timer which is already due runs in the same call, the other waits for its period*/
+    lv_tick_inc(10);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL(2, run_cnt);
+    TEST_ASSERT_EQUAL(1, run_log[0]);
+    TEST_ASSERT_EQUAL(10, run_log[1]);
+    TEST_ASSERT_NOT_NULL(created_timers[0]);
+    TEST_ASSERT_NOT_NULL(created_timers[1]);
+
+    lv_timer_delete(created_timers[0]);
+    lv_tick_inc(10);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL(4, run_cnt);
+    TEST_ASSERT_EQUAL(11, run_log[2]);
+    TEST_ASSERT_EQUAL(1, run_log[3]);
+
+    lv_timer_delete(t1);
+    lv_timer_delete(created_timers[1]);
+}
+
+void test_timer_long_period_and_long_pause(void)
+{
+    /*The scheduled time of the long timer is more than 2^31 ms later than the short one's*/
+    lv_timer_t * t_long = create(log_cb, 0x90000000, 1);
+    lv_timer_t * t_short = create(log_cb, 10, 2);
+
+    lv_tick_inc(10);
+    TEST_ASSERT_EQUAL(10, lv_timer_handler());
+    TEST_ASSERT_EQUAL(1, run_cnt);
+    TEST_ASSERT_EQUAL(2, run_log[0]);
+    lv_timer_delete(t_long);
+
+    /*The short timer is overdue for more than 2^31 ms but still runs before a new timer*/
+    lv_tick_inc(0x80000010);
+    lv_timer_t * t_new = create(log_cb, 5, 3);
+    TEST_ASSERT_EQUAL(5, lv_timer_handler());
+    TEST_ASSERT_EQUAL(2, run_cnt);
+    TEST_ASSERT_EQUAL(2, run_log[1]);
+
+    lv_tick_inc(5);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL(3, run_cnt);
+    TEST_ASSERT_EQUAL(3, run_log[2]);
+
+    lv_timer_delete(t_short);
+    lv_timer_delete(t_new);
+}
+
+void test_timer_delete_in_callback(void)
+{
+    create(delete_self_cb, 10, 1);
+    lv_timer_t * t2 = create(delete_other_cb, 10, 2);
+    timer_to_delete = create(log_cb, 20, 3);
+
+    /*t3 is ready too but deleted by t2 before it could run*/
+    lv_tick_inc(20);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL(2, run_cnt);
+    TEST_ASSERT_NULL(timer_to_delete);
+
+    lv_tick_inc(20);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL(3, run_cnt);
+    TEST_ASSERT_EQUAL(2, run_log[2]);
+
+    lv_timer_delete(t2);
+}
+
+void test_timer_pause_resume_and_reset(void)
+{
+    lv_timer_t * t1 = create(log_cb, 10, 1);
+
+    lv_timer_pause(t1);
+    lv_tick_inc(20);
+    TEST_ASSERT_EQUAL(LV_NO_TIMER_READY, lv_timer_handler());
+    TEST_ASSERT_EQUAL(0, run_cnt);
+
+    lv_timer_resume(t1);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL(1, run_cnt);
+
+    /*Reset and period change reschedule the timer*/
+    lv_tick_inc(5);
+    lv_timer_reset(t1);
+    TEST_ASSERT_EQUAL(10, lv_timer_handler());
+    lv_timer_set_period(t1, 30);
+    TEST_ASSERT_EQUAL(30, lv_timer_handler());
+
+    lv_timer_ready(t1);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL(2, run_cnt);
+
+    lv_timer_delete(t1);
+}
+
+void test_timer_repeat_count(void)
+{
+    lv_timer_t * t1 = create(log_cb, 10, 1);
+    lv_timer_t * t2 = create(log_cb, 10, 2);
+    lv_timer_set_repeat_count(t1, 2);
+    lv_timer_set_repeat_count(t2, 1);
+    lv_timer_set_auto_delete(t2, false);
+
+    uint32_t i;
+    for(i = 0; i < 4; i++) {
+        lv_tick_inc(10);
+        lv_timer_handler();
+    }
+
+    /*t1 is deleted after 2 runs, t2 is paused after 1 run*/
+    TEST_ASSERT_EQUAL(3, run_cnt);
+    TEST_ASSERT_FALSE(timer_exists(t1));
+    TEST_ASSERT_TRUE(timer_exists(t2));
+    TEST_ASSERT_TRUE(t2->paused);
+
+    /*Setting 0 repeat count deletes the timer on the next call without calling the callback*/
+    lv_timer_t * t3 = create(log_cb, 1000, 3);
+    lv_timer_set_repeat_count(t3, 0);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL(3, run_cnt);
+    TEST_ASSERT_FALSE(timer_exists(t3));
+
+    lv_timer_delete(t2);
+}
+
+void test_timer_many(void)
+{
+    static lv_timer_t * timers[200];
+    uint32_t min_period = UINT32_MAX;
+    uint32_t i;
+    for(i = 0; i < 200; i++) {
+        uint32_t period = 1000 + (i * 37) % 200;
+        timers[i] = create(log_cb, period, i);
+        if(i % 2 && period < min_period) min_period = period;
+    }
+
+    /*Delete every second timer to exercise the removal from the middle of the heap*/
+    for(i = 0; i < 200; i += 2) {
+        lv_timer_delete(timers[i]);
+    }
+
+    TEST_ASSERT_EQUAL(min_period, lv_timer_handler());
+
+    lv_tick_inc(1200);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL(100, run_cnt);
+
+    for(i = 1; i < 200; i += 2) {
+        lv_timer_delete(timers[i]);
+    }
+}
+
+#endif
@@ -5,6 +5,13 @@
 
 LV_IMAGE_DECLARE(test_img_lvgl_logo_png);
 
+/*The images scaled down to 50% or less are sampled from their mipmaps*/
+#if LV_USE_DRAW_SW && LV_DRAW_SW_IMAGE_MIPMAP
+    #define MIPMAP_SUFFIX "_mipmap"
+#else
+    #define MIPMAP_SUFFIX ""
+#endif
+
 void setUp(void)
 {
 
@@ -65,7 +72,7 @@ void test_image_scale_pivot_center(void)
         /*The default pivot should be the center*/
     }
 
-    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/image_scale_pivot_center.png");
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/image_scale_pivot_center" MIPMAP_SUFFIX ".png");
 }
 
 void test_image_scale_pivot_top_left(void)
@@ -79,7 +86,7 @@ void test_image_scale_pivot_top_left(void)
         lv_image_set_pivot(img, 0, 0);
     }
 
-    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/image_scale_pivot_top_left.png");
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/image_scale_pivot_top_left" MIPMAP_SUFFIX ".png");
 }
 
 void test_image_scale_x_pivot_center(void)
@@ -151,7 +158,7 @@ void test_image_rotate_and_scale_pivot_center(void)
         /*The default pivot should be the center*/
     }
 
-    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/image_rotate_and_scale_pivot_center.png");
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/image_rotate_and_scale_pivot_center" MIPMAP_SUFFIX ".png");
 }
 
 void test_image_rotate_and_scale_pivot_top_left(void)
@@ -167,7 +174,7 @@ void test_image_rotate_and_scale_pivot_top_left(void)
         lv_image_set_pivot(img, 0, 0);
     }
 
-    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/image_rotate_and_scale_pivot_top_left.png");
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/image_rotate_and_scale_pivot_top_left" MIPMAP_SUFFIX ".png");
 }
 
 void test_image_normal_align(void)
@@ -278,7 +285,7 @@ void test_image_stretch(void)
         lv_image_set_align(img, LV_IMAGE_ALIGN_STRETCH);
     }
 
-    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/image_stretch.png");
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/image_stretch" MIPMAP_SUFFIX ".png");
 }
 
 void test_image_tile(void)